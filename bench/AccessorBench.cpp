@@ -0,0 +1,118 @@
+#include <Bench.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/ReflectionMacros.hpp>
+#include <uesdk/helpers/ReflectionRegistry.hpp>
+
+#include <cstdio>
+#include <deque>
+#include <vector>
+
+using namespace SDK;
+
+// Few enough pawns to stay in cache, so the loops measure the accessors rather than memory.
+static constexpr int32_t kNumObjects = 4096;
+static constexpr int32_t kHealthOffset = 0x80;
+
+class APawn : public UObject
+{
+    UESDK_UOBJECT("Pawn", APawn);
+
+public:
+    UESDK_UPROPERTY(float, Health);
+};
+
+// Sums Health of every pawn through the accessor, the loop of a per-actor tick.
+static float SumHealth(const std::vector<APawn*>& Pawns)
+{
+    float Sum = 0.0f;
+    for (APawn* Pawn : Pawns)
+        Sum += Pawn->Health;
+    return Sum;
+}
+
+static float SumHealthGetMember(const std::vector<APawn*>& Pawns)
+{
+    float Sum = 0.0f;
+    for (APawn* Pawn : Pawns)
+        Sum += Pawn->GetMember<"Pawn", "Health", float>();
+    return Sum;
+}
+
+// The code the generated accessor should get down to.
+static float SumHealthConstantOffset(const std::vector<APawn*>& Pawns)
+{
+    float Sum = 0.0f;
+    for (APawn* Pawn : Pawns)
+        Sum += *reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(Pawn) + kHealthOffset);
+    return Sum;
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+    Fake::SetupNames();
+
+    Fake::FFakeObjectArray ObjectArray(kNumObjects + 1);
+
+    Fake::FFakeClass PawnClass("Pawn");
+    PawnClass.AddProperty("Health", kHealthOffset, sizeof(float), CPF_IsPlainOldData, CASTCLASS_FFloatProperty);
+    ObjectArray.Add(PawnClass.Get());
+
+    std::deque<Fake::FFakeObject> FakePawns;
+    std::vector<APawn*> Pawns;
+    Pawns.reserve(kNumObjects);
+    for (int32_t i = 0; i < kNumObjects; i++) {
+        UObject* Object = FakePawns.emplace_back().Get();
+        Object->Class = PawnClass.Get();
+        ObjectArray.Add(Object);
+
+        APawn* Pawn = static_cast<APawn*>(Object);
+        Pawn->Health = static_cast<float>(i % 100);
+        Pawns.push_back(Pawn);
+    }
+
+    if (!ResolveAllReflected()) {
+        std::puts("ResolveAllReflected failed");
+        return 1;
+    }
+
+    float Sums[5] = {};
+
+    Bench::Run("Constant offset x4096", 20000, [&]() {
+        Sums[0] = SumHealthConstantOffset(Pawns);
+        Bench::DoNotOptimize(Sums[0]);
+    });
+
+    Bench::Run("UESDK_UPROPERTY x4096 (unsealed)", 20000, [&]() {
+        Sums[1] = SumHealth(Pawns);
+        Bench::DoNotOptimize(Sums[1]);
+    });
+
+    Bench::Run("UObject::GetMember x4096 (unsealed)", 20000, [&]() {
+        Sums[2] = SumHealthGetMember(Pawns);
+        Bench::DoNotOptimize(Sums[2]);
+    });
+
+    if (!Seal()) {
+        std::puts("Seal failed");
+        return 1;
+    }
+
+    Bench::Run("UESDK_UPROPERTY x4096 (sealed)", 20000, [&]() {
+        Sums[3] = SumHealth(Pawns);
+        Bench::DoNotOptimize(Sums[3]);
+    });
+
+    Bench::Run("UObject::GetMember x4096 (sealed)", 20000, [&]() {
+        Sums[4] = SumHealthGetMember(Pawns);
+        Bench::DoNotOptimize(Sums[4]);
+    });
+
+    for (float Sum : Sums) {
+        if (Sum != Sums[0])
+            return 1;
+    }
+    return 0;
+}
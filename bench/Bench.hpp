@@ -0,0 +1,58 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Bench
+{
+    /**
+     * @brief Makes the compiler assume Value, and any memory, is read and written here.
+     * @brief Keeps unused results from being dropped and invariant work from being hoisted out of the timed loop.
+     */
+    template <typename T>
+    inline void DoNotOptimize(const T& Value)
+    {
+#ifdef _MSC_VER
+        static const void* volatile Sink;
+        Sink = &Value;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "r"(&Value) : "memory");
+#endif
+    }
+
+    /**
+     * @brief Runs Body Iterations times after a short warmup and prints the time per iteration.
+     *
+     * @param[in] Name - Printed in front of the result.
+     * @param[in] Iterations - Number of timed calls of Body.
+     * @param[in] Body - The measured work.
+     * @param[in] BytesPerIteration - If not 0, the throughput is printed as well.
+     *
+     * @return Nanoseconds per iteration.
+     */
+    template <typename Fn>
+    inline double Run(const char* Name, size_t Iterations, Fn&& Body, size_t BytesPerIteration = 0)
+    {
+        for (size_t i = 0; i < std::max<size_t>(Iterations / 10, 1); i++)
+            Body();
+
+        const auto Start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < Iterations; i++)
+            Body();
+        const auto End = std::chrono::steady_clock::now();
+
+        const double Ns = std::chrono::duration<double, std::nano>(End - Start).count() / static_cast<double>(Iterations);
+        if (BytesPerIteration)
+            std::printf("%-48s %14.1f ns/iter %10.1f MB/s\n", Name, Ns, static_cast<double>(BytesPerIteration) / Ns * 1e9 / (1024.0 * 1024.0));
+        else
+            std::printf("%-48s %14.1f ns/iter\n", Name, Ns);
+
+        return Ns;
+    }
+}
@@ -0,0 +1,56 @@
+#include <Bench.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/helpers/PECallWrapper.hpp>
+
+#include <deque>
+#include <vector>
+
+using namespace SDK;
+
+static constexpr size_t kNumObjects = 100000;
+
+struct FVector
+{
+    float X, Y, Z;
+};
+
+// Stand-in for K2_GetActorLocation, returns a location derived from the object.
+static void GetLocationProcessEvent(UObject* Object, UFunction*, void* Parms)
+{
+    const float Value = static_cast<float>(Object->Index);
+    *static_cast<FVector*>(Parms) = { Value, Value * 2.0f, Value * 3.0f };
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+
+    Fake::FFakeFunction Function(sizeof(FVector));
+    Function.AddParam(0, sizeof(FVector), CPF_IsPlainOldData | CPF_ReturnParm, CASTCLASS_FStructProperty);
+
+    std::deque<Fake::FFakeObject> FakeObjects;
+    std::vector<UObject*> Objects;
+    Objects.reserve(kNumObjects);
+    for (size_t i = 0; i < kNumObjects; i++) {
+        UObject* Object = FakeObjects.emplace_back(GetLocationProcessEvent).Get();
+        Object->Index = static_cast<int32_t>(i);
+        Objects.push_back(Object);
+    }
+
+    static PECallWrapper<"Actor", "K2_GetActorLocation", FVector()> GetLocation;
+    std::vector<FVector> Locations(kNumObjects);
+
+    Bench::Run("PECallWrapper::Call x100k", 20, [&]() {
+        for (size_t i = 0; i < kNumObjects; i++)
+            Locations[i] = GetLocation.Call(Objects[i], Function.Get());
+        Bench::DoNotOptimize(Locations);
+    });
+
+    Bench::Run("PECallWrapper::CallBatch x100k", 20, [&]() {
+        GetLocation.CallBatch(Objects, Function.Get(), Locations.data());
+        Bench::DoNotOptimize(Locations);
+    });
+
+    return Locations[kNumObjects - 1].X == static_cast<float>(kNumObjects - 1) ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#include <Bench.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/helpers/PECallWrapper.hpp>
+
+#include <cstring>
+
+using namespace SDK;
+
+struct FAddParms
+{
+    int32_t A;
+    int32_t B;
+    int32_t ReturnValue;
+};
+
+// The stand-ins do the same work, so the difference is the SDK's cost of each path. The engine's ProcessEvent adds its script VM dispatch on top.
+static void AddProcessEvent(UObject*, UFunction*, void* Parms)
+{
+    FAddParms* Params = static_cast<FAddParms*>(Parms);
+    Params->ReturnValue = Params->A + Params->B;
+}
+
+static size_t g_ThunkCalls = 0;
+
+static void AddThunk(void*, void* Frame, void* Result)
+{
+    g_ThunkCalls++;
+
+    const FAddParms* Params;
+    std::memcpy(&Params, static_cast<uint8_t*>(Frame) + Offsets::FFrame::Locals, sizeof(Params));
+    *static_cast<int32_t*>(Result) = Params->A + Params->B;
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+    Offsets::FFrame::UseLayout_4_25_To_5_0();
+
+    Fake::TFakeObject<UClass> Class;
+
+    Fake::FFakeFunction Function(sizeof(FAddParms));
+    Function.AddParam(offsetof(FAddParms, A), sizeof(int32_t), CPF_IsPlainOldData, CASTCLASS_FIntProperty);
+    Function.AddParam(offsetof(FAddParms, B), sizeof(int32_t), CPF_IsPlainOldData, CASTCLASS_FIntProperty);
+    Function.AddParam(offsetof(FAddParms, ReturnValue), sizeof(int32_t), CPF_IsPlainOldData | CPF_ReturnParm, CASTCLASS_FIntProperty);
+    Function.Get()->FunctionFlags = FUNC_Native;
+    Function.Get()->Func = AddThunk;
+    Function.Get()->Outer = Class.Get();
+
+    Fake::FFakeObject Object(AddProcessEvent);
+    Object.Get()->Class = Class.Get();
+
+    FAddParms Parms = { 1, 2, 0 };
+    Bench::Run("UObject::ProcessEvent", 10000000, [&]() {
+        Object.Get()->ProcessEvent(Function.Get(), &Parms);
+        Bench::DoNotOptimize(Parms);
+    });
+
+    Bench::Run("UObject::CallNative", 10000000, [&]() {
+        Object.Get()->CallNative(Function.Get(), &Parms);
+        Bench::DoNotOptimize(Parms);
+    });
+
+    static PECallWrapper<"Fake", "Add", int32_t(int32_t, int32_t)> Add;
+    int32_t Sum = 0;
+
+    Bench::Run("PECallWrapper::Call", 10000000, [&]() {
+        Sum = Add.Call(Object.Get(), Function.Get(), 1, 2);
+        Bench::DoNotOptimize(Sum);
+    });
+
+    Bench::Run("PECallWrapper::CallNative", 10000000, [&]() {
+        Sum = Add.CallNative(Object.Get(), Function.Get(), 1, 2);
+        Bench::DoNotOptimize(Sum);
+    });
+
+    // Both CallNative runs must have reached the thunk instead of falling back to ProcessEvent.
+    return Sum == 3 && g_ThunkCalls > 20000000 ? 0 : 1;
+}
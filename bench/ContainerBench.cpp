@@ -0,0 +1,135 @@
+#include <Bench.hpp>
+
+#include <uesdk/core/UnrealContainers.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+using namespace SDK;
+
+static constexpr int32_t kSizes[] = { 16, 1024, 65536 };
+
+static void BenchGrowth(int32_t Size)
+{
+    char Name[64];
+    // Add without a Reserve grows by 3 elements at a time, the biggest size takes a fraction of a second per iteration.
+    const size_t Iterations = Size >= 65536 ? 3 : 2000;
+
+    std::snprintf(Name, sizeof(Name), "TArray<int32_t>::Add x%d", Size);
+    Bench::Run(Name, Iterations, [Size]() {
+        TArray<int32_t> Array;
+        for (int32_t i = 0; i < Size; i++)
+            Array.Add(i);
+        Bench::DoNotOptimize(Array);
+    });
+
+    std::snprintf(Name, sizeof(Name), "TArray<int32_t>::Reserve + Add x%d", Size);
+    Bench::Run(Name, Iterations, [Size]() {
+        TArray<int32_t> Array;
+        Array.Reserve(Size);
+        for (int32_t i = 0; i < Size; i++)
+            Array.Add(i);
+        Bench::DoNotOptimize(Array);
+    });
+
+    std::snprintf(Name, sizeof(Name), "std::vector<int32_t>::push_back x%d", Size);
+    Bench::Run(Name, Iterations, [Size]() {
+        std::vector<int32_t> Vector;
+        for (int32_t i = 0; i < Size; i++)
+            Vector.push_back(i);
+        Bench::DoNotOptimize(Vector);
+    });
+}
+
+static void BenchCopy(int32_t Size)
+{
+    TArray<int32_t> Source;
+    Source.Reserve(Size);
+    for (int32_t i = 0; i < Size; i++)
+        Source.Add(i);
+
+    char Name[64];
+    const size_t Bytes = Size * sizeof(int32_t);
+
+    std::snprintf(Name, sizeof(Name), "TArray<int32_t> copy x%d", Size);
+    Bench::Run(Name, 20000, [&Source]() {
+        TArray<int32_t> Copy = Source;
+        Bench::DoNotOptimize(Copy);
+    }, Bytes);
+
+    TArray<int32_t> Target;
+    std::snprintf(Name, sizeof(Name), "TArray<int32_t>::CopyFrom, reused x%d", Size);
+    Bench::Run(Name, 20000, [&Source, &Target]() {
+        Target.CopyFrom(Source);
+        Bench::DoNotOptimize(Target);
+    }, Bytes);
+}
+
+static void BenchIteration(int32_t Size)
+{
+    TArray<int32_t> Array;
+    Array.Reserve(Size);
+    for (int32_t i = 0; i < Size; i++)
+        Array.Add(i);
+
+    char Name[64];
+    const size_t Bytes = Size * sizeof(int32_t);
+
+    std::snprintf(Name, sizeof(Name), "TArray<int32_t> range-for x%d", Size);
+    Bench::Run(Name, 20000, [&Array]() {
+        int64_t Sum = 0;
+        for (int32_t Value : Array)
+            Sum += Value;
+        Bench::DoNotOptimize(Sum);
+    }, Bytes);
+
+    std::snprintf(Name, sizeof(Name), "TArray<int32_t> operator[] x%d", Size);
+    Bench::Run(Name, 20000, [&Array]() {
+        int64_t Sum = 0;
+        for (int32_t i = 0; i < Array.Num(); i++)
+            Sum += Array[i];
+        Bench::DoNotOptimize(Sum);
+    }, Bytes);
+
+    std::snprintf(Name, sizeof(Name), "TArray<int32_t> GetData x%d", Size);
+    Bench::Run(Name, 20000, [&Array]() {
+        const int32_t* Data = Array.GetData();
+        Bench::DoNotOptimize(std::accumulate(Data, Data + Array.Num(), int64_t(0)));
+    }, Bytes);
+}
+
+static void BenchStrings()
+{
+    const FString Source(L"/Game/Maps/Persistent/Level.Level:PersistentLevel.BP_Character_C_2147482647");
+
+    Bench::Run("FString construct", 200000, []() {
+        FString String(L"/Game/Maps/Persistent/Level.Level:PersistentLevel.BP_Character_C_2147482647");
+        Bench::DoNotOptimize(String);
+    });
+
+    Bench::Run("FString copy", 200000, [&Source]() {
+        FString Copy = Source;
+        Bench::DoNotOptimize(Copy);
+    });
+
+    Bench::Run("FString::ToString", 200000, [&Source]() {
+        std::string String = Source.ToString();
+        Bench::DoNotOptimize(String);
+    });
+}
+
+int main()
+{
+    FMemory::SetBackend(FMemory::HostRealloc);
+
+    for (int32_t Size : kSizes)
+        BenchGrowth(Size);
+    for (int32_t Size : kSizes)
+        BenchCopy(Size);
+    for (int32_t Size : kSizes)
+        BenchIteration(Size);
+
+    BenchStrings();
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <Bench.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/State.hpp>
+#include <uesdk/core/UnrealContainers.hpp>
+#include <uesdk/helpers/ObjectDumper.hpp>
+
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <new>
+#include <string>
+
+using namespace SDK;
+
+static constexpr int32_t kNumActors = 20000;
+
+// Members of the fake actors, placed right after the UObject header.
+struct FActorMembers
+{
+    float Health;
+    int32_t Team;
+    bool bHidden;
+    FName Tag;
+    FString DisplayName;
+    float Location[3];
+    UObject* Owner;
+    TArray<int32_t> Scores;
+};
+
+static constexpr int32_t kMembersOffset = 0x30;
+
+static FActorMembers& GetMembers(UObject* Actor)
+{
+    return *reinterpret_cast<FActorMembers*>(reinterpret_cast<uint8_t*>(Actor) + kMembersOffset);
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+    Fake::SetupNames();
+    State::Setup = true;
+
+    Fake::FFakeObjectArray ObjectArray(kNumActors + 8);
+
+    static const char* const Components[] = { "X", "Y", "Z" };
+    Fake::FFakeClass Vector("Vector", nullptr, Fake::GetMetaClass("ScriptStruct", CASTCLASS_UField | CASTCLASS_UStruct | CASTCLASS_UScriptStruct));
+    for (int32_t i = 0; i < 3; i++)
+        Vector.AddProperty(Components[i], i * 4, sizeof(float), CPF_IsPlainOldData, CASTCLASS_FFloatProperty);
+    ObjectArray.Add(Vector.Get());
+
+    auto MemberOffset = [](size_t Offset) { return static_cast<int32_t>(kMembersOffset + Offset); };
+
+    Fake::FFakeClass Actor("Actor");
+    Actor.AddProperty("Health", MemberOffset(offsetof(FActorMembers, Health)), sizeof(float), CPF_IsPlainOldData, CASTCLASS_FFloatProperty);
+    Actor.AddProperty("Team", MemberOffset(offsetof(FActorMembers, Team)), sizeof(int32_t), CPF_IsPlainOldData, CASTCLASS_FIntProperty | CASTCLASS_FNumericProperty);
+    Actor.AddProperty("bHidden", MemberOffset(offsetof(FActorMembers, bHidden)), sizeof(bool), CPF_IsPlainOldData, CASTCLASS_FBoolProperty);
+    Actor.AddProperty("Tag", MemberOffset(offsetof(FActorMembers, Tag)), sizeof(FName), CPF_IsPlainOldData, CASTCLASS_FNameProperty);
+    Actor.AddProperty("DisplayName", MemberOffset(offsetof(FActorMembers, DisplayName)), sizeof(FString), 0, CASTCLASS_FStrProperty);
+    FProperty& Location = Actor.AddProperty("Location", MemberOffset(offsetof(FActorMembers, Location)), sizeof(float) * 3, CPF_IsPlainOldData, CASTCLASS_FStructProperty);
+    Fake::SetMember(&Location, Offsets::UStructProperty::Struct, Vector.Get());
+    Actor.AddProperty("Owner", MemberOffset(offsetof(FActorMembers, Owner)), sizeof(UObject*), CPF_IsPlainOldData, CASTCLASS_FObjectProperty);
+    FProperty& Scores = Actor.AddProperty("Scores", MemberOffset(offsetof(FActorMembers, Scores)), sizeof(TArray<int32_t>), 0, CASTCLASS_FArrayProperty);
+    Fake::SetMember(&Scores, Offsets::UArrayProperty::Inner, &Actor.MakeProperty(0, sizeof(int32_t), CPF_IsPlainOldData, CASTCLASS_FIntProperty | CASTCLASS_FNumericProperty));
+    ObjectArray.Add(Actor.Get());
+
+    Fake::FFakeClass Level("Level");
+    Fake::FFakeObject PersistentLevel;
+    PersistentLevel.Get()->Class = Level.Get();
+    PersistentLevel.Get()->Name = FName("PersistentLevel");
+    ObjectArray.Add(PersistentLevel.Get());
+
+    std::deque<Fake::FFakeObject> Actors;
+    UObject* Previous = nullptr;
+    for (int32_t i = 0; i < kNumActors; i++) {
+        UObject* Object = Actors.emplace_back().Get();
+        Object->Class = Actor.Get();
+        Object->Outer = PersistentLevel.Get();
+        Object->Name = FName("Actor_" + std::to_string(i));
+
+        const float Value = static_cast<float>(i);
+        FActorMembers& Members = *new (&GetMembers(Object)) FActorMembers { Value * 0.5f, i % 4, (i & 1) != 0, FName("Team" + std::to_string(i % 4)),
+            FString(L"Actor \"display\" name"), { Value, Value * 2.0f, 100.0f }, Previous, TArray<int32_t>() };
+        for (int32_t j = 0; j < 8; j++)
+            Members.Scores.Add(i * 8 + j);
+
+        ObjectArray.Add(Object);
+        Previous = Object;
+    }
+
+    const std::string Path = (std::filesystem::temp_directory_path() / "uesdk_dumper_bench.txt").string();
+
+    const FDumpStats First = DumpObjects(Path);
+    std::printf("DumpObjects: %llu objects, %llu properties, %.1f MB\n", static_cast<unsigned long long>(First.Objects),
+        static_cast<unsigned long long>(First.Properties), static_cast<double>(First.Bytes) / (1024.0 * 1024.0));
+
+    FDumpStats Stats;
+    Bench::Run("DumpObjects x20k actors", 10, [&]() {
+        Stats = DumpObjects(Path);
+    }, First.Bytes);
+    std::printf("DumpObjects reported %.1f MB/s\n", Stats.MBPerSecond);
+
+    std::filesystem::remove(Path);
+
+    for (Fake::FFakeObject& Object : Actors)
+        GetMembers(Object.Get()).~FActorMembers();
+
+    return Stats.Objects == First.Objects && Stats.Bytes == First.Bytes ? 0 : 1;
+}
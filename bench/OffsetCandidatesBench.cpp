@@ -0,0 +1,111 @@
+#include <Bench.hpp>
+
+#include <private/OffsetCandidates.hpp>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace SDK;
+using namespace SDK::Memory;
+
+static constexpr int32_t kMinOffset = 0x28;
+static constexpr int32_t kMaxOffset = 0x1A0;
+static constexpr int32_t kObjectSize = 0x200;
+static constexpr int32_t kValueOffset = 0x130;
+
+// The search FindOffset did before the solver, restarting from the first sample whenever a later one moves the offset up.
+template <int Alignement, typename T>
+static int32_t FindOffsetRestarting(const std::vector<std::pair<void*, T>>& ObjectValuePair)
+{
+    int32_t HighestFoundOffset = kMinOffset;
+
+    for (size_t i = 0; i < ObjectValuePair.size(); i++) {
+        const uint8_t* BytePtr = static_cast<const uint8_t*>(ObjectValuePair[i].first);
+
+        for (int32_t j = HighestFoundOffset; j < kMaxOffset; j += Alignement) {
+            T Value;
+            std::memcpy(&Value, BytePtr + j, sizeof(T));
+            if (Value == ObjectValuePair[i].second) {
+                if (j > HighestFoundOffset) {
+                    HighestFoundOffset = j;
+                    i = static_cast<size_t>(-1);
+                }
+                break;
+            }
+        }
+    }
+
+    return HighestFoundOffset;
+}
+
+// Every aligned offset checked against every sample, the straightforward way to get all candidates.
+template <int Alignement, typename T>
+static int32_t FindOffsetScalar(const std::vector<std::pair<void*, T>>& ObjectValuePair)
+{
+    for (int32_t j = kMinOffset; j < kMaxOffset; j += Alignement) {
+        bool All = true;
+        for (const auto& [Object, Expected] : ObjectValuePair) {
+            T Value;
+            std::memcpy(&Value, static_cast<const uint8_t*>(Object) + j, sizeof(T));
+            if (Value != Expected) {
+                All = false;
+                break;
+            }
+        }
+        if (All)
+            return j;
+    }
+
+    return OFFSET_NOT_FOUND;
+}
+
+// Objects full of small numbers, so the values also show up at wrong offsets and the searches can't stop at the first hit.
+template <typename T>
+static void RunSamples(const char* Name, int32_t NumSamples, size_t Iterations)
+{
+    std::mt19937 Random(0xBE9C);
+    std::vector<std::vector<uint8_t>> Objects(NumSamples, std::vector<uint8_t>(kObjectSize));
+    std::vector<std::pair<void*, T>> Pairs;
+
+    for (int32_t i = 0; i < NumSamples; i++) {
+        for (size_t j = 0; j < kObjectSize; j += sizeof(T)) {
+            const T Value = static_cast<T>(Random() % 8);
+            std::memcpy(Objects[i].data() + j, &Value, sizeof(T));
+        }
+
+        const T Value = static_cast<T>(Random() % 8);
+        std::memcpy(Objects[i].data() + kValueOffset, &Value, sizeof(T));
+        Pairs.push_back({ Objects[i].data(), Value });
+    }
+
+    if (FindOffsetRestarting<sizeof(T)>(Pairs) != kValueOffset || FindOffsetScalar<sizeof(T)>(Pairs) != kValueOffset || FindOffset<sizeof(T)>(Pairs) != kValueOffset)
+        std::printf("%s: searches disagree\n", Name);
+
+    std::printf("%s\n", Name);
+    Bench::Run("  restarting search (old FindOffset)", Iterations, [&]() {
+        Bench::DoNotOptimize(FindOffsetRestarting<sizeof(T)>(Pairs));
+    });
+    Bench::Run("  scalar search over all offsets", Iterations, [&]() {
+        Bench::DoNotOptimize(FindOffsetScalar<sizeof(T)>(Pairs));
+    });
+    Bench::Run("  FindOffsetCandidates", Iterations, [&]() {
+        Bench::DoNotOptimize(FindOffsetCandidates<sizeof(T)>(Pairs));
+    });
+
+    // A last sample holding its value nowhere, the candidates then come from matching every sample everywhere.
+    std::vector<uint8_t> Empty(kObjectSize, 0xFF);
+    Pairs.push_back({ Empty.data(), T(1) });
+    Bench::Run("  FindOffsetCandidates, no common offset", Iterations, [&]() {
+        Bench::DoNotOptimize(FindOffsetCandidates<sizeof(T)>(Pairs));
+    });
+}
+
+int main()
+{
+    RunSamples<int32_t>("int32 x8 samples", 8, 20000);
+    RunSamples<int32_t>("int32 x1000 samples", 1000, 200);
+    RunSamples<uint64_t>("uint64 x1000 samples", 1000, 200);
+    RunSamples<uint8_t>("uint8 x1000 samples", 1000, 200);
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <Bench.hpp>
+
+#include <private/RegionMap.hpp>
+
+#include <random>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+using namespace SDK::Memory;
+
+static constexpr size_t kNumProbes = 4096;
+
+// What a probe cost before the map, one query of the OS per address.
+static bool IsReadableByOS(const void* Address)
+{
+#ifdef _WIN32
+    MEMORY_BASIC_INFORMATION Mbi;
+    return VirtualQuery(Address, &Mbi, sizeof(Mbi)) && Mbi.State == MEM_COMMIT && !(Mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS));
+#else
+    // Linux has no VirtualQuery, reading the byte through the kernel is the usual way to test an address without faulting.
+    uint8_t Byte;
+    iovec Local = { &Byte, 1 };
+    iovec Remote = { const_cast<void*>(Address), 1 };
+    return process_vm_readv(getpid(), &Local, 1, &Remote, 1, 0) == 1;
+#endif
+}
+
+int main()
+{
+    FRegionMap& Map = FRegionMap::Get();
+    const std::vector<FRegion> Regions = Map.GetRegions();
+    std::printf("%zu regions\n", Regions.size());
+
+    // Addresses spread over every readable region, like the pointers GetValidPointerOffset probes.
+    std::mt19937_64 Random(0x4E61);
+    std::vector<const void*> Probes;
+    while (Probes.size() < kNumProbes) {
+        const FRegion& Region = Regions[Random() % Regions.size()];
+        if (Region.Access & Region_Read)
+            Probes.push_back(reinterpret_cast<const void*>(Region.Begin + Random() % (Region.End - Region.Begin)));
+    }
+
+    Bench::Run("OS query per probe x4096", 20, [&]() {
+        size_t Readable = 0;
+        for (const void* Probe : Probes)
+            Readable += IsReadableByOS(Probe);
+        Bench::DoNotOptimize(Readable);
+    });
+
+    Bench::Run("FRegionMap::IsReadable x4096", 2000, [&]() {
+        size_t Readable = 0;
+        for (const void* Probe : Probes)
+            Readable += Map.IsReadable(Probe, 8);
+        Bench::DoNotOptimize(Readable);
+    });
+
+    // Misses within the refresh interval are answered from the snapshot as well.
+    Map.Refresh();
+    Bench::Run("FRegionMap::IsReadable miss", 100000, [&]() {
+        Bench::DoNotOptimize(Map.IsReadable(reinterpret_cast<const void*>(8)));
+    });
+
+    Bench::Run("FRegionMap::Refresh", 200, [&]() {
+        Map.Refresh();
+    });
+
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <Bench.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/State.hpp>
+#include <uesdk/core/UnrealContainers.hpp>
+#include <uesdk/helpers/StructSerializer.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+using namespace SDK;
+
+static constexpr int32_t kNumTransforms = 100000;
+
+// Layout of the engine's FTransform with single precision floats, the vectors are padded to 16 bytes.
+struct alignas(16) FTransform
+{
+    float Rotation[4];
+    float Translation[3];
+    float Pad0;
+    float Scale3D[3];
+    float Pad1;
+};
+
+static bool SameTransforms(const FTransform* A, const FTransform* B, int32_t Count)
+{
+    for (int32_t i = 0; i < Count; i++) {
+        if (std::memcmp(A[i].Rotation, B[i].Rotation, sizeof(float) * 7) != 0 || std::memcmp(A[i].Scale3D, B[i].Scale3D, sizeof(float) * 3) != 0)
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+    Fake::SetupNames();
+    State::Setup = true;
+
+    static const char* const Components[] = { "X", "Y", "Z", "W" };
+    UClass* ScriptStructClass = Fake::GetMetaClass("ScriptStruct", CASTCLASS_UField | CASTCLASS_UStruct | CASTCLASS_UScriptStruct);
+
+    Fake::FFakeClass Quat("Quat", nullptr, ScriptStructClass);
+    Quat.Get()->PropertiesSize = 16;
+    Quat.Get()->MinAlignment = 16;
+    for (int32_t i = 0; i < 4; i++)
+        Quat.AddProperty(Components[i], i * 4, sizeof(float), CPF_IsPlainOldData, CASTCLASS_FFloatProperty);
+
+    Fake::FFakeClass Vector("Vector", nullptr, ScriptStructClass);
+    Vector.Get()->PropertiesSize = 12;
+    Vector.Get()->MinAlignment = 4;
+    for (int32_t i = 0; i < 3; i++)
+        Vector.AddProperty(Components[i], i * 4, sizeof(float), CPF_IsPlainOldData, CASTCLASS_FFloatProperty);
+
+    // The padding after each vector is copied along, so the plan is a single copy and arrays of transforms one memcpy.
+    Fake::FFakeClass Transform("Transform", nullptr, ScriptStructClass);
+    Transform.Get()->PropertiesSize = sizeof(FTransform);
+    Transform.Get()->MinAlignment = alignof(FTransform);
+    Fake::SetMember(&Transform.AddProperty("Rotation", offsetof(FTransform, Rotation), 16, CPF_IsPlainOldData, CASTCLASS_FStructProperty), Offsets::UStructProperty::Struct, Quat.Get());
+    Fake::SetMember(&Transform.AddProperty("Translation", offsetof(FTransform, Translation), 12, CPF_IsPlainOldData, CASTCLASS_FStructProperty), Offsets::UStructProperty::Struct, Vector.Get());
+    Fake::SetMember(&Transform.AddProperty("Scale3D", offsetof(FTransform, Scale3D), 12, CPF_IsPlainOldData, CASTCLASS_FStructProperty), Offsets::UStructProperty::Struct, Vector.Get());
+
+    // A struct holding TArray<FTransform>. The inner property isn't plain old data, so elements are written with the FTransform plan.
+    Fake::FFakeClass TransformList("TransformList", nullptr, ScriptStructClass);
+    TransformList.Get()->PropertiesSize = sizeof(TArray<FTransform>);
+    TransformList.Get()->MinAlignment = alignof(TArray<FTransform>);
+    FProperty& Inner = TransformList.MakeProperty(0, sizeof(FTransform), 0, CASTCLASS_FStructProperty);
+    Fake::SetMember(&Inner, Offsets::UStructProperty::Struct, Transform.Get());
+    Fake::SetMember(&TransformList.AddProperty("Transforms", 0, sizeof(TArray<FTransform>), 0, CASTCLASS_FArrayProperty), Offsets::UArrayProperty::Inner, &Inner);
+
+    std::vector<FTransform> Transforms(kNumTransforms);
+    TArray<FTransform> TransformArray;
+    for (int32_t i = 0; i < kNumTransforms; i++) {
+        const float Value = static_cast<float>(i);
+        Transforms[i] = { { 0.0f, 0.0f, Value, 1.0f }, { Value, Value * 2.0f, Value * 3.0f }, 0.0f, { 1.0f, 1.0f, 1.0f }, 0.0f };
+        TransformArray.Add(Transforms[i]);
+    }
+
+    const FStructSerializer TransformSerializer(Transform.Get());
+    const FStructSerializer ListSerializer(TransformList.Get());
+    std::printf("FTransform plan: %zu ops\n", TransformSerializer.GetPlans()[0].Ops.size());
+
+    constexpr size_t kBytes = sizeof(FTransform) * kNumTransforms;
+    std::vector<FTransform> Copy(kNumTransforms);
+    std::vector<uint8_t> Stream;
+    std::vector<uint8_t> ListStream;
+    TArray<FTransform> ReadArray;
+
+    Bench::Run("memcpy x100k FTransform", 200, [&]() {
+        std::memcpy(Copy.data(), Transforms.data(), kBytes);
+        Bench::DoNotOptimize(Copy);
+    }, kBytes);
+
+    Bench::Run("SerializeMany x100k FTransform", 200, [&]() {
+        Stream.clear();
+        TransformSerializer.SerializeMany(Transforms.data(), kNumTransforms, Stream);
+        Bench::DoNotOptimize(Stream);
+    }, kBytes);
+
+    Bench::Run("DeserializeMany x100k FTransform", 200, [&]() {
+        TransformSerializer.DeserializeMany(Copy.data(), kNumTransforms, Stream);
+        Bench::DoNotOptimize(Copy);
+    }, kBytes);
+
+    Bench::Run("Serialize TArray<FTransform> x100k", 200, [&]() {
+        ListStream.clear();
+        ListSerializer.Serialize(&TransformArray, ListStream);
+        Bench::DoNotOptimize(ListStream);
+    }, kBytes);
+
+    Bench::Run("Deserialize TArray<FTransform> x100k", 200, [&]() {
+        ListSerializer.Deserialize(&ReadArray, ListStream);
+        Bench::DoNotOptimize(ReadArray);
+    }, kBytes);
+
+    const bool RoundTripped = SameTransforms(Copy.data(), Transforms.data(), kNumTransforms) && ReadArray.Num() == kNumTransforms
+        && SameTransforms(&ReadArray[0], Transforms.data(), kNumTransforms);
+    return RoundTripped ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+#include <Bench.hpp>
+
+#include <uesdk/helpers/StreamingWriter.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace SDK;
+
+static constexpr size_t kTotalBytes = 64 << 20;
+static constexpr size_t kLineSize = 64;
+static constexpr int32_t kNumLines = 1 << 20;
+
+int main()
+{
+    const std::string Path = (std::filesystem::temp_directory_path() / "uesdk_streamingwriter_bench.txt").string();
+
+    std::vector<char> Data(kTotalBytes, 'x');
+    for (size_t i = kLineSize - 1; i < kTotalBytes; i += kLineSize)
+        Data[i] = '\n';
+
+    // What the disk takes at best, one fwrite of everything.
+    Bench::Run("fwrite 64 MB", 5, [&]() {
+        std::FILE* File = std::fopen(Path.c_str(), "wb");
+        std::fwrite(Data.data(), 1, Data.size(), File);
+        std::fclose(File);
+    }, kTotalBytes);
+
+    Bench::Run("FStreamingWriter::Write 64 MB in 64 byte lines", 5, [&]() {
+        FStreamingWriter Writer(Path);
+        for (size_t i = 0; i < kTotalBytes; i += kLineSize)
+            Writer.Write(Data.data() + i, kLineSize);
+        Writer.Close();
+    }, kTotalBytes);
+
+    // The dumper's pattern, short literals and numbers.
+    auto WriteFormatted = [&]() {
+        FStreamingWriter Writer(Path);
+        for (int32_t i = 0; i < kNumLines; i++) {
+            Writer.Write("\tHealth = ");
+            Writer.WriteFloat(i * 0.25);
+            Writer.Write("\tTeam = ");
+            Writer.WriteInt(i % 4);
+            Writer.Write('\n');
+        }
+        Writer.Close();
+        return Writer.GetBytesWritten();
+    };
+
+    Bench::Run("FStreamingWriter formatted x1M lines", 5, WriteFormatted, WriteFormatted());
+
+    std::filesystem::remove(Path);
+    return 0;
+}
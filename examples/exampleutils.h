@@ -1,19 +1,9 @@
 #pragma once
 #include <uesdk.hpp>
 
-#include <sstream>
-#include <fstream>
+#include <iostream>
 #include <stdexcept>
-
-// File-Utils
-//
-void WriteSSToFile(const std::string& FilePath, const std::stringstream& ss) {
-    std::ofstream OutFile(FilePath);
-    if (!OutFile.is_open())
-        throw std::ios_base::failure("Failed to open file: " + FilePath);
-
-    OutFile << ss.rdbuf();
-}
+#include <vector>
 
 // Unreal-Engine
 //
@@ -9,14 +9,14 @@ namespace ListActors
 {
     void Example()
     {
-        // Create output stringstream
-        std::stringstream ss;
-
         // Get a pointer to the UClass for AActor.
         SDK::UClass* ActorClass = nullptr;
         if (!FastSearchSingle(FSUClass("Actor", &ActorClass)))
             return;
 
+        // Collect every actor first, so the location of all of them can be read in one batch.
+        std::vector<SDK::UObject*> Actors;
+
         // Loop through every UObject.
         for (int i = 0; i < SDK::GObjects->Num(); i++) {
             SDK::UObject* Obj = SDK::GObjects->GetByIndex(i);
@@ -25,17 +25,33 @@ namespace ListActors
             if (!Obj || Obj->IsDefaultObject() || !Obj->IsA(ActorClass))
                 continue;
 
-            // Use PECallWrapper to call the UFunction, this way the library will automatically setup the parameters struct for you.
-            static SDK::PECallWrapper<"Actor", "K2_GetActorLocation", FVector()> K2_GetActorLocation;
+            Actors.push_back(Obj);
+        }
+
+        // Use PECallWrapper to call the UFunction, this way the library will automatically setup the parameters struct for you.
+        // CallBatchAuto calls it on every actor, reusing the same parameters struct and writing one result per actor.
+        static SDK::PECallWrapper<"Actor", "K2_GetActorLocation", FVector()> K2_GetActorLocation;
+
+        std::vector<FVector> ActorPositions(Actors.size());
+        K2_GetActorLocation.CallBatchAuto(Actors, ActorPositions.data());
+
+        // Write the output through a streaming writer, it's flushed to disk on a separate thread while the next lines are formatted.
+        SDK::FStreamingWriter Writer("ListActors");
 
-            FVector ActorPos = K2_GetActorLocation.CallAuto(Obj);
-            std::string ActorName = Obj->Name.ToString();
+        for (size_t i = 0; i < Actors.size(); i++) {
+            const FVector& ActorPos = ActorPositions[i];
 
             // Output the actor name and position.
-            ss << ActorName << '\n';
-            ss << "X: " << ActorPos.X << " Y: " << ActorPos.Y << " Z: " << ActorPos.Z << "\n";
+            Writer.Write(Actors[i]->Name.ToString());
+            Writer.Write("\nX: ");
+            Writer.WriteFloat(ActorPos.X);
+            Writer.Write(" Y: ");
+            Writer.WriteFloat(ActorPos.Y);
+            Writer.Write(" Z: ");
+            Writer.WriteFloat(ActorPos.Z);
+            Writer.Write('\n');
         }
 
-        WriteSSToFile("ListActors", ss);
+        Writer.Close();
     }
 }
@@ -9,6 +9,11 @@ namespace ListProperties
 {
     void Example()
     {
-        // TODO: Add property itterators that support FProperty and non FProperty
+        // DumpObjects walks every UObject and writes its class, full name and property values through a double-buffered writer,
+        // so the dump uses the same amount of memory no matter how many objects the game has loaded.
+        SDK::FDumpStats Stats = SDK::DumpObjects("ListProperties");
+
+        std::cout << "Dumped " << Stats.Objects << " objects and " << Stats.Properties << " properties (" << Stats.Bytes << " bytes) at "
+                  << Stats.MBPerSecond << " MB/s\n";
     }
 }
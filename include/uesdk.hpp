@@ -1,4 +1,6 @@
 #pragma once
+#include <uesdk/Init.hpp>
+#include <uesdk/SetupReport.hpp>
 #include <uesdk/State.hpp>
 #include <uesdk/Status.hpp>
 #include <uesdk/core/Cast.hpp>
@@ -7,9 +9,22 @@
 #include <uesdk/core/UnrealContainers.hpp>
 #include <uesdk/core/UnrealEnums.hpp>
 #include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/CallProfiler.hpp>
+#include <uesdk/helpers/DataTableSnapshot.hpp>
+#include <uesdk/helpers/DynamicCall.hpp>
 #include <uesdk/helpers/FastSearch.hpp>
+#include <uesdk/helpers/FunctionLayout.hpp>
+#include <uesdk/helpers/GameThreadCallQueue.hpp>
+#include <uesdk/helpers/ObjectDumper.hpp>
 #include <uesdk/helpers/PECallWrapper.hpp>
+#include <uesdk/helpers/PropertyGather.hpp>
+#include <uesdk/helpers/PropertySnapshot.hpp>
 #include <uesdk/helpers/ReflectionMacros.hpp>
+#include <uesdk/helpers/ReflectionRegistry.hpp>
+#include <uesdk/helpers/ReflectionSnapshot.hpp>
+#include <uesdk/helpers/StreamingWriter.hpp>
+#include <uesdk/helpers/StructSerializer.hpp>
+#include <uesdk/helpers/Task.hpp>
 
 namespace SDK
 {
@@ -22,10 +37,4 @@ namespace SDK
     typedef uint16_t uint16;
     typedef uint32_t uint32;
     typedef uint64_t uint64;
-
-    /**
-     * @brief Initiates the core SDK. Should be called before any other interaction with the library.
-     * @return SDK::Status result. Should be compared with SDK::Status::Success.
-     */
-    ESDKStatus Init();
 }
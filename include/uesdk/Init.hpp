@@ -0,0 +1,68 @@
+#pragma once
+#include <uesdk/Status.hpp>
+
+#include <cstdint>
+#include <future>
+
+namespace SDK
+{
+    /** @brief Parts of the core SDK that can be set up on their own with EnsureInitialized, in the order Init sets them up. */
+    enum class ESDKComponent : uint8_t
+    {
+        FMemory,
+        GObjects,
+        // The FName constructors and AppendString. Requires FMemory.
+        FName,
+        // Requires FMemory, GObjects and FName.
+        MemberOffsets,
+        // The VFT index of UObject::ProcessEvent. Requires GObjects and MemberOffsets.
+        ProcessEvent,
+
+        Count
+    };
+
+    struct FInitProgress
+    {
+        // Components that were set up successfully.
+        uint32_t ComponentsDone = 0;
+        uint32_t Components = static_cast<uint32_t>(ESDKComponent::Count);
+
+        // Member offset finder steps that finished. Steps stays 0 until the member offsets start, see GetSetupReport.
+        uint32_t StepsDone = 0;
+        uint32_t Steps = 0;
+    };
+
+    /**
+     * @brief Initiates the core SDK. Should be called before any other interaction with the library.
+     * @brief Member offsets are found concurrently where their finders don't depend on each other, see GetSetupReport for their timings.
+     * @brief Components already set up through EnsureInitialized or InitAsync aren't set up again.
+     * @return SDK::Status result. Should be compared with SDK::Status::Success.
+     */
+    ESDKStatus Init();
+
+    /**
+     * @brief Runs Init on a background thread and returns right away. Calling it again returns the same future, unless that one finished with a failure.
+     * @brief Components can be demanded with EnsureInitialized in the meantime, see GetInitProgress for how far it got.
+     * @return The future status of Init.
+     */
+    std::shared_future<ESDKStatus> InitAsync();
+
+    /** @brief Can be polled from any thread while Init, InitAsync or EnsureInitialized run. */
+    FInitProgress GetInitProgress();
+
+    /**
+     * @brief Sets up Component and the components it requires on the calling thread, unless that already happened.
+     * @brief If the background thread of InitAsync, or another thread, is setting one of them up, waits for it instead.
+     * @brief Tools that only need e.g. GObjects and FName don't wait for the member offsets. Components that failed are tried again by the next call.
+     * @brief Once Component is set up, the remaining components continue in the background through InitAsync, unless ContinueInBackground is false.
+     *
+     * @brief State flags of components set up on another thread should only be read once this returned for them.
+     *
+     * @param[in] Component - Component to set up.
+     * @param[in] ContinueInBackground - If InitAsync should be started for the rest. Without it, only demanded components are ever set up.
+     * @return ESDKStatus::Success, or the failure of Component or of a component it requires.
+     *
+     * @throws std::invalid_argument - If Component is ESDKComponent::Count.
+     */
+    ESDKStatus EnsureInitialized(ESDKComponent Component, bool ContinueInBackground = true);
+}
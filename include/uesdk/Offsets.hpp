@@ -53,6 +53,19 @@ namespace SDK::Offsets
 
         inline Offset_t Base = OFFSET_NOT_FOUND;
     }
+    // The inner type members below are found for both UProperty and FProperty. They're optional, Init doesn't fail without them.
+    namespace UStructProperty
+    {
+        inline Offset_t Struct = OFFSET_NOT_FOUND;
+    }
+    namespace UArrayProperty
+    {
+        inline Offset_t Inner = OFFSET_NOT_FOUND;
+    }
+    namespace UEnumProperty
+    {
+        inline Offset_t UnderlyingProp = OFFSET_NOT_FOUND;
+    }
     namespace UEnum
     {
         inline Offset_t Names = OFFSET_NOT_FOUND;
@@ -65,6 +78,32 @@ namespace SDK::Offsets
         inline Offset_t ReturnValueOffset = OFFSET_NOT_FOUND;
         inline Offset_t Func = OFFSET_NOT_FOUND;
     }
+    namespace FFrame
+    {
+        // Not searched for, and the layout changes between engine versions, so UObject::CallNative stays disabled
+        // (falls back to ProcessEvent) until every member below is set. UseLayout_4_25_To_5_0 sets the known x64 layout.
+        inline Offset_t Node = OFFSET_NOT_FOUND;
+        inline Offset_t Object = OFFSET_NOT_FOUND;
+        inline Offset_t Code = OFFSET_NOT_FOUND;
+        inline Offset_t Locals = OFFSET_NOT_FOUND;
+        inline Offset_t OutParms = OFFSET_NOT_FOUND;
+        inline Offset_t PropertyChainForCompiledIn = OFFSET_NOT_FOUND;
+        inline Offset_t CurrentNativeFunction = OFFSET_NOT_FOUND;
+        inline Offset_t Size = OFFSET_NOT_FOUND;
+
+        /** @brief Opts in to UObject::CallNative with the x64 FFrame layout of 4.25 up to 5.0. Later engines add members after Locals, don't use it on those. */
+        inline void UseLayout_4_25_To_5_0()
+        {
+            Node = 0x10;
+            Object = 0x18;
+            Code = 0x20;
+            Locals = 0x28;
+            OutParms = 0x78;
+            PropertyChainForCompiledIn = 0x80;
+            CurrentNativeFunction = 0x88;
+            Size = 0x98;
+        }
+    }
     namespace UDataTable
     {
         inline Offset_t RowStruct = OFFSET_NOT_FOUND;
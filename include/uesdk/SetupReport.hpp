@@ -0,0 +1,50 @@
+#pragma once
+#include <uesdk/Status.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SDK
+{
+    /** @brief One member offset finder or FastSearch pass run by Init. */
+    struct FSetupStep
+    {
+        std::string Name;
+        // Names of the steps whose outputs this step reads.
+        std::vector<std::string> Inputs;
+
+        ESDKStatus Status = ESDKStatus::Success;
+        // False if the step doesn't apply to this engine version, or wasn't reached because an earlier step failed.
+        bool Ran = false;
+
+        // Offsets the step's last sample search found, lowest first. More than one means the samples were ambiguous and the lowest one was used.
+        std::vector<int32_t> Candidates;
+        // Share of the samples agreeing on the used offset, divided by the number of candidates. 1 if exactly one offset matched every sample.
+        double Confidence = 0.0;
+
+        double StartMs = 0.0;
+        double DurationMs = 0.0;
+        uint32_t Thread = 0;
+    };
+
+    /** @brief Timings of the member offset setup, the steps run concurrently wherever their inputs allow it. */
+    struct FSetupReport
+    {
+        // In declaration order, which is also the order they'd run in on a single thread.
+        std::vector<FSetupStep> Steps;
+        // Indices into Steps of the chain of dependent steps that took the longest, first step first.
+        std::vector<size_t> CriticalPath;
+
+        uint32_t Threads = 0;
+        double WallMs = 0.0;
+        double WorkMs = 0.0;
+        double CriticalPathMs = 0.0;
+    };
+
+    /** @return The report of the last Init call, empty if Init didn't get to the member offsets. */
+    const FSetupReport& GetSetupReport();
+
+    /** @brief Formats GetSetupReport as text, one line per step followed by the critical path. */
+    std::string DumpSetupReport();
+}
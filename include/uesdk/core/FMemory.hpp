@@ -1,9 +1,109 @@
 #pragma once
 #include <cstdint>
+#include <string>
+#include <vector>
 
 namespace SDK::FMemory
 {
-    void Free(void* Original);
-    [[nodiscard]] void* Malloc(uint32_t Size, uint32_t Alignment);
-    [[nodiscard]] void* Realloc(void* Original, uint32_t Size, uint32_t Alignment);
+    /** @brief Call-site tags used by the allocation statistics. Only recorded when built with UESDK_FMEMORY_STATS. */
+    enum class EAllocSite : uint8_t
+    {
+        Unknown = 0,
+
+        TArrayConstruct,
+        TArrayReserve,
+        TArrayCopy,
+        TArrayScratch,
+        TArrayFree,
+
+        InlineFitAllocation,
+        InlineFree,
+
+        FStringConstruct,
+
+        StructDeserialize,
+        StructDeserializeFree,
+
+        Num,
+    };
+
+    /** @brief Allocation statistics of a single call site, summed over every thread. */
+    struct FAllocSiteStats
+    {
+        EAllocSite Site = EAllocSite::Unknown;
+        const char* SiteName = "";
+
+        uint64_t Mallocs = 0;
+        uint64_t Reallocs = 0; // Reallocs of an existing allocation, each one is a step in a growth chain.
+        uint64_t Frees = 0;
+        uint64_t BytesRequested = 0;
+        uint64_t ScratchHits = 0; // Calls served by the per-thread scratch slabs instead of the backend.
+
+        // Growth chain lengths (reallocs per allocation) at the time the allocation was freed.
+        // Buckets are 0, 1, 2, 3-4, 5-8 and 9+.
+        uint64_t ChainLengths[6] = {};
+        uint64_t MaxChainLength = 0;
+    };
+
+    /** @return If the library was built with UESDK_FMEMORY_STATS. */
+    bool AreStatsEnabled();
+
+    /** @brief Sums the per-thread counters of every call site. Empty if stats are disabled. */
+    std::vector<FAllocSiteStats> GetStats();
+
+    /** @brief Formats GetStats as CSV, one row per call site. */
+    std::string DumpStats();
+
+    /** @brief Resets the counters of every thread. Counters updated concurrently may be partially kept. */
+    void ResetStats();
+
+    /**
+     * @brief Signature shared by every FMemory backend, matching the engine's FMemory::Realloc.
+     * @brief A nullptr Original allocates, a Size of 0 frees and returns nullptr, an Alignment of 0 uses the default alignment.
+     */
+    using ReallocFunc = void* (*)(void* Original, uint32_t Size, uint32_t Alignment);
+
+    /**
+     * @brief Sets the backend used by every SDK container allocation.
+     * @brief Must be set before any container allocates, memory is never migrated between backends.
+     *
+     * @param[in] Backend - The new backend, or nullptr to use the engine's FMemory::Realloc.
+     */
+    void SetBackend(ReallocFunc Backend);
+
+    /** @return The current backend, or nullptr if the engine's FMemory::Realloc is used. */
+    ReallocFunc GetBackend();
+
+    /**
+     * @brief Host allocator with the same size and alignment contract as the engine's FMemory::Realloc.
+     * @brief Allows containers to be used outside of a live game, i.e. for tests and benchmarks.
+     */
+    [[nodiscard]] void* HostRealloc(void* Original, uint32_t Size, uint32_t Alignment);
+
+    /**
+     * @brief Enables or disables the per-thread scratch allocator. Disabled by default.
+     * @brief Memory already handed out stays valid and is still released correctly after disabling.
+     */
+    void SetScratchEnabled(bool Enabled);
+
+    /** @return If MallocScratch serves allocations from the per-thread slabs. */
+    bool IsScratchEnabled();
+
+    /**
+     * @brief Allocates from the calling thread's scratch slabs, keeping short-lived SDK temporaries away from the engine allocator.
+     * @brief Falls back to Malloc if scratch is disabled, the slabs are exhausted, or the request is larger than the biggest slab block.
+     * @brief Free and Realloc recognise scratch memory. Growing a scratch allocation past its block moves it to the backend.
+     *
+     * @brief Ownership rule: scratch memory must only back SDK-side temporaries which the engine reads at most.
+     * @brief It must never be handed to engine code that may grow or free it (out parameters, UObject members, return values),
+     * @brief and must be freed on the thread that allocated it.
+     */
+    [[nodiscard]] void* MallocScratch(uint32_t Size, uint32_t Alignment, EAllocSite Site = EAllocSite::Unknown);
+
+    /** @return If Ptr was allocated by MallocScratch on the calling thread. */
+    bool IsScratch(const void* Ptr);
+
+    void Free(void* Original, EAllocSite Site = EAllocSite::Unknown);
+    [[nodiscard]] void* Malloc(uint32_t Size, uint32_t Alignment, EAllocSite Site = EAllocSite::Unknown);
+    [[nodiscard]] void* Realloc(void* Original, uint32_t Size, uint32_t Alignment, EAllocSite Site = EAllocSite::Unknown);
 }
@@ -41,6 +41,7 @@ namespace SDK
         inline FUObjectItem** GetDecrytedObjPtr() const { return reinterpret_cast<FUObjectItem**>(DecryptPtr(Objects)); }
 
         class UObject* GetByIndex(const int32_t Index) const;
+        FUObjectItem* GetItemByIndex(const int32_t Index) const;
     };
     class Fixed_TUObjectArray
     {
@@ -59,6 +60,7 @@ namespace SDK
         inline FUObjectItem* GetDecrytedObjPtr() const { return reinterpret_cast<FUObjectItem*>(DecryptPtr(Objects)); }
 
         class UObject* GetByIndex(const int32_t Index) const;
+        FUObjectItem* GetItemByIndex(const int32_t Index) const;
     };
 
     /** @brief Wrapper to support both chunked and fixed GObjects. */
@@ -81,6 +83,9 @@ namespace SDK
         /** @brief Returns UObject in object array by index. */
         class UObject* GetByIndex(int32_t Index);
 
+        /** @brief Returns the object array item by index, its SerialNumber tells a reused index apart. nullptr if out of range. */
+        FUObjectItem* GetItemByIndex(int32_t Index);
+
     public:
         /**
          * @brief Finds a UObject in GObjects based off of it's full name, in the Dumper-7 style path.
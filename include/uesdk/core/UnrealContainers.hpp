@@ -1,7 +1,12 @@
 #pragma once
 #include <uesdk/core/FMemory.hpp>
 
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
 #include <ostream>
+#include <stdexcept>
+#include <string>
 
 // Thanks to https://github.com/Fischsalat/UnrealContainers for proper TArray, FString and TArrayIterator support.
 
@@ -153,14 +158,15 @@ namespace SDK
                     if (NewNumElements <= NumInlineElements) {
                         if (OldNumElements > NumInlineElements && SecondaryData) {
                             memcpy(InlineData, SecondaryData, InlineDataSizeBytes);
-                            FMemory::Free(SecondaryData);
+                            FMemory::Free(SecondaryData, FMemory::EAllocSite::InlineFitAllocation);
+                            SecondaryData = nullptr;
                         }
 
                         return;
                     }
 
                     /* Allocates if SecondaryData is nullptr */
-                    SecondaryData = reinterpret_cast<ElementType*>(FMemory::Realloc(SecondaryData, NewNumElements * ElementSize, ElementAlign));
+                    SecondaryData = reinterpret_cast<ElementType*>(FMemory::Realloc(SecondaryData, NewNumElements * ElementSize, ElementAlign, FMemory::EAllocSite::InlineFitAllocation));
 
                     if (OldNumElements < NumInlineElements)
                         memcpy(SecondaryData, InlineData, InlineDataSizeBytes);
@@ -182,8 +188,9 @@ namespace SDK
                 inline void Free()
                 {
                     if (SecondaryData)
-                        FMemory::Free(SecondaryData);
+                        FMemory::Free(SecondaryData, FMemory::EAllocSite::InlineFree);
 
+                    SecondaryData = nullptr;
                     memset(InlineData, 0x0, InlineDataSizeBytes);
                 }
 
@@ -293,7 +300,7 @@ namespace SDK
         {
         private:
             template <typename SetDataType>
-            friend class TSet;
+            friend class SDK::TSet;
 
         private:
             SetType Value;
@@ -324,6 +331,10 @@ namespace SDK
         inline const ValueType& Value() const { return Second; }
     };
 
+    // Ownership rule for container memory:
+    // Anything the engine may grow, shrink or free (out parameters, UObject members, values returned to the engine) must be allocated with FMemory::Malloc/Realloc.
+    // Per-thread scratch memory (TArray::ReserveScratch, FString::Scratch) is only for SDK-side temporaries that the engine reads at most, freed on the allocating thread.
+
     template <typename ArrayElementType>
     class TArray
     {
@@ -349,7 +360,7 @@ namespace SDK
         }
 
         TArray(int32_t Size)
-            : Data(static_cast<ArrayElementType*>(FMemory::Malloc(Size * ElementSize, ElementAlign)))
+            : Data(static_cast<ArrayElementType*>(FMemory::Malloc(Size * ElementSize, ElementAlign, FMemory::EAllocSite::TArrayConstruct)))
             , NumElements(0)
             , MaxElements(Size)
         {
@@ -422,7 +433,31 @@ namespace SDK
             if (GetSlack() < Count)
                 MaxElements += Count;
 
-            Data = static_cast<ArrayElementType*>(FMemory::Realloc(Data, MaxElements * ElementSize, ElementAlign));
+            Data = static_cast<ArrayElementType*>(FMemory::Realloc(Data, MaxElements * ElementSize, ElementAlign, FMemory::EAllocSite::TArrayReserve));
+        }
+
+        /**
+         * @brief Allocates room for Count elements from the per-thread scratch allocator. The array must not own an allocation yet.
+         * @brief Read the ownership rule above TArray before using this.
+         */
+        inline void ReserveScratch(int32_t Count)
+        {
+            if (Data)
+                throw std::logic_error("ReserveScratch requires an unallocated array!");
+
+            Data = static_cast<ArrayElementType*>(FMemory::MallocScratch(Count * ElementSize, ElementAlign, FMemory::EAllocSite::TArrayScratch));
+            MaxElements = Count;
+        }
+
+        /** @brief Copies Other into scratch memory. The array must not own an allocation yet, see ReserveScratch. */
+        inline void CopyFromScratch(const TArray& Other)
+        {
+            if (Other.NumElements <= 0)
+                return;
+
+            ReserveScratch(Other.NumElements);
+            NumElements = Other.NumElements;
+            memcpy(Data, Other.Data, Other.NumElements * ElementSize);
         }
 
         inline void Add(const ArrayElementType& Element)
@@ -436,19 +471,19 @@ namespace SDK
 
         inline void CopyFrom(const TArray& Other)
         {
-            if (this == &Other || Other.NumElements == 0)
+            // A negative count only comes from a corrupt array, and would turn into a huge size below.
+            if (this == &Other || Other.NumElements <= 0)
                 return;
 
+            const size_t Size = static_cast<size_t>(Other.NumElements) * ElementSize;
             NumElements = Other.NumElements;
 
-            if (MaxElements >= Other.NumElements) {
-                memcpy(Data, Other.Data, Other.NumElements);
-                return;
+            if (MaxElements < Other.NumElements) {
+                Data = static_cast<ArrayElementType*>(FMemory::Realloc(Data, Size, ElementAlign, FMemory::EAllocSite::TArrayCopy));
+                MaxElements = Other.NumElements;
             }
 
-            Data = static_cast<ArrayElementType*>(FMemory::Realloc(Data, Other.NumElements * ElementSize, ElementAlign));
-            MaxElements = Other.NumElements;
-            memcpy(Data, Other.Data, Other.NumElements * ElementSize);
+            memcpy(Data, Other.Data, Size);
         }
 
         inline void Remove(int32_t Index)
@@ -475,8 +510,9 @@ namespace SDK
         inline void Free() noexcept
         {
             if (Data)
-                FMemory::Free(Data);
+                FMemory::Free(Data, FMemory::EAllocSite::TArrayFree);
 
+            Data = nullptr;
             NumElements = 0x0;
             MaxElements = 0x0;
         }
@@ -485,6 +521,9 @@ namespace SDK
         inline int32_t Num() const { return NumElements; }
         inline int32_t Max() const { return MaxElements; }
 
+        inline ArrayElementType* GetData() { return Data; }
+        inline const ArrayElementType* GetData() const { return Data; }
+
         inline bool IsValidIndex(int32_t Index) const { return Data && Index >= 0 && Index < NumElements; }
 
         inline bool IsValid() const { return Data && NumElements > 0 && MaxElements >= NumElements; }
@@ -525,12 +564,21 @@ namespace SDK
         {
             const uint32_t NullTerminatedLength = static_cast<uint32_t>(wcslen(Str) + 0x1);
 
-            *this = FString(NullTerminatedLength);
-
+            Data = static_cast<wchar_t*>(FMemory::Malloc(NullTerminatedLength * sizeof(wchar_t), alignof(wchar_t), FMemory::EAllocSite::FStringConstruct));
+            MaxElements = NullTerminatedLength;
             NumElements = NullTerminatedLength;
             memcpy(Data, Str, NullTerminatedLength * sizeof(wchar_t));
         }
 
+    public:
+        /** @brief Creates an empty FString with Capacity characters of scratch memory. Read the ownership rule above TArray before using this. */
+        static FString Scratch(int32_t Capacity)
+        {
+            FString Result;
+            Result.ReserveScratch(Capacity);
+            return Result;
+        }
+
     public:
         inline std::string ToString() const
         {
@@ -618,7 +666,7 @@ namespace SDK
         inline const SparseArrayElementType& operator[](int32_t Index) const
         {
             VerifyIndex(Index);
-            return *reinterpret_cast<SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData);
+            return *reinterpret_cast<const SparseArrayElementType*>(&Data.GetUnsafe(Index).ElementData);
         }
 
         inline bool operator==(const TSparseArray<SparseArrayElementType>& Other) const { return Data == Other.Data; }
@@ -723,6 +771,36 @@ namespace SDK
     public:
         const ContainerImpl::FBitArray& GetAllocationFlags() const { return Elements.GetAllocationFlags(); }
 
+    public:
+        /**
+         * @brief Finds an element by walking the engine's hash bucket chain instead of every element.
+         *
+         * @param[in] KeyHash - Hash of the target key, must match the engine's GetTypeHash for the key type.
+         * @param[in] Predicate - Called with candidate elements from the bucket, returns true for the target element.
+         *
+         * @return Index of the element if found, else -1.
+         */
+        template <typename PredicateType>
+        inline int32_t FindIndexByHash(uint32_t KeyHash, PredicateType Predicate) const
+        {
+            if (HashSize <= 0 || !IsValid())
+                return -1;
+
+            const int32_t* Buckets = Hash.GetAllocation();
+
+            // Chains can never be longer than the number of elements, bail out if the layout doesn't match.
+            int32_t MaxSteps = NumAllocated();
+            for (int32_t Index = Buckets[KeyHash & (HashSize - 1)]; Index != -1 && MaxSteps-- > 0; Index = Elements[Index].HashNextId) {
+                if (!IsValidIndex(Index))
+                    return -1;
+
+                if (Predicate(Elements[Index].Value))
+                    return Index;
+            }
+
+            return -1;
+        }
+
     public:
         inline SetElementType& operator[](int32_t Index) { return Elements[Index].Value; }
         inline const SetElementType& operator[](int32_t Index) const { return Elements[Index].Value; }
@@ -777,6 +855,28 @@ namespace SDK
             return end(*this);
         }
 
+        /**
+         * @brief Finds a value through the engine's hash buckets. See TSet::FindIndexByHash.
+         *
+         * @param[in] Key - Target key.
+         * @param[in] KeyHash - Hash of the target key, must match the engine's GetTypeHash for the key type.
+         * @param[in] Equals - Key comparison function.
+         *
+         * @return A pointer to the value if found, else a nullptr.
+         */
+        inline ValueElementType* FindByHash(const KeyElementType& Key, uint32_t KeyHash, bool (*Equals)(const KeyElementType& LeftKey, const KeyElementType& RightKey))
+        {
+            const int32_t Index = Elements.FindIndexByHash(KeyHash, [&Key, Equals](const ElementType& Element) {
+                return Equals(Element.Key(), Key);
+            });
+
+            return Index != -1 ? &Elements[Index].Value() : nullptr;
+        }
+        inline const ValueElementType* FindByHash(const KeyElementType& Key, uint32_t KeyHash, bool (*Equals)(const KeyElementType& LeftKey, const KeyElementType& RightKey)) const
+        {
+            return const_cast<TMap*>(this)->FindByHash(Key, KeyHash, Equals);
+        }
+
     public:
         inline ElementType& operator[](int32_t Index) { return Elements[Index]; }
         inline const ElementType& operator[](int32_t Index) const { return Elements[Index]; }
@@ -945,11 +1045,6 @@ namespace SDK
                 ++BitIterator;
                 return *this;
             }
-            inline TContainerIterator& operator--()
-            {
-                --BitIterator;
-                return *this;
-            }
 
             inline auto& operator*() { return IteratedContainer[GetIndex()]; }
             inline const auto& operator*() const { return IteratedContainer[GetIndex()]; }
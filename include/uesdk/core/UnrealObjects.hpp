@@ -9,6 +9,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace SDK
 {
@@ -42,7 +43,19 @@ namespace SDK
         void ProcessEvent(class UFunction* Function, void* Parms);
 
         /**
-         * @brief FastSearchSingle wrapper to retrieve the value of a member in a class.
+         * @brief Calls a native UFunction's thunk directly with a minimal FFrame, skipping ProcessEvent's script VM dispatch.
+         * @brief Hooks on ProcessEvent will not see these calls.
+         * @brief Falls back to ProcessEvent for functions that are not FUNC_Native, networked, not part of this object's class
+         * @brief (interface functions), overridden further down this object's class hierarchy, or if the Offsets::FFrame layout is unset.
+         * @brief The layout is unset by default, see Offsets::FFrame::UseLayout_4_25_To_5_0.
+         *
+         * @param[in] Function - The UFunction to call.
+         * @param[in,out] Parms - The parameters struct, same as ProcessEvent.
+         */
+        void CallNative(class UFunction* Function, void* Parms);
+
+        /**
+         * @brief Retrieves the value of a member in a class. The offset is resolved once, together with the other reflected members (see SDK::ResolveAllReflected).
          * @brief This does not search inhereted classes, so make sure you use the exact class name that contains the member you want.
          *
          * @tparam ClassName - The name of the UClass to search for the member in.
@@ -51,7 +64,7 @@ namespace SDK
          *
          * @return The value of the class member.
          *
-         * @throws std::runtime_error - If FastSearchSingle was unable to find the member offset.
+         * @throws std::runtime_error - If the member offset wasn't found.
          */
         template <StringLiteral ClassName, StringLiteral MemberName, typename MemberType>
         MemberType GetMember();
@@ -61,7 +74,7 @@ namespace SDK
         MemberType* GetMemberPtr();
 
         /**
-         * @brief FastSearchSingle wrapper to set the value of a member in a class.
+         * @brief Sets the value of a member in a class. The offset is resolved once, together with the other reflected members (see SDK::ResolveAllReflected).
          * @brief This does not search inhereted classes, so make sure you use the exact class name that contains the member you want.
          *
          * @tparam ClassName - The name of the UClass to search for the member in.
@@ -70,7 +83,7 @@ namespace SDK
          *
          * @param Value - The value to set the member to.
          *
-         * @throws std::runtime_error - If FastSearchSingle was unable to find the member offset.
+         * @throws std::runtime_error - If the member offset wasn't found.
          */
         template <StringLiteral ClassName, StringLiteral MemberName, typename MemberType>
         void SetMember(MemberType Value);
@@ -193,11 +206,35 @@ namespace SDK
 
     public:
         /**
-         * @brief Finds an enumerator value based off of
+         * @brief Finds an enumerator value based off of its name.
+         * @brief Lookups are served from a lazily built per-UEnum cache, rebuilt whenever the Names array is reallocated or resized.
          * @param Name - Target enumerator name.
          * @return The enumerator value if found, else OFFSET_NOT_FOUND.
          */
         int64_t FindEnumerator(const FName& Name) const;
+
+        /**
+         * @brief Finds an enumerator name based off of its value. Uses the same lookup cache as FindEnumerator.
+         * @param Value - Target enumerator value.
+         * @return The enumerator name if found, else a None FName.
+         */
+        FName FindEnumeratorName(int64_t Value) const;
+
+        /**
+         * @brief Checks if the enum looks like a bitflag enum.
+         * @brief Every enumerator, excluding the trailing _MAX entry, must be zero or a single bit, with at least one bit above 0x2.
+         */
+        bool IsBitflags() const;
+
+        /**
+         * @brief Decomposes a bitflag value into the names of its single-bit enumerators.
+         *
+         * @param[in] Value - Target bitflag value.
+         * @param[out] (optional) OutRemainder - Bits of Value which no enumerator covers.
+         *
+         * @return The enumerator names in ascending bit order. A zero value returns the zero enumerator if one exists.
+         */
+        std::vector<FName> DecomposeFlags(int64_t Value, int64_t* OutRemainder = nullptr) const;
     };
 
     class UFunction : public UStruct
@@ -221,6 +258,60 @@ namespace SDK
         // clang-format on
     };
 
+    /** @brief A typed view of a single UDataTable row. The row memory is owned by the engine. */
+    template <typename RowType>
+    struct TDataTableRowView
+    {
+        const FName& Name;
+        RowType* Row;
+    };
+
+    /** @brief Range over every row of a UDataTable, yielding TDataTableRowView. */
+    template <typename RowType>
+    class TDataTableRowRange
+    {
+    private:
+        using MapType = TMap<FName, uint8_t*>;
+
+    public:
+        class Iterator
+        {
+        private:
+            Iterators::TMapIterator<FName, uint8_t*> It;
+
+        public:
+            explicit Iterator(Iterators::TMapIterator<FName, uint8_t*> It)
+                : It(It)
+            {
+            }
+
+        public:
+            inline Iterator& operator++()
+            {
+                ++It;
+                return *this;
+            }
+
+            inline TDataTableRowView<RowType> operator*() { return { It->Key(), reinterpret_cast<RowType*>(It->Value()) }; }
+
+            inline bool operator==(const Iterator& Other) const { return It == Other.It; }
+            inline bool operator!=(const Iterator& Other) const { return It != Other.It; }
+        };
+
+    private:
+        const MapType& Map;
+
+    public:
+        explicit TDataTableRowRange(const MapType& Map)
+            : Map(Map)
+        {
+        }
+
+    public:
+        inline Iterator begin() const { return Iterator(SDK::begin(Map)); }
+        inline Iterator end() const { return Iterator(SDK::end(Map)); }
+    };
+
     class UDataTable : public UObject
     {
     public:
@@ -234,6 +325,35 @@ namespace SDK
         UESDK_UPROPERTY_OFFSET(UESDK_TYPE(TMap<FName, uint8_t*>),   RowMap,     SDK::Offsets::UDataTable::RowMap);
 
         // clang-format on
+
+    public:
+        /**
+         * @brief Finds a row using the engine's RowMap hash buckets.
+         * @brief Falls back to a linear scan if the engine's FName hash doesn't match GetTypeHash(FName).
+         *
+         * @param[in] RowName - Target row name.
+         *
+         * @return A pointer to the row memory if found, else a nullptr.
+         */
+        uint8_t* FindRowUnchecked(const FName& RowName) const;
+
+        /**
+         * @brief Typed wrapper for FindRowUnchecked.
+         *
+         * @tparam RowType - Row struct type, can't be larger than RowStruct::PropertiesSize.
+         * @param[in] RowName - Target row name.
+         *
+         * @return A pointer to the row if found, else a nullptr.
+         *
+         * @throws std::invalid_argument - If RowType is larger than the row struct.
+         * @throws std::runtime_error - If RowType isn't void and the table has no row struct.
+         */
+        template <typename RowType>
+        RowType* FindRow(const FName& RowName) const;
+
+        /** @brief Returns a range yielding a TDataTableRowView for every row. */
+        template <typename RowType>
+        TDataTableRowRange<RowType> Rows() const;
     };
 }
 
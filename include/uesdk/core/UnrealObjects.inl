@@ -2,6 +2,7 @@
 #include <uesdk/State.hpp>
 #include <uesdk/core/UnrealObjects.hpp>
 #include <uesdk/helpers/FastSearch.hpp>
+#include <uesdk/helpers/ReflectionRegistry.hpp>
 
 #include <algorithm>
 #include <array>
@@ -9,33 +10,55 @@
 
 namespace SDK
 {
+    namespace Reflection
+    {
+        /** @brief Descriptor of one UObject::GetMember/GetMemberPtr/SetMember member, shared by all three. */
+        template <StringLiteral ClassName, StringLiteral MemberName>
+        inline FReflectedProperty g_MemberProperty { ClassName.c_str(), MemberName.c_str() };
+    }
+
     template <StringLiteral ClassName, StringLiteral MemberName, typename MemberType>
     MemberType UObject::GetMember()
     {
-        static int32_t Offset = OFFSET_NOT_FOUND;
-        if (Offset == OFFSET_NOT_FOUND && !FastSearchSingle(FSProperty(ClassName.c_str(), MemberName.c_str(), &Offset))) {
-            throw std::runtime_error(std::format("Failed to find member offset! ({}, {})", ClassName.c_str(), MemberName.c_str()));
-        }
-        return *reinterpret_cast<MemberType*>((uint8_t*)this + Offset);
+        return *GetMemberPtr<ClassName, MemberName, MemberType>();
     }
 
     template <StringLiteral ClassName, StringLiteral MemberName, typename MemberType>
     MemberType* UObject::GetMemberPtr()
     {
-        static int32_t Offset = OFFSET_NOT_FOUND;
-        if (Offset == OFFSET_NOT_FOUND && !FastSearchSingle(FSProperty(ClassName.c_str(), MemberName.c_str(), &Offset))) {
+        Reflection::FReflectedProperty& Member = Reflection::g_MemberProperty<ClassName, MemberName>;
+
+        const Reflection::FPropertyOffset& Prop = Member.GetOffset();
+        if (!Prop.Found) [[unlikely]]
             throw std::runtime_error(std::format("Failed to find member offset! ({}, {})", ClassName.c_str(), MemberName.c_str()));
-        }
-        return reinterpret_cast<MemberType*>((uint8_t*)this + Offset);
+
+        return reinterpret_cast<MemberType*>((uint8_t*)this + Prop.Offset);
     }
 
     template <StringLiteral ClassName, StringLiteral MemberName, typename MemberType>
     void UObject::SetMember(MemberType Value)
     {
-        static int32_t Offset = OFFSET_NOT_FOUND;
-        if (Offset == OFFSET_NOT_FOUND && !FastSearchSingle(FSProperty(ClassName.c_str(), MemberName.c_str(), &Offset))) {
-            throw std::runtime_error(std::format("Failed to find member offset! ({}, {})", ClassName.c_str(), MemberName.c_str()));
+        *GetMemberPtr<ClassName, MemberName, MemberType>() = Value;
+    }
+
+    template <typename RowType>
+    RowType* UDataTable::FindRow(const FName& RowName) const
+    {
+        if constexpr (!std::is_void_v<RowType>) {
+            const UScriptStruct* Struct = RowStruct;
+            if (!Struct)
+                throw std::runtime_error("Data table has no row struct!");
+
+            if (sizeof(RowType) > static_cast<size_t>(Struct->PropertiesSize))
+                throw std::invalid_argument(std::format("Row type is larger than the row struct! ({})", Struct->GetName()));
         }
-        *reinterpret_cast<MemberType*>((uint8_t*)this + Offset) = Value;
+
+        return reinterpret_cast<RowType*>(FindRowUnchecked(RowName));
+    }
+
+    template <typename RowType>
+    TDataTableRowRange<RowType> UDataTable::Rows() const
+    {
+        return TDataTableRowRange<RowType>(RowMap);
     }
 }
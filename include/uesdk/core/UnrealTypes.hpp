@@ -40,6 +40,12 @@ namespace SDK
         std::string ToString() const;
     };
 
+    /** @brief Matches the engine's GetTypeHash(FName), used for hashed TSet/TMap lookups. */
+    inline uint32_t GetTypeHash(const FName& Name)
+    {
+        return Name.ComparisonIndex + Name.Number;
+    }
+
     class FTextData
     {
     public:
@@ -0,0 +1,149 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef UESDK_PROFILER
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+namespace SDK
+{
+    class UFunction;
+}
+
+/**
+ * @brief Opt-in profiler for UObject::ProcessEvent calls, enabled by building with UESDK_PROFILER.
+ * @brief Calls made through PECallWrapper and DynamicCall are timed with their marshalling, direct ProcessEvent calls on their own.
+ * @brief UObject::CallNative is only recorded when PECallWrapper makes the call, or when it falls back to ProcessEvent.
+ * @brief Every thread records into its own histograms, which are only merged when collecting. Without UESDK_PROFILER nothing is recorded.
+ */
+namespace SDK::Profiler
+{
+    /**
+     * @brief Merged statistics of one UFunction. Marshalling is everything PECallWrapper or DynamicCall does around the ProcessEvent call,
+     * @brief zero for direct ProcessEvent calls.
+     */
+    struct FFunctionProfile
+    {
+        UFunction* Function = nullptr;
+        std::string Name;
+
+        uint64_t Calls = 0;
+        uint32_t ParmsSize = 0;
+
+        double TotalNs = 0.0;
+        double CalleeNs = 0.0;
+        double MarshalNs = 0.0;
+
+        // Percentiles of the whole call, estimated from log-linear histograms (within 25%).
+        double P50Ns = 0.0;
+        double P99Ns = 0.0;
+    };
+
+    /** @return If the library was built with UESDK_PROFILER. */
+    bool IsEnabled();
+
+    /**
+     * @brief Merges every thread's histograms, sorted by total time, descending.
+     * @brief Function names are read from the engine here, so the UFunctions must still be loaded.
+     */
+    std::vector<FFunctionProfile> Collect();
+
+    /** @brief Collect formatted as CSV (RFC 4180), one row per UFunction. */
+    std::string ExportCSV();
+
+    /**
+     * @brief The most recent calls of every thread (up to 8192 per thread) in the Chrome trace event format, viewable in chrome://tracing or Perfetto.
+     * @brief Every call is a complete event with the ProcessEvent part nested inside it.
+     */
+    std::string ExportChromeTrace();
+
+    /** @brief Clears every thread's data. Calls recorded concurrently may be partially kept. */
+    void Reset();
+
+#ifdef UESDK_PROFILER
+    inline uint64_t ReadTSC()
+    {
+        return __rdtsc();
+    }
+
+    void RecordCall(UFunction* Function, uint32_t ParmsSize, uint64_t Start, uint64_t CalleeStart, uint64_t CalleeEnd, uint64_t End);
+
+    /** @brief Times one call, used by PECallWrapper, DynamicCall and UObject::ProcessEvent. */
+    class FCallScope
+    {
+    public:
+        FCallScope(UFunction* Function, uint32_t ParmsSize)
+            : m_Function(Function)
+            , m_ParmsSize(ParmsSize)
+            , m_Start(ReadTSC())
+        {
+        }
+
+        ~FCallScope()
+        {
+            const uint64_t End = ReadTSC();
+            RecordCall(m_Function, m_ParmsSize, m_Start, m_CalleeStart ? m_CalleeStart : End, m_CalleeEnd ? m_CalleeEnd : End, End);
+        }
+
+        FCallScope(const FCallScope&) = delete;
+        FCallScope& operator=(const FCallScope&) = delete;
+
+    public:
+        void BeginCallee()
+        {
+            m_CalleeStart = ReadTSC();
+            s_PendingCallee = this;
+        }
+
+        void EndCallee()
+        {
+            m_CalleeEnd = ReadTSC();
+            if (s_PendingCallee == this)
+                s_PendingCallee = nullptr;
+        }
+
+        /**
+         * @brief Called by UObject::ProcessEvent before calling the engine.
+         * @return If the call is the callee of the scope that last called BeginCallee on this thread, which already times it.
+         */
+        static bool ClaimCallee(UFunction* Function)
+        {
+            FCallScope* Pending = s_PendingCallee;
+            if (!Pending || Pending->m_Function != Function)
+                return false;
+
+            s_PendingCallee = nullptr;
+            return true;
+        }
+
+    private:
+        // Cleared by the first ProcessEvent call, so calls the callee makes itself are recorded on their own.
+        static inline thread_local FCallScope* s_PendingCallee = nullptr;
+
+
+        UFunction* m_Function;
+        uint32_t m_ParmsSize;
+        uint64_t m_Start;
+        uint64_t m_CalleeStart = 0;
+        uint64_t m_CalleeEnd = 0;
+    };
+#else
+    class FCallScope
+    {
+    public:
+        FCallScope(UFunction*, uint32_t) { }
+
+    public:
+        void BeginCallee() { }
+        void EndCallee() { }
+
+        static bool ClaimCallee(UFunction*) { return true; }
+    };
+#endif
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/PropertyInfo.hpp>
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SDK
+{
+    /**
+     * @brief Copies selected columns of every UDataTable row into contiguous per-column arrays (SoA).
+     * @brief Column offsets are resolved once from RowStruct, so Refresh only re-copies values.
+     * @brief Bit-field columns are stored as one byte per row, holding 0 or 1.
+     */
+    class FDataTableSnapshot
+    {
+    private:
+        struct FColumn
+        {
+            FName Name;
+            int32_t Offset = 0;
+            // Bytes per row, ElementSize * ArrayDim of the property.
+            int32_t ElementSize = 0;
+            uint8_t ByteMask = 0;
+            std::vector<uint8_t> Data;
+        };
+
+    public:
+        /**
+         * @brief Resolves the columns and takes an initial snapshot.
+         *
+         * @param[in] Table - Target UDataTable.
+         * @param[in] Columns - Names of the RowStruct properties to copy.
+         *
+         * @throws std::invalid_argument - If the table is invalid or a column isn't a property of RowStruct.
+         */
+        FDataTableSnapshot(const UDataTable* Table, const std::vector<std::string>& Columns);
+
+    public:
+        /** @brief Re-copies every column of every row. Rows added or removed since the last snapshot are picked up. */
+        void Refresh();
+
+    public:
+        inline int32_t NumRows() const { return static_cast<int32_t>(m_RowNames.size()); }
+        inline int32_t NumColumns() const { return static_cast<int32_t>(m_Columns.size()); }
+
+        inline const std::vector<FName>& GetRowNames() const { return m_RowNames; }
+
+        /** @return The index of the column, or -1 if it wasn't part of the snapshot. */
+        int32_t FindColumn(const FName& Name) const;
+
+        /**
+         * @brief Gets a typed view of a column, one element per row in GetRowNames order.
+         *
+         * @tparam T - Column element type, must be the same size as the property, e.g. std::array<float, 4> for a static array of 4 floats.
+         * @param[in] ColumnIndex - Index of the column, in constructor order.
+         *
+         * @throws std::out_of_range - If ColumnIndex is invalid.
+         * @throws std::invalid_argument - If T doesn't match the property size.
+         */
+        template <typename T>
+        std::span<const T> GetColumn(int32_t ColumnIndex) const
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Column type must be trivially copyable.");
+
+            if (ColumnIndex < 0 || ColumnIndex >= NumColumns())
+                throw std::out_of_range("Column index was out of range!");
+
+            const FColumn& Column = m_Columns[ColumnIndex];
+            if (sizeof(T) != static_cast<size_t>(Column.ElementSize))
+                throw std::invalid_argument("Column type size doesn't match the property size!");
+
+            return { reinterpret_cast<const T*>(Column.Data.data()), m_RowNames.size() };
+        }
+
+    private:
+        const UDataTable* m_Table = nullptr;
+        std::vector<FName> m_RowNames;
+        std::vector<FColumn> m_Columns;
+    };
+}
@@ -0,0 +1,236 @@
+#pragma once
+#include <uesdk/core/UnrealTypes.hpp>
+
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace SDK
+{
+    class UObject;
+
+    enum class EArgType : uint8_t
+    {
+        None,   // No value, the parameter is left zeroed. Returned by void functions.
+        Bool,   // bool
+        Int,    // int64_t, any integer, byte or enum property
+        Float,  // double, float or double properties
+        Name,   // FName
+        String, // Null terminated wchar_t string, FString properties
+        Object, // UObject*, object and class properties
+        Bytes   // Raw bytes, any other property (structs, arrays, ...) copied bitwise
+    };
+
+    /**
+     * @brief A dynamically typed argument or result of DynamicCall.
+     * @brief Values up to InlineSize bytes are stored inline, only larger strings and byte blobs allocate.
+     */
+    class FArgValue
+    {
+    public:
+        static constexpr uint32_t InlineSize = 32;
+
+    public:
+        FArgValue() = default;
+
+        FArgValue(bool Value) { Assign(EArgType::Bool, &Value, sizeof(Value)); }
+        FArgValue(float Value) { SetFloat(Value); }
+        FArgValue(double Value) { SetFloat(Value); }
+        FArgValue(const FName& Value) { Assign(EArgType::Name, &Value, sizeof(Value)); }
+        FArgValue(UObject* Value) { Assign(EArgType::Object, &Value, sizeof(Value)); }
+        FArgValue(std::nullptr_t) { SetObject(nullptr); }
+        FArgValue(std::wstring_view Value) { SetString(Value); }
+        FArgValue(const std::wstring& Value) { SetString(Value); }
+        FArgValue(const wchar_t* Value) { SetString(Value); }
+
+        template <std::integral T>
+            requires(!std::is_same_v<T, bool> && !std::is_same_v<T, wchar_t>)
+        FArgValue(T Value)
+        {
+            const int64_t Wide = static_cast<int64_t>(Value);
+            Assign(EArgType::Int, &Wide, sizeof(Wide));
+        }
+
+        template <typename T>
+            requires std::is_base_of_v<UObject, T>
+        FArgValue(T* Value)
+        {
+            SetObject(reinterpret_cast<UObject*>(Value));
+        }
+
+        FArgValue(const FArgValue& Other) { Assign(Other.m_Type, Other.GetData(), Other.m_Size); }
+        FArgValue(FArgValue&& Other) noexcept { MoveFrom(Other); }
+
+        FArgValue& operator=(const FArgValue& Other)
+        {
+            if (this != &Other) {
+                Reset();
+                Assign(Other.m_Type, Other.GetData(), Other.m_Size);
+            }
+            return *this;
+        }
+
+        FArgValue& operator=(FArgValue&& Other) noexcept
+        {
+            if (this != &Other) {
+                Reset();
+                MoveFrom(Other);
+            }
+            return *this;
+        }
+
+        ~FArgValue() { Reset(); }
+
+    public:
+        /** @brief A raw bytes value, used for struct and container parameters. The size must match the parameter's size exactly. */
+        static FArgValue FromBytes(const void* Data, uint32_t Size)
+        {
+            FArgValue Result;
+            Result.Assign(EArgType::Bytes, Data, Size);
+            return Result;
+        }
+
+        /** @brief FromBytes for a trivially copyable struct mirroring the engine type. */
+        template <typename T>
+        static FArgValue FromStruct(const T& Value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+            return FromBytes(&Value, sizeof(T));
+        }
+
+    public:
+        EArgType GetType() const { return m_Type; }
+        bool IsNone() const { return m_Type == EArgType::None; }
+
+        /** @brief Size of the stored value in bytes, strings include their null terminator. */
+        uint32_t GetSize() const { return m_Size; }
+        const uint8_t* GetData() const { return m_Size > InlineSize ? m_Heap : m_Inline; }
+
+        bool GetBool() const { return Read<bool>(EArgType::Bool); }
+        int64_t GetInt() const { return Read<int64_t>(EArgType::Int); }
+        double GetFloat() const { return Read<double>(EArgType::Float); }
+        FName GetName() const { return Read<FName>(EArgType::Name); }
+        UObject* GetObject() const { return Read<UObject*>(EArgType::Object); }
+
+        /** @return The string without its null terminator, or an empty view if this is not a string. */
+        std::wstring_view GetString() const
+        {
+            if (m_Type != EArgType::String || m_Size < sizeof(wchar_t))
+                return {};
+
+            return std::wstring_view(reinterpret_cast<const wchar_t*>(GetData()), m_Size / sizeof(wchar_t) - 1);
+        }
+
+        /** @brief Reinterprets a Bytes value as T, or returns a value initialized T if the sizes differ. */
+        template <typename T>
+        T GetStruct() const
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+
+            T Result {};
+            if (m_Type == EArgType::Bytes && m_Size == sizeof(T))
+                memcpy(&Result, GetData(), sizeof(T));
+            return Result;
+        }
+
+    private:
+        template <typename T>
+        T Read(EArgType Expected) const
+        {
+            T Result {};
+            if (m_Type == Expected)
+                memcpy(&Result, m_Inline, sizeof(T));
+            return Result;
+        }
+
+        void SetFloat(double Value) { Assign(EArgType::Float, &Value, sizeof(Value)); }
+        void SetObject(UObject* Value) { Assign(EArgType::Object, &Value, sizeof(Value)); }
+
+        void SetString(std::wstring_view Value)
+        {
+            const uint32_t Length = static_cast<uint32_t>(Value.size());
+            uint8_t* Data = Allocate(EArgType::String, (Length + 1) * sizeof(wchar_t));
+            memcpy(Data, Value.data(), Length * sizeof(wchar_t));
+            reinterpret_cast<wchar_t*>(Data)[Length] = L'\0';
+        }
+
+        uint8_t* Allocate(EArgType Type, uint32_t Size)
+        {
+            m_Type = Type;
+            m_Size = Size;
+            if (Size > InlineSize)
+                m_Heap = new uint8_t[Size];
+            return Size > InlineSize ? m_Heap : m_Inline;
+        }
+
+        void Assign(EArgType Type, const void* Data, uint32_t Size)
+        {
+            if (Size)
+                memcpy(Allocate(Type, Size), Data, Size);
+            else
+                m_Type = Type;
+        }
+
+        void MoveFrom(FArgValue& Other) noexcept
+        {
+            m_Type = Other.m_Type;
+            m_Size = Other.m_Size;
+            memcpy(m_Inline, Other.m_Inline, InlineSize);
+
+            Other.m_Type = EArgType::None;
+            Other.m_Size = 0;
+        }
+
+        void Reset()
+        {
+            if (m_Size > InlineSize)
+                delete[] m_Heap;
+
+            m_Type = EArgType::None;
+            m_Size = 0;
+        }
+
+    private:
+        EArgType m_Type = EArgType::None;
+        uint32_t m_Size = 0;
+
+        union
+        {
+            alignas(8) uint8_t m_Inline[InlineSize] = {};
+            uint8_t* m_Heap;
+        };
+    };
+
+    /**
+     * @brief Calls a UFunction by name with arguments only known at runtime, for config or script driven callers.
+     * @brief The UFunction is looked up on Obj's class and its super classes, and cached per class together with a marshalling plan,
+     * @brief repeat calls skip the lookup entirely.
+     *
+     * @brief Arguments are matched to the parameters in declaration order, excluding the return value, and converted by the reflected property type:
+     * @brief - Bool and integer properties accept Bool and Int, float and double properties accept Float and Int.
+     * @brief - Name properties accept Name and String, string properties accept String, object properties accept Object.
+     * @brief - Any other property takes Bytes of exactly its size, copied bitwise. The engine's copy owns nothing, containers inside are not freed.
+     * @brief - None leaves the parameter zeroed, use it for pure out parameters.
+     *
+     * @param[in] Obj - The object to call the function on.
+     * @param[in] FunctionName - Name of the UFunction, without the class.
+     * @param[in] Args - One value per parameter.
+     * @param[out] (optional) OutParams - Receives the out parameters in declaration order, at most OutParams.size() of them.
+     *
+     * @return The return value, None for void functions. Bytes return values are copied bitwise, the caller owns containers inside them.
+     *
+     * @throws std::invalid_argument - If Obj is nullptr, the function isn't found, the argument count differs or an argument doesn't convert.
+     */
+    FArgValue DynamicCall(UObject* Obj, std::string_view FunctionName, std::span<const FArgValue> Args, std::span<FArgValue> OutParams = {});
+
+    /** @brief Convenience overload of DynamicCall for literal argument lists. */
+    inline FArgValue DynamicCall(UObject* Obj, std::string_view FunctionName, std::initializer_list<FArgValue> Args)
+    {
+        return DynamicCall(Obj, FunctionName, std::span<const FArgValue>(Args.begin(), Args.size()));
+    }
+}
@@ -201,6 +201,17 @@ namespace SDK
      */
     bool FastSearch(std::vector<FSEntry>& SearchList);
 
+    /**
+     * @brief FastSearch with GObjects split into slices scanned by separate threads. Finds the same objects as FastSearch.
+     * @brief Falls back to FastSearch when GObjects is too small to be worth splitting.
+     *
+     * @param[in,out] SearchList - Same as FastSearch.
+     * @param[in] (optional) NumThreads - Number of threads including the calling one, 0 uses the hardware concurrency.
+     *
+     * @return If all fast search entries were found.
+     */
+    bool FastSearchParallel(std::vector<FSEntry>& SearchList, uint32_t NumThreads = 0);
+
     /** @brief Wrapper for searching for a single FSEntry. Batch searching is optimal. */
     template <typename T>
     inline bool FastSearchSingle(const T Entry)
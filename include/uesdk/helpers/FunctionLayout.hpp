@@ -0,0 +1,61 @@
+#pragma once
+#include <uesdk/core/UnrealEnums.hpp>
+#include <uesdk/core/UnrealTypes.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace SDK
+{
+    /** @brief Layout of one UFunction parameter inside the parameters struct. */
+    struct FParamLayout
+    {
+        FName Name;
+        int32_t Offset = 0;
+        int32_t Size = 0; // ElementSize of the property.
+        EPropertyFlags Flags = CPF_None;
+        uint64_t CastFlags = 0; // EClassCastFlags of the property's class, identifies the property type.
+
+        /** @return If the engine writes the parameter, const reference parameters are flagged CPF_OutParm but are inputs. */
+        bool IsOutParm() const { return (Flags & CPF_OutParm) && !(Flags & CPF_ConstParm); }
+
+        /** @return If the engine would run a destructor on the parameter. */
+        bool NeedsDestructor() const { return !(Flags & (CPF_IsPlainOldData | CPF_NoDestructor)); }
+    };
+
+    /** @brief Parameter layout of a UFunction, read once from its properties. Immutable. */
+    struct FFunctionLayout
+    {
+        const class UFunction* Function = nullptr;
+        // GObjects slot of Function when the layout was built, a different serial means the address was reused by another object.
+        int32_t ObjectIndex = -1;
+        int32_t SerialNumber = 0;
+        int32_t ParmsSize = 0;
+
+        std::vector<FParamLayout> Params; // In declaration order, without the return value.
+
+        bool HasReturnValue = false;
+        FParamLayout ReturnValue;
+
+        bool HasOutParms = false;
+        bool NeedsDestructor = false; // Any parameter, including the return value, needs a destructor.
+    };
+
+    /**
+     * @brief Process wide cache of FFunctionLayout, shared by PECallWrapper and DynamicCall.
+     * @brief Layouts are keyed by UFunction address and rebuilt when the address now belongs to another object.
+     * @brief Replaced layouts are kept, references stay valid for the life of the process.
+     */
+    class FFunctionLayoutCache
+    {
+    public:
+        /**
+         * @brief Returns the layout of Function, building it on first use. Safe to call from any thread.
+         * @throws std::invalid_argument - If Function is nullptr.
+         */
+        static const FFunctionLayout& Get(const class UFunction* Function);
+
+        /** @return If Function is still the object that had ObjectIndex and SerialNumber, for caches keyed by its address. */
+        static bool IsCurrent(const class UFunction* Function, int32_t ObjectIndex, int32_t SerialNumber);
+    };
+}
@@ -0,0 +1,147 @@
+#pragma once
+#include <uesdk/core/UnrealObjects.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <tuple>
+#include <type_traits>
+
+namespace SDK
+{
+    /**
+     * @brief Intrusive node of FGameThreadCallQueue.
+     * @brief Execute is called exactly once by the queue, with Run set to false if the queue is destroyed before draining the node.
+     * @brief The node belongs to the queue from Enqueue until Execute is called.
+     */
+    struct FQueuedCall
+    {
+        using ExecuteFunc = void (*)(FQueuedCall* Call, bool Run);
+
+        std::atomic<FQueuedCall*> Next = nullptr;
+        ExecuteFunc Execute = nullptr;
+        uint64_t EnqueueTime = 0;
+    };
+
+    /** @brief Counters of a FGameThreadCallQueue. Latency is the time between Enqueue and the start of the call. */
+    struct FGameThreadCallQueueStats
+    {
+        uint64_t Enqueued = 0;
+        uint64_t Executed = 0;
+        uint64_t Depth = 0;
+        uint64_t MaxDepth = 0;
+        uint64_t TotalLatencyNs = 0;
+        uint64_t MaxLatencyNs = 0;
+    };
+
+    /**
+     * @brief Lock-free multi-producer, single-consumer queue of calls to be run on the game thread.
+     * @brief Any thread can submit calls, Drain must only ever be called from one thread at a time, usually from a game thread hook.
+     * @brief Submitted callables and their captured arguments are stored in pooled nodes, only callables bigger than kPayloadSize are heap allocated.
+     */
+    class FGameThreadCallQueue
+    {
+    public:
+        static constexpr size_t kPayloadSize = 192;
+
+        /** @brief Node type used by Submit. Pooled nodes are never returned to the OS. */
+        struct FPooledCall : FQueuedCall
+        {
+            alignas(16) uint8_t Payload[kPayloadSize];
+        };
+
+    public:
+        FGameThreadCallQueue();
+
+        /** @brief Discards every call that hasn't been drained. Their futures receive std::future_errc::broken_promise. */
+        ~FGameThreadCallQueue();
+
+        FGameThreadCallQueue(const FGameThreadCallQueue&) = delete;
+        FGameThreadCallQueue& operator=(const FGameThreadCallQueue&) = delete;
+
+        /** @brief Process wide default queue, used by PECallWrapper::CallAsync when no queue is passed. It still has to be drained by the user. */
+        static FGameThreadCallQueue& Get();
+
+    public:
+        /**
+         * @brief Queues a callable to run on the draining thread.
+         *
+         * @param[in] Fn - Callable taking no arguments.
+         *
+         * @return Future receiving the result of Fn, or the exception it threw.
+         */
+        template <typename Func>
+        auto Submit(Func&& Fn) -> std::future<std::invoke_result_t<std::decay_t<Func>&>>;
+
+        /**
+         * @brief Queues a callable to run on the draining thread, then calls OnComplete on the same thread.
+         * @brief OnComplete is called as OnComplete(std::exception_ptr Error, ResultType* Result), Result is nullptr if Fn threw.
+         * @brief For callables returning void it is called as OnComplete(std::exception_ptr Error).
+         *
+         * @param[in] Fn - Callable taking no arguments.
+         * @param[in] OnComplete - Completion callback, must not throw.
+         */
+        template <typename Func, typename Callback>
+        void Submit(Func&& Fn, Callback&& OnComplete);
+
+        /**
+         * @brief Queues PECallWrapper::Call. Arguments are copied into the node, except non-const lvalues, which are held by reference
+         * @brief so output arguments reach the caller. Those, and pointer arguments, must stay valid until the call completed.
+         * @return Future receiving the return value of the call.
+         */
+        template <typename Wrapper, typename... CallArgs>
+        auto Call(Wrapper& CallWrapper, UObject* Obj, UFunction* Function, CallArgs&&... Args);
+
+        /** @brief Queues PECallWrapper::CallAuto. For full documentation read FGameThreadCallQueue::Call. */
+        template <typename Wrapper, typename... CallArgs>
+        auto CallAuto(Wrapper& CallWrapper, UObject* Obj, CallArgs&&... Args);
+
+        /** @brief Queues a caller owned node. Read FQueuedCall for the ownership rules. */
+        void Enqueue(FQueuedCall* Call);
+
+    public:
+        /**
+         * @brief Runs queued calls on the calling thread.
+         *
+         * @param[in] MaxCalls - Maximum number of calls to run, calls queued while draining may be included.
+         *
+         * @return Number of calls run.
+         */
+        size_t Drain(size_t MaxCalls = SIZE_MAX);
+
+        FGameThreadCallQueueStats GetStats() const;
+
+        void ResetStats();
+
+    private:
+        FQueuedCall* Pop();
+
+        template <typename Task>
+        void EnqueueTask(Task&& NewTask);
+
+        // How Call and CallAuto hold an argument: non-const lvalues by reference, they may be outputs, anything else by value.
+        template <typename Arg>
+        using CapturedArg = std::conditional_t<std::is_lvalue_reference_v<Arg> && !std::is_const_v<std::remove_reference_t<Arg>>, Arg, std::decay_t<Arg>>;
+
+        static FPooledCall* AcquireNode();
+        static void ReleaseNode(FPooledCall* Node);
+
+        static uint64_t GetTimeNs();
+
+    private:
+        // Vyukov intrusive MPSC queue, producers exchange m_Head and the consumer owns m_Tail.
+        alignas(64) std::atomic<FQueuedCall*> m_Head;
+        alignas(64) FQueuedCall* m_Tail = nullptr;
+        FQueuedCall m_Stub;
+
+        alignas(64) std::atomic<uint64_t> m_Enqueued = 0;
+        std::atomic<uint64_t> m_MaxDepth = 0;
+        alignas(64) std::atomic<uint64_t> m_Executed = 0;
+        std::atomic<uint64_t> m_TotalLatencyNs = 0;
+        std::atomic<uint64_t> m_MaxLatencyNs = 0;
+    };
+}
+
+#include <uesdk/helpers/GameThreadCallQueue.inl>
@@ -0,0 +1,122 @@
+#pragma once
+#include <uesdk/helpers/GameThreadCallQueue.hpp>
+
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <utility>
+
+namespace SDK
+{
+    template <typename Func>
+    auto FGameThreadCallQueue::Submit(Func&& Fn) -> std::future<std::invoke_result_t<std::decay_t<Func>&>>
+    {
+        using ResultType = std::invoke_result_t<std::decay_t<Func>&>;
+
+        std::promise<ResultType> Promise;
+        std::future<ResultType> Future = Promise.get_future();
+
+        EnqueueTask([Fn = std::forward<Func>(Fn), Promise = std::move(Promise)]() mutable {
+            try {
+                if constexpr (std::is_void_v<ResultType>) {
+                    Fn();
+                    Promise.set_value();
+                }
+                else {
+                    Promise.set_value(Fn());
+                }
+            }
+            catch (...) {
+                Promise.set_exception(std::current_exception());
+            }
+        });
+
+        return Future;
+    }
+
+    template <typename Func, typename Callback>
+    void FGameThreadCallQueue::Submit(Func&& Fn, Callback&& OnComplete)
+    {
+        using ResultType = std::invoke_result_t<std::decay_t<Func>&>;
+
+        EnqueueTask([Fn = std::forward<Func>(Fn), OnComplete = std::forward<Callback>(OnComplete)]() mutable {
+            if constexpr (std::is_void_v<ResultType>) {
+                std::exception_ptr Error;
+                try {
+                    Fn();
+                }
+                catch (...) {
+                    Error = std::current_exception();
+                }
+
+                OnComplete(Error);
+            }
+            else {
+                try {
+                    ResultType Result = Fn();
+                    OnComplete(std::exception_ptr(), &Result);
+                }
+                catch (...) {
+                    OnComplete(std::current_exception(), static_cast<ResultType*>(nullptr));
+                }
+            }
+        });
+    }
+
+    template <typename Wrapper, typename... CallArgs>
+    auto FGameThreadCallQueue::Call(Wrapper& CallWrapper, UObject* Obj, UFunction* Function, CallArgs&&... Args)
+    {
+        return Submit([&CallWrapper, Obj, Function, Captured = std::tuple<CapturedArg<CallArgs>...>(std::forward<CallArgs>(Args)...)]() mutable {
+            return std::apply([&](auto&... Arguments) { return CallWrapper.Call(Obj, Function, Arguments...); }, Captured);
+        });
+    }
+
+    template <typename Wrapper, typename... CallArgs>
+    auto FGameThreadCallQueue::CallAuto(Wrapper& CallWrapper, UObject* Obj, CallArgs&&... Args)
+    {
+        return Submit([&CallWrapper, Obj, Captured = std::tuple<CapturedArg<CallArgs>...>(std::forward<CallArgs>(Args)...)]() mutable {
+            return std::apply([&](auto&... Arguments) { return CallWrapper.CallAuto(Obj, Arguments...); }, Captured);
+        });
+    }
+
+    template <typename Task>
+    void FGameThreadCallQueue::EnqueueTask(Task&& NewTask)
+    {
+        using TaskType = std::decay_t<Task>;
+
+        FPooledCall* Node = AcquireNode();
+
+        if constexpr (sizeof(TaskType) <= kPayloadSize && alignof(TaskType) <= alignof(FPooledCall)) {
+            new (Node->Payload) TaskType(std::forward<Task>(NewTask));
+
+            Node->Execute = [](FQueuedCall* Call, bool Run) {
+                FPooledCall* Pooled = static_cast<FPooledCall*>(Call);
+                TaskType* Stored = std::launder(reinterpret_cast<TaskType*>(Pooled->Payload));
+
+                if (Run)
+                    (*Stored)();
+
+                Stored->~TaskType();
+                ReleaseNode(Pooled);
+            };
+        }
+        else {
+            TaskType* Stored = new TaskType(std::forward<Task>(NewTask));
+            std::memcpy(Node->Payload, &Stored, sizeof(Stored));
+
+            Node->Execute = [](FQueuedCall* Call, bool Run) {
+                FPooledCall* Pooled = static_cast<FPooledCall*>(Call);
+                TaskType* Stored = nullptr;
+                std::memcpy(&Stored, Pooled->Payload, sizeof(Stored));
+
+                if (Run)
+                    (*Stored)();
+
+                delete Stored;
+                ReleaseNode(Pooled);
+            };
+        }
+
+        Enqueue(Node);
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace SDK
+{
+    class UClass;
+
+    struct FDumpStats
+    {
+        uint64_t Objects = 0;
+        uint64_t Properties = 0;
+        uint64_t Bytes = 0;
+        double Seconds = 0.0;
+        double MBPerSecond = 0.0;
+    };
+
+    struct FDumpOptions
+    {
+        // Only dump objects that are or inherit from this class, every object if null.
+        UClass* Filter = nullptr;
+        bool IncludeDefaultObjects = false;
+        // Struct values nested deeper than this are written as their type name only.
+        int32_t MaxStructDepth = 4;
+        // Elements written per TArray or static array, the rest are summarized by their count.
+        int32_t MaxArrayElements = 16;
+        // Size of each of the two FStreamingWriter buffers, the dump uses 2 * BufferSize bytes regardless of the number of objects.
+        size_t BufferSize = 1 << 20;
+    };
+
+    /**
+     * @brief Writes every object in GObjects with its class, full name and the value of each property, including inherited ones.
+     * @brief Formatting runs on the calling thread while a FStreamingWriter thread writes to disk, so memory use stays constant.
+     *
+     * @brief Output is UTF-8 text. Each object is a "Class FullName" line followed by one "\tName = Value" line per property.
+     * @brief Numbers and bools are written as is, names and objects by name, strings quoted, structs as {Member = Value, ...}
+     * @brief and arrays as [Value, ...]. Maps, sets, delegates, texts, soft objects and field paths are written as <TypeName>.
+     *
+     * @param[in] Path - Target file, overwritten if it exists.
+     * @param[in] Options - See FDumpOptions.
+     *
+     * @return Counts, size and throughput of the dump.
+     *
+     * @throws std::logic_error - If the SDK isn't initialized.
+     * @throws std::runtime_error - If the file can't be opened or written.
+     */
+    FDumpStats DumpObjects(const std::string& Path, const FDumpOptions& Options = {});
+}
@@ -1,11 +1,19 @@
 #pragma once
 #include <uesdk/Utils.hpp>
 #include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/CallProfiler.hpp>
+#include <uesdk/helpers/FunctionLayout.hpp>
+#include <uesdk/helpers/Task.hpp>
 #include <uesdk/helpers/TlsArgBuffer.hpp>
 
 #include <array>
 #include <atomic>
 #include <exception>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
 namespace SDK
 {
@@ -16,46 +24,100 @@ namespace SDK
         ReturnType Call(UObject* Obj, UFunction* Function, Args... args);
         ReturnType CallAuto(UObject* Obj, Args... args);
 
+        ReturnType CallNative(UObject* Obj, UFunction* Function, Args... args);
+        ReturnType CallNativeAuto(UObject* Obj, Args... args);
+
+        TCallAwaiter<PECallWrapperImpl, ReturnType, Args...> CallAsync(FGameThreadCallQueue& Queue, UObject* Obj, Args... args);
+
+        template <typename OutputIt>
+        void CallBatch(std::span<UObject* const> Objects, UFunction* Function, OutputIt Out, Args... args);
+
+        template <typename OutputIt>
+        void CallBatchAuto(std::span<UObject* const> Objects, OutputIt Out, Args... args);
+
     private:
         static constexpr size_t kMaxStackAllocSize = 4096;
 
     private:
+        // How an argument is written into its slot, decided once per plan so a call doesn't test the parameter's flags again.
+        enum class EArgWrite : uint8_t
+        {
+            Value, // The argument itself. Input object parameters take pointers this way.
+            Pointee, // What a pointer argument points to, a null pointer leaves the zero fill.
+            ScratchString // An input-only FString, copied into scratch memory.
+        };
+
         struct ArgInfo
         {
             int32_t Offset = 0;
             int32_t Size = 0;
-            bool IsOutParm = false;
+            int32_t CopySize = 0; // Bytes memcpy'd for trivially copyable arguments, validated once when the plan is built.
+            bool IsOutParm = false; // Out parameters that are not CPF_ConstParm, these are copied back after the call.
+            EArgWrite Write = EArgWrite::Value;
         };
 
+        struct ZeroRange
+        {
+            int32_t Offset = 0;
+            int32_t Size = 0;
+        };
+
+        // Marshalling plan, built on the first call with each UFunction. Everything that can be decided from the UFunction and the
+        // argument types is resolved here, so a call only zeroes the gaps, writes the arguments and copies the outputs back.
         template <size_t NumArgs>
         struct FunctionArgInfo
         {
+            const UFunction* Function = nullptr;
+            // Copied from the function's layout, the plan is rebuilt when the address belongs to another object.
+            int32_t ObjectIndex = -1;
+            int32_t SerialNumber = 0;
             std::array<ArgInfo, (NumArgs > 0 ? NumArgs : 1)> ArgOffsets = { 0 };
+            std::array<ZeroRange, NumArgs + 2> ZeroRanges = {}; // Bytes not written by any argument, adjacent gaps are merged. Includes the return value.
+            int32_t NumZeroRanges = 0;
+            std::array<ZeroRange, NumArgs + 2> BatchZeroRanges = {}; // Same as ZeroRanges, minus a trivially destructible return value the callee always overwrites.
+            int32_t NumBatchZeroRanges = 0;
             size_t ParmsSize = 0;
             int32_t ReturnValueOffset = 0;
             int32_t ReturnValueSize = 0;
             bool HasReturnValue = false;
+            bool HasOutParms = false; // Calls skip copying outputs back when there are none.
         };
 
     private:
+        template <bool UseNative>
+        ReturnType Invoke(UObject* Obj, UFunction* Function, Args&&... args);
+
+        template <bool UseNative>
+        static void Dispatch(UObject* Obj, UFunction* Function, void* Parms);
+
+        static UFunction* FindFunction();
+
+        const FunctionArgInfo<sizeof...(Args)>& GetArgInfo(UFunction* Function);
+
         template <size_t N>
-        void WriteInputArgs(uint8_t* Parms, FunctionArgInfo<N>& FunctionArgs, Args&&... args, UFunction* Function);
+        void WriteInputArgs(uint8_t* Parms, const FunctionArgInfo<N>& FunctionArgs, Args&&... args);
 
         template <size_t N>
-        void WriteOutputArgs(uint8_t* Parms, FunctionArgInfo<N>& FunctionArgs, Args&&... args, UFunction* Function);
+        void WriteOutputArgs(uint8_t* Parms, const FunctionArgInfo<N>& FunctionArgs, Args&&... args);
 
         template <typename Param>
         static void DestroyParamSlot(uint8_t* ParmsBase, const ArgInfo& Info);
 
         template <size_t N, typename... ParamTypes, size_t... I>
-        static void DestroyParmsImpl(uint8_t* ParmsBase, FunctionArgInfo<N>& FunctionArgs, std::index_sequence<I...>);
+        static void DestroyParmsImpl(uint8_t* ParmsBase, const FunctionArgInfo<N>& FunctionArgs, std::index_sequence<I...>);
 
         template <size_t N, typename... ParamTypes>
-        static void DestroyParms(uint8_t* ParmsBase, FunctionArgInfo<N>& FunctionArgs);
+        static void DestroyParms(uint8_t* ParmsBase, const FunctionArgInfo<N>& FunctionArgs);
 
     private:
         template <size_t N>
         void InitializeArgInfo(const UFunction* Function, FunctionArgInfo<N>& FunctionArgs);
+
+        template <typename Param>
+        static int32_t PlanArg(const UFunction* Function, ArgInfo& Info);
+
+        template <size_t N, size_t... I>
+        static void BuildMarshalPlan(const UFunction* Function, FunctionArgInfo<N>& FunctionArgs, std::index_sequence<I...>);
     };
 
     // TODO: Add improvements for intellisense instead of this. Intellisense is so bad at handling NTTPs
@@ -103,16 +165,18 @@ namespace SDK
          * @brief Calls a ProcessEvent function.
          * @brief Important points:
          * @brief - All arguments must match the order they are in the original UFunction.
-         * @brief - Output parameters must end with pointer or reference.
-         * @brief - Trivially copyable output parameters (e.g., FHitResult) can be any size; only the smaller of the output parameter or the actual struct is copied.
+         * @brief - Output parameters must end with pointer or reference. Pointed to values are also passed in as input.
+         * @brief - Argument and return types are validated on the first call, before anything is passed to ProcessEvent.
+         * @brief - Trivially copyable arguments (e.g., FHitResult) can be bigger than the parameter; only the size of the parameter is copied.
          *
          * @param[in] Function - A pointer to the UFunction to call.
          * @param[in,out] ...args - Arguments to be sent to the UFunction.
          *
          * @return The value returned from the UFunction call.
          *
-         * @throws std::invalid_argument - If an output argument pointer is not writable.
+         * @throws std::invalid_argument - If an output argument is const, or not a pointer or lvalue reference.
          * @throws std::invalid_argument - If a trivially copyable argument isn't big enough to fit all data.
+         * @throws std::invalid_argument - If a non trivially copyable argument is bigger than its parameter.
          * @throws std::bad_alloc - If allocating memory for parameters failed.
          * @throws std::logic_error - If a return type was specified, but the UFunction does not have a return type.
          */
@@ -132,6 +196,77 @@ namespace SDK
                 "Obj must be a UObject or const UObject");
             return Base::CallAuto(const_cast<std::remove_const_t<UObjectType>*>(Obj), args...);
         }
+
+        /**
+         * @brief Same as PECallWrapper::Call, but calls native functions through their thunk directly. Read UObject::CallNative for when it falls back to ProcessEvent.
+         * @brief Opt-in, ProcessEvent hooks will not see these calls.
+         */
+        template <typename UObjectType, typename... Args>
+        auto CallNative(UObjectType* Obj, UFunction* Function, Args&&... args)
+        {
+            static_assert(std::is_base_of_v<SDK::UObject, std::remove_const_t<UObjectType>>,
+                "Obj must be a UObject or const UObject");
+            return Base::CallNative(const_cast<std::remove_const_t<UObjectType>*>(Obj), Function, args...);
+        }
+
+        /** @brief Wrapper to automatically find UFunction from template parameters. For full documentation read PECallWrapper::CallNative. */
+        template <typename UObjectType, typename... Args>
+        auto CallNativeAuto(UObjectType* Obj, Args&&... args)
+        {
+            static_assert(std::is_base_of_v<SDK::UObject, std::remove_const_t<UObjectType>>,
+                "Obj must be a UObject or const UObject");
+            return Base::CallNativeAuto(const_cast<std::remove_const_t<UObjectType>*>(Obj), args...);
+        }
+
+        /**
+         * @brief Awaitable version of PECallWrapper::CallAuto, runs the call on the thread draining Queue.
+         * @brief The awaiting coroutine is resumed on the draining thread after the call ran, keep heavy work between awaits off that thread.
+         * @brief Arguments are held by the awaiter until the call ran, reference arguments must outlive the co_await expression.
+         *
+         * @param[in] Queue - Queue to run the call on.
+         * @param[in] Obj - Object to call the function on.
+         * @param[in,out] ...args - Arguments to be sent to the UFunction.
+         *
+         * @return Awaitable yielding the return value. co_await rethrows anything PECallWrapper::Call threw.
+         */
+        template <typename UObjectType, typename... Args>
+        auto CallAsync(FGameThreadCallQueue& Queue, UObjectType* Obj, Args&&... args)
+        {
+            static_assert(std::is_base_of_v<SDK::UObject, std::remove_const_t<UObjectType>>,
+                "Obj must be a UObject or const UObject");
+            return Base::CallAsync(Queue, const_cast<std::remove_const_t<UObjectType>*>(Obj), std::forward<Args>(args)...);
+        }
+
+        /** @brief PECallWrapper::CallAsync on FGameThreadCallQueue::Get. For full documentation read the other PECallWrapper::CallAsync. */
+        template <typename UObjectType, typename... Args>
+        auto CallAsync(UObjectType* Obj, Args&&... args)
+        {
+            return CallAsync(FGameThreadCallQueue::Get(), Obj, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Calls a ProcessEvent function on every object in Objects with the same arguments, reusing one parameters buffer.
+         * @brief Output arguments are written after every call, so they end up holding the results of the last object.
+         *
+         * @param[in] Objects - Objects to call the function on, none of them may be nullptr.
+         * @param[in] Function - A pointer to the UFunction to call.
+         * @param[out] Out - Receives one return value per object, in order. Ignored for void functions, nullptr can be passed.
+         * @param[in,out] ...args - Arguments to be sent to the UFunction.
+         *
+         * @throws Same as PECallWrapper::Call.
+         */
+        template <typename OutputIt, typename... Args>
+        void CallBatch(std::span<UObject* const> Objects, UFunction* Function, OutputIt Out, Args&&... args)
+        {
+            Base::CallBatch(Objects, Function, Out, args...);
+        }
+
+        /** @brief Wrapper to automatically find UFunction from template parameters. For full documentation read PECallWrapper::CallBatch. */
+        template <typename OutputIt, typename... Args>
+        void CallBatchAuto(std::span<UObject* const> Objects, OutputIt Out, Args&&... args)
+        {
+            Base::CallBatchAuto(Objects, Out, args...);
+        }
     };
 }
 
@@ -17,43 +17,158 @@ namespace SDK
 
     template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
     ReturnType PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::Call(UObject* Obj, UFunction* Function, Args... args)
+    {
+        return Invoke<false>(Obj, Function, std::forward<Args>(args)...);
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    ReturnType PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::CallNative(UObject* Obj, UFunction* Function, Args... args)
+    {
+        return Invoke<true>(Obj, Function, std::forward<Args>(args)...);
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    template <bool UseNative>
+    ReturnType PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::Invoke(UObject* Obj, UFunction* Function, Args&&... args)
     {
         constexpr size_t NumArgs = sizeof...(Args);
-        static FunctionArgInfo<NumArgs> FunctionArgs = {};
+        const FunctionArgInfo<NumArgs>& FunctionArgs = GetArgInfo(Function);
 
         constexpr bool IsVoidRetType = std::is_void_v<ReturnType>;
 
-        static std::once_flag SetupOnce;
-        std::call_once(SetupOnce, [&] {
-            InitializeArgInfo(Function, FunctionArgs);
-        });
-
         if constexpr (std::is_void_v<ReturnType> && NumArgs == 0) {
             if (FunctionArgs.HasReturnValue || FunctionArgs.ParmsSize != 0)
                 throw std::logic_error("Mismatched function signature: '" + Function->GetFullName() + "' expects non-void function, void function passed");
 
-            Obj->ProcessEvent(Function, nullptr);
+            Profiler::FCallScope Profile(Function, 0);
+            Profile.BeginCallee();
+            Dispatch<UseNative>(Obj, Function, nullptr);
+            Profile.EndCallee();
             return;
         }
 
-        TlsArgBuffer Parms(FunctionArgs.ParmsSize);
+        Profiler::FCallScope Profile(Function, static_cast<uint32_t>(FunctionArgs.ParmsSize));
 
-        WriteInputArgs(Parms.GetData(), FunctionArgs, std::forward<Args>(args)..., Function);
-        Obj->ProcessEvent(Function, Parms.GetData());
-        WriteOutputArgs(Parms.GetData(), FunctionArgs, std::forward<Args>(args)..., Function);
+        // The plan knows every byte the arguments write, so only the remaining gaps need clearing.
+        TlsArgBuffer Parms(FunctionArgs.ParmsSize, false);
+        for (int32_t i = 0; i < FunctionArgs.NumZeroRanges; i++)
+            std::memset(Parms.GetData() + FunctionArgs.ZeroRanges[i].Offset, 0, FunctionArgs.ZeroRanges[i].Size);
 
-        DestroyParms<NumArgs, Args...>(Parms.GetData(), FunctionArgs);
+        WriteInputArgs(Parms.GetData(), FunctionArgs, std::forward<Args>(args)...);
+        Profile.BeginCallee();
+        Dispatch<UseNative>(Obj, Function, Parms.GetData());
+        Profile.EndCallee();
+        WriteOutputArgs(Parms.GetData(), FunctionArgs, std::forward<Args>(args)...);
 
         if constexpr (!IsVoidRetType) {
-            if (!FunctionArgs.HasReturnValue)
-                throw std::logic_error("Mismatched return type: '" + Function->GetFullName() + "' expects no return value, but template specifies non-void return type");
+            ReturnType* ReturnSlot = reinterpret_cast<ReturnType*>(Parms.GetData() + FunctionArgs.ReturnValueOffset);
+            ReturnType Result = std::move(*ReturnSlot);
+            if constexpr (!std::is_trivially_destructible_v<ReturnType>)
+                ReturnSlot->~ReturnType();
 
-            return *reinterpret_cast<ReturnType*>(Parms.GetData() + FunctionArgs.ReturnValueOffset);
+            DestroyParms<NumArgs, Args...>(Parms.GetData(), FunctionArgs);
+            return Result;
+        }
+        else {
+            DestroyParms<NumArgs, Args...>(Parms.GetData(), FunctionArgs);
         }
     }
 
     template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
     ReturnType PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::CallAuto(UObject* Obj, Args... args)
+    {
+        return Call(Obj, FindFunction(), std::forward<Args>(args)...);
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    ReturnType PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::CallNativeAuto(UObject* Obj, Args... args)
+    {
+        return CallNative(Obj, FindFunction(), std::forward<Args>(args)...);
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    TCallAwaiter<PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>, ReturnType, Args...> PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::CallAsync(FGameThreadCallQueue& Queue, UObject* Obj, Args... args)
+    {
+        return TCallAwaiter<PECallWrapperImpl, ReturnType, Args...>(Queue, *this, Obj, std::forward<Args>(args)...);
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    template <bool UseNative>
+    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::Dispatch(UObject* Obj, UFunction* Function, void* Parms)
+    {
+        if constexpr (UseNative)
+            Obj->CallNative(Function, Parms);
+        else
+            Obj->ProcessEvent(Function, Parms);
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    template <typename OutputIt>
+    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::CallBatch(std::span<UObject* const> Objects, UFunction* Function, OutputIt Out, Args... args)
+    {
+        constexpr size_t NumArgs = sizeof...(Args);
+        const FunctionArgInfo<NumArgs>& FunctionArgs = GetArgInfo(Function);
+
+        if constexpr (std::is_void_v<ReturnType> && NumArgs == 0) {
+            if (FunctionArgs.HasReturnValue || FunctionArgs.ParmsSize != 0)
+                throw std::logic_error("Mismatched function signature: '" + Function->GetFullName() + "' expects non-void function, void function passed");
+
+            for (UObject* Obj : Objects) {
+                Profiler::FCallScope Profile(Function, 0);
+                Profile.BeginCallee();
+                Obj->ProcessEvent(Function, nullptr);
+                Profile.EndCallee();
+            }
+
+            return;
+        }
+
+        TlsArgBuffer Parms(FunctionArgs.ParmsSize, false);
+        uint8_t* Data = Parms.GetData();
+
+        // The first call clears every gap, later calls leave out the return value if the callee always overwrites it.
+        for (int32_t i = 0; i < FunctionArgs.NumZeroRanges; i++)
+            std::memset(Data + FunctionArgs.ZeroRanges[i].Offset, 0, FunctionArgs.ZeroRanges[i].Size);
+
+        bool FirstCall = true;
+        for (UObject* Obj : Objects) {
+            Profiler::FCallScope Profile(Function, static_cast<uint32_t>(FunctionArgs.ParmsSize));
+
+            if (!FirstCall) {
+                for (int32_t i = 0; i < FunctionArgs.NumBatchZeroRanges; i++)
+                    std::memset(Data + FunctionArgs.BatchZeroRanges[i].Offset, 0, FunctionArgs.BatchZeroRanges[i].Size);
+            }
+            FirstCall = false;
+
+            // Arguments are written again every call, the callee is free to modify its parameters. WriteInputArgs only copies, so forwarding repeatedly is safe.
+            WriteInputArgs(Data, FunctionArgs, std::forward<Args>(args)...);
+            Profile.BeginCallee();
+            Obj->ProcessEvent(Function, Data);
+            Profile.EndCallee();
+            WriteOutputArgs(Data, FunctionArgs, std::forward<Args>(args)...);
+
+            if constexpr (!std::is_void_v<ReturnType>) {
+                ReturnType* ReturnSlot = reinterpret_cast<ReturnType*>(Data + FunctionArgs.ReturnValueOffset);
+                *Out = std::move(*ReturnSlot);
+                ++Out;
+
+                if constexpr (!std::is_trivially_destructible_v<ReturnType>)
+                    ReturnSlot->~ReturnType();
+            }
+
+            DestroyParms<NumArgs, Args...>(Data, FunctionArgs);
+        }
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    template <typename OutputIt>
+    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::CallBatchAuto(std::span<UObject* const> Objects, OutputIt Out, Args... args)
+    {
+        CallBatch(Objects, FindFunction(), Out, std::forward<Args>(args)...);
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    UFunction* PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::FindFunction()
     {
         static UFunction* Function = nullptr;
 
@@ -65,20 +180,88 @@ namespace SDK
             }
         });
 
-        return Call(Obj, Function, std::forward<Args>(args)...);
+        return Function;
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    auto PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::GetArgInfo(UFunction* Function) -> const FunctionArgInfo<sizeof...(Args)>&
+    {
+        using PlanType = FunctionArgInfo<sizeof...(Args)>;
+
+        // Plans depend on the argument types and the UFunction, so each instantiation keeps one per UFunction it was called with.
+        // Nearly every wrapper only ever calls one, that one is published for lock-free lookup.
+        // Plans of a UFunction that was garbage collected and its address reused are replaced, and retired rather than freed
+        // since a call on another thread may still be using them.
+        static std::atomic<const PlanType*> FirstPlan = nullptr;
+        static std::shared_mutex PlansMutex;
+        static std::unordered_map<const UFunction*, std::unique_ptr<PlanType>> Plans;
+        static std::vector<std::unique_ptr<PlanType>> RetiredPlans;
+
+        auto IsCurrent = [Function](const PlanType& Plan) {
+            return FFunctionLayoutCache::IsCurrent(Function, Plan.ObjectIndex, Plan.SerialNumber);
+        };
+
+        const PlanType* First = FirstPlan.load(std::memory_order_acquire);
+        if (First && First->Function == Function && IsCurrent(*First))
+            return *First;
+
+        {
+            std::shared_lock Lock(PlansMutex);
+            if (auto It = Plans.find(Function); It != Plans.end() && IsCurrent(*It->second))
+                return *It->second;
+        }
+
+        auto Plan = std::make_unique<PlanType>();
+        InitializeArgInfo(Function, *Plan);
+
+        std::unique_lock Lock(PlansMutex);
+        auto [It, Inserted] = Plans.try_emplace(Function, std::move(Plan));
+        if (!Inserted && !IsCurrent(*It->second)) {
+            RetiredPlans.push_back(std::move(It->second));
+            It->second = std::move(Plan);
+        }
+
+        // The first plan is replaced along with its function, a wrapper keeps a single hot UFunction after it was reloaded.
+        const PlanType* Expected = FirstPlan.load(std::memory_order_relaxed);
+        if (!Expected || Expected->Function == Function)
+            FirstPlan.store(It->second.get(), std::memory_order_release);
+
+        return *It->second;
     }
 
     template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
     template <size_t N>
-    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::WriteInputArgs(uint8_t* Parms, FunctionArgInfo<N>& FunctionArgs, Args&&... args, UFunction* Function)
+    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::WriteInputArgs(uint8_t* Parms, const FunctionArgInfo<N>& FunctionArgs, Args&&... args)
     {
-        auto WriteInputArg = [Parms, Function](auto& Arg, ArgInfo& Info) {
+        // Sizes and qualifiers were validated by BuildMarshalPlan, only the writes are left. Info.Write is the same on every call
+        // with this plan, so its tests predict perfectly. The null test on pointers is the only one that depends on the call.
+        auto WriteInputArg = [Parms](auto& Arg, const ArgInfo& Info) {
             using ArgType = std::decay_t<decltype(Arg)>;
-            if constexpr (std::is_trivially_copyable_v<ArgType>) {
-                if (sizeof(ArgType) < Info.Size)
-                    throw std::invalid_argument("Not enough room in trivially copyable struct! Increase struct size: '" + Function->GetFullName() + "\'");
-
-                std::memcpy(Parms + Info.Offset, &Arg, std::min<size_t>(sizeof(ArgType), Info.Size));
+            if constexpr (std::is_pointer_v<ArgType>) {
+                using PointeeType = std::remove_cv_t<std::remove_pointer_t<ArgType>>;
+                if constexpr (std::is_trivially_copyable_v<PointeeType>) {
+                    // Selected rather than branched on, a null pointee leaves the slot to the zero fill.
+                    const void* Source = Info.Write == EArgWrite::Value ? static_cast<const void*>(&Arg) : static_cast<const void*>(Arg);
+                    if (Source)
+                        std::memcpy(Parms + Info.Offset, Source, Info.CopySize);
+                }
+                else if (Info.Write == EArgWrite::Value) {
+                    std::memcpy(Parms + Info.Offset, &Arg, Info.CopySize);
+                }
+                else if (Arg) {
+                    new (Parms + Info.Offset) PointeeType(*Arg);
+                }
+            }
+            else if constexpr (std::is_trivially_copyable_v<ArgType>) {
+                std::memcpy(Parms + Info.Offset, &Arg, Info.CopySize);
+            }
+            else if constexpr (std::is_same_v<ArgType, FString>) {
+                // Input-only strings are only read by the engine and destroyed by DestroyParms, so they can live in scratch memory.
+                FString* Slot = new (Parms + Info.Offset) FString();
+                if (Info.Write == EArgWrite::ScratchString)
+                    Slot->CopyFromScratch(Arg);
+                else
+                    *Slot = Arg;
             }
             else {
                 new (Parms + Info.Offset) ArgType(std::forward<decltype(Arg)>(Arg));
@@ -91,104 +274,63 @@ namespace SDK
 
     template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
     template <size_t N>
-    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::WriteOutputArgs(uint8_t* Parms, FunctionArgInfo<N>& FunctionArgs, Args&&... args, UFunction* Function)
+    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::WriteOutputArgs(uint8_t* Parms, const FunctionArgInfo<N>& FunctionArgs, Args&&... args)
     {
-        auto WriteOutputArg = [Parms, Function](auto& Arg, ArgInfo& Info) {
+        if (!FunctionArgs.HasOutParms)
+            return;
+
+        // Argument types that can never be outputs compile to nothing, BuildMarshalPlan already rejected them as out parameters.
+        auto WriteOutputArg = [Parms](auto& Arg, const ArgInfo& Info) {
             using RawArgDecl = decltype(Arg);
             using ArgNoRef = std::remove_reference_t<RawArgDecl>;
-            using PointeeType = std::remove_pointer_t<ArgNoRef>;
 
-            // Pointer output parameters take priority
-            if constexpr (std::is_pointer_v<ArgNoRef>) {
-                if constexpr (std::is_const_v<PointeeType>) {
-                    throw std::invalid_argument("Mismatched argument qualifiers: '" + Function->GetFullName() + "' Output pointer cannot be const!");
-                }
-                else {
-                    if (!Arg)
-                        return; // Nothing to write to, ignore
-
-                    // Simple and fast memcpy for trivially copyable
-                    if constexpr (std::is_trivially_copyable_v<PointeeType>) {
-                        if (sizeof(PointeeType) < Info.Size)
-                            throw std::invalid_argument("Not enough room in trivially copyable struct! Increase struct size: '" + Function->GetFullName() + '\'');
-
-                        std::memcpy(reinterpret_cast<void*>(Arg), Parms + Info.Offset, std::min<size_t>(sizeof(PointeeType), Info.Size));
-                    }
-                    else {
-                        // Assignment operator for non trivialy copyable
-                        PointeeType* SrcPtr = reinterpret_cast<PointeeType*>(Parms + Info.Offset);
-                        if constexpr (std::is_assignable_v<PointeeType&, PointeeType>) {
-                            *Arg = *SrcPtr;
-                        }
-                        else {
-                            throw std::invalid_argument("Unsupported out-parameter type for function '" + Function->GetFullName() + "': non-trivial pointee is not assignable or move-assignable");
-                        }
-                    }
-                }
-            }
-            // Lvalue output parameters
-            else if constexpr (std::is_lvalue_reference_v<RawArgDecl>) {
-                using RefT = std::remove_reference_t<RawArgDecl>;
+            if constexpr (is_writable_pointer<ArgNoRef>::value) {
+                using PointeeType = std::remove_pointer_t<ArgNoRef>;
+                if (!Info.IsOutParm || !Arg)
+                    return;
 
-                if constexpr (std::is_const_v<RefT>) {
-                    throw std::invalid_argument("Mismatched argument qualifiers: '" + Function->GetFullName() + "' Output lvalue reference cannot be const!");
-                }
-                else {
-                    if constexpr (std::is_trivially_copyable_v<RefT>) {
-                        std::memcpy(reinterpret_cast<void*>(std::addressof(Arg)), Parms + Info.Offset, std::min<size_t>(sizeof(RefT), Info.Size));
-                    }
-                    else {
-                        RefT* srcPtr = reinterpret_cast<RefT*>(Parms + Info.Offset);
-                        if constexpr (std::is_assignable_v<RefT&, RefT>) {
-                            Arg = *srcPtr;
-                        }
-                        else {
-                            throw std::invalid_argument("Unsupported out-parameter type for function '" + Function->GetFullName() + "': non-trivial reference is not assignable or move-assignable");
-                        }
-                    }
-                }
+                if constexpr (std::is_trivially_copyable_v<PointeeType>)
+                    std::memcpy(reinterpret_cast<void*>(Arg), Parms + Info.Offset, Info.CopySize);
+                else if constexpr (std::is_assignable_v<PointeeType&, PointeeType>)
+                    *Arg = *reinterpret_cast<PointeeType*>(Parms + Info.Offset);
             }
-            // Invalid
-            else {
-                throw std::invalid_argument("Mismatched argument type: '" + Function->GetFullName() + "' Output argument must be lvalue reference or pointer!");
+            else if constexpr (!std::is_pointer_v<ArgNoRef> && !std::is_const_v<ArgNoRef>) {
+                if (!Info.IsOutParm)
+                    return;
+
+                if constexpr (std::is_trivially_copyable_v<ArgNoRef>)
+                    std::memcpy(reinterpret_cast<void*>(std::addressof(Arg)), Parms + Info.Offset, Info.CopySize);
+                else if constexpr (std::is_assignable_v<ArgNoRef&, ArgNoRef>)
+                    Arg = *reinterpret_cast<ArgNoRef*>(Parms + Info.Offset);
             }
         };
 
         size_t ArgIndex = 0;
-        ((FunctionArgs.ArgOffsets[ArgIndex].IsOutParm ? WriteOutputArg(args, FunctionArgs.ArgOffsets[ArgIndex]) : void(), ++ArgIndex), ...);
+        ((std::is_lvalue_reference_v<Args> || std::is_pointer_v<std::remove_reference_t<Args>> ? WriteOutputArg(args, FunctionArgs.ArgOffsets[ArgIndex]) : void(), ++ArgIndex), ...);
     }
 
     template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
     template <typename Param>
     void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::DestroyParamSlot(uint8_t* ParmsBase, const ArgInfo& Info)
     {
-        using RawDecl = std::remove_reference_t<Param>;
+        using Decayed = std::decay_t<Param>;
 
-        uint8_t* Addr = ParmsBase + Info.Offset;
-        if (Info.IsOutParm) {
-            if constexpr (std::is_pointer_v<RawDecl>) {
-                using Pointee = std::remove_pointer_t<RawDecl>;
-                if constexpr (!std::is_trivially_destructible_v<Pointee> && std::is_destructible_v<Pointee>) {
-                    reinterpret_cast<Pointee*>(Addr)->~Pointee();
-                }
-            }
-            else {
-                if constexpr (!std::is_trivially_destructible_v<RawDecl> && std::is_destructible_v<RawDecl>) {
-                    reinterpret_cast<RawDecl*>(Addr)->~RawDecl();
-                }
-            }
+        // Pointer slots hold a copy of the pointee, or zeroes if the pointer was null. Object parameters hold the pointer itself.
+        using SlotType = std::conditional_t<std::is_pointer_v<Decayed>, std::remove_cv_t<std::remove_pointer_t<Decayed>>, Decayed>;
+
+        if constexpr (std::is_pointer_v<Decayed>) {
+            if (Info.Write == EArgWrite::Value)
+                return;
         }
-        else {
-            using Decayed = std::decay_t<Param>;
-            if constexpr (!std::is_trivially_destructible_v<Decayed> && std::is_destructible_v<Decayed>) {
-                reinterpret_cast<Decayed*>(Addr)->~Decayed();
-            }
+
+        if constexpr (!std::is_trivially_destructible_v<SlotType> && std::is_destructible_v<SlotType>) {
+            reinterpret_cast<SlotType*>(ParmsBase + Info.Offset)->~SlotType();
         }
     }
 
     template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
     template <size_t N, typename... ParamTypes, size_t... I>
-    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::DestroyParmsImpl(uint8_t* ParmsBase, FunctionArgInfo<N>& FunctionArgs, std::index_sequence<I...>)
+    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::DestroyParmsImpl(uint8_t* ParmsBase, const FunctionArgInfo<N>& FunctionArgs, std::index_sequence<I...>)
     {
         // Call DestroyParamSlot for each parameter in the pack
         (DestroyParamSlot<ParamTypes>(ParmsBase, FunctionArgs.ArgOffsets[I]), ...);
@@ -196,7 +338,7 @@ namespace SDK
 
     template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
     template <size_t N, typename... ParamTypes>
-    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::DestroyParms(uint8_t* ParmsBase, FunctionArgInfo<N>& FunctionArgs)
+    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::DestroyParms(uint8_t* ParmsBase, const FunctionArgInfo<N>& FunctionArgs)
     {
         static_assert(sizeof...(ParamTypes) == N, "DestroyParms parameter count mismatch");
 
@@ -212,42 +354,141 @@ namespace SDK
     {
         static_assert(sizeof...(Args) == N, "Number of template Args must match the function parameter count");
 
-        FunctionArgs.ParmsSize = Function->ParmsSize;
-        FunctionArgs.ReturnValueOffset = Function->ReturnValueOffset;
-        FunctionArgs.HasReturnValue = FunctionArgs.ReturnValueOffset != UINT16_MAX;
-
-        int ArgIndex = 0;
-        if (State::UsesFProperty) {
-            for (FField* Field = Function->ChildProperties; Field; Field = Field->Next) {
-                if (!Field->HasTypeFlag(CASTCLASS_FProperty))
-                    continue;
-
-                FProperty* Property = static_cast<FProperty*>(Field);
-                if (Property->HasPropertyFlag(CPF_ReturnParm)) {
-                    if (Property->Offset == FunctionArgs.ReturnValueOffset)
-                        FunctionArgs.ReturnValueSize = Property->ElementSize;
-                    continue;
-                }
+        const FFunctionLayout& Layout = FFunctionLayoutCache::Get(Function);
+
+        FunctionArgs.Function = Function;
+        FunctionArgs.ObjectIndex = Layout.ObjectIndex;
+        FunctionArgs.SerialNumber = Layout.SerialNumber;
+        FunctionArgs.ParmsSize = Layout.ParmsSize;
+        FunctionArgs.HasReturnValue = Layout.HasReturnValue;
+        FunctionArgs.ReturnValueOffset = Layout.ReturnValue.Offset;
+        FunctionArgs.ReturnValueSize = Layout.ReturnValue.Size;
+
+        const size_t NumParams = Layout.Params.size();
+        for (size_t i = 0; i < std::min(NumParams, N); i++) {
+            ArgInfo& Info = FunctionArgs.ArgOffsets[i];
+            Info.Offset = Layout.Params[i].Offset;
+            Info.Size = Layout.Params[i].Size;
+            Info.IsOutParm = Layout.Params[i].IsOutParm();
+            FunctionArgs.HasOutParms |= Info.IsOutParm;
+
+            // What a pointer argument would pass, PlanArg settles the op for the actual argument type.
+            const bool IsObjectParam = Layout.Params[i].CastFlags & (CASTCLASS_FObjectProperty | CASTCLASS_FClassProperty | CASTCLASS_FInterfaceProperty);
+            Info.Write = Info.IsOutParm || !IsObjectParam ? EArgWrite::Pointee : EArgWrite::Value;
+        }
+
+        if (NumParams != N)
+            throw std::invalid_argument("Mismatched argument count: '" + Function->GetFullName() + "' expects " + std::to_string(NumParams) + " arguments, " + std::to_string(N) + " passed");
+
+        if constexpr (!std::is_void_v<ReturnType>) {
+            if (!FunctionArgs.HasReturnValue)
+                throw std::logic_error("Mismatched return type: '" + Function->GetFullName() + "' expects no return value, but template specifies non-void return type");
+        }
+
+        BuildMarshalPlan(Function, FunctionArgs, std::make_index_sequence<N> {});
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    template <typename Param>
+    int32_t PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::PlanArg(const UFunction* Function, ArgInfo& Info)
+    {
+        using ArgNoRef = std::remove_reference_t<Param>;
+        using Decayed = std::decay_t<Param>;
 
-                FunctionArgs.ArgOffsets[ArgIndex] = { Property->Offset, Property->ElementSize, Property->HasPropertyFlag(CPF_OutParm) };
-                ArgIndex++;
+        // Pointers pass their pointee, which may be null, so their slot is left to the zero fill.
+        constexpr bool IsPointer = std::is_pointer_v<Decayed>;
+        using ValueType = std::conditional_t<IsPointer, std::remove_cv_t<std::remove_pointer_t<Decayed>>, Decayed>;
+
+        // Only pointers can pass a pointee, and only input strings go to scratch memory.
+        if constexpr (!IsPointer)
+            Info.Write = std::is_same_v<Decayed, FString> && !Info.IsOutParm ? EArgWrite::ScratchString : EArgWrite::Value;
+
+        // Input object parameters take the pointer value itself, written on every call.
+        if constexpr (IsPointer) {
+            if (Info.Write == EArgWrite::Value) {
+                if (sizeof(Decayed) < static_cast<size_t>(Info.Size))
+                    throw std::invalid_argument("Pointer argument is smaller than its object parameter: '" + Function->GetFullName() + '\'');
+
+                Info.CopySize = Info.Size;
+                return Info.Size;
             }
         }
-        else {
-            for (UField* Child = Function->Children; Child; Child = Child->Next) {
-                if (!Child->HasTypeFlag(CASTCLASS_FProperty))
-                    continue;
-
-                UProperty* Property = static_cast<UProperty*>(Child);
-                if (Property->HasPropertyFlag(CPF_ReturnParm)) {
-                    if (Property->Offset == FunctionArgs.ReturnValueOffset)
-                        FunctionArgs.ReturnValueSize = Property->ElementSize;
-                    continue;
-                }
 
-                FunctionArgs.ArgOffsets[ArgIndex] = { Property->Offset, Property->ElementSize, Property->HasPropertyFlag(CPF_OutParm) };
-                ArgIndex++;
+        if (Info.IsOutParm) {
+            if constexpr (IsPointer) {
+                if constexpr (!is_writable_pointer<Decayed>::value)
+                    throw std::invalid_argument("Mismatched argument qualifiers: '" + Function->GetFullName() + "' Output pointer cannot be const!");
+            }
+            else if constexpr (!std::is_lvalue_reference_v<Param>) {
+                throw std::invalid_argument("Mismatched argument type: '" + Function->GetFullName() + "' Output argument must be lvalue reference or pointer!");
             }
+            else if constexpr (std::is_const_v<ArgNoRef>) {
+                throw std::invalid_argument("Mismatched argument qualifiers: '" + Function->GetFullName() + "' Output lvalue reference cannot be const!");
+            }
+
+            if constexpr (!std::is_trivially_copyable_v<ValueType> && !std::is_assignable_v<ValueType&, ValueType>)
+                throw std::invalid_argument("Unsupported out-parameter type for function '" + Function->GetFullName() + "': non-trivial type is not assignable or move-assignable");
+        }
+
+        if constexpr (std::is_trivially_copyable_v<ValueType>) {
+            if (sizeof(ValueType) < static_cast<size_t>(Info.Size))
+                throw std::invalid_argument("Not enough room in trivially copyable struct! Increase struct size: '" + Function->GetFullName() + '\'');
+
+            Info.CopySize = Info.Size;
+            return IsPointer ? 0 : Info.Size;
         }
+        else {
+            if (sizeof(ValueType) > static_cast<size_t>(Info.Size))
+                throw std::invalid_argument("Argument type is bigger than its parameter: '" + Function->GetFullName() + '\'');
+
+            return IsPointer ? 0 : static_cast<int32_t>(sizeof(ValueType));
+        }
+    }
+
+    template <StringLiteral ClassName, StringLiteral FunctionName, typename ReturnType, typename... Args>
+    template <size_t N, size_t... I>
+    void PECallWrapperImpl<ClassName, FunctionName, ReturnType, Args...>::BuildMarshalPlan(const UFunction* Function, FunctionArgInfo<N>& FunctionArgs, std::index_sequence<I...>)
+    {
+        // Bytes written by each argument on every call, anything else is zero filled.
+        std::array<ZeroRange, N + 1> Written = {};
+        size_t NumWritten = 0;
+
+        auto AddWritten = [&](int32_t Offset, int32_t Size) {
+            if (Size <= 0)
+                return;
+
+            // Insertion sort by offset, N is the argument count.
+            size_t Index = NumWritten++;
+            for (; Index > 0 && Written[Index - 1].Offset > Offset; Index--)
+                Written[Index] = Written[Index - 1];
+
+            Written[Index] = { Offset, Size };
+        };
+
+        (AddWritten(FunctionArgs.ArgOffsets[I].Offset, PlanArg<Args>(Function, FunctionArgs.ArgOffsets[I])), ...);
+
+        const int32_t ParmsSize = static_cast<int32_t>(FunctionArgs.ParmsSize);
+        auto BuildGaps = [&](std::array<ZeroRange, N + 2>& OutRanges, int32_t& OutNum) {
+            OutNum = 0;
+
+            int32_t Cursor = 0;
+            for (size_t i = 0; i < NumWritten; i++) {
+                if (Written[i].Offset > Cursor)
+                    OutRanges[OutNum++] = { Cursor, Written[i].Offset - Cursor };
+
+                Cursor = std::max(Cursor, Written[i].Offset + Written[i].Size);
+            }
+
+            if (Cursor < ParmsSize)
+                OutRanges[OutNum++] = { Cursor, ParmsSize - Cursor };
+        };
+
+        BuildGaps(FunctionArgs.ZeroRanges, FunctionArgs.NumZeroRanges);
+
+        // A return value that isn't destroyed after being read is overwritten by every call, so batches only clear it once.
+        if constexpr (!std::is_void_v<ReturnType> && std::is_trivially_destructible_v<ReturnType>)
+            AddWritten(FunctionArgs.ReturnValueOffset, FunctionArgs.ReturnValueSize);
+
+        BuildGaps(FunctionArgs.BatchZeroRanges, FunctionArgs.NumBatchZeroRanges);
     }
 }
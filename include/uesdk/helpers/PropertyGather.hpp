@@ -0,0 +1,98 @@
+#pragma once
+#include <uesdk/helpers/PropertyInfo.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace SDK
+{
+    class UObject;
+
+    /** @brief Timings of one gather, objects are processed in batches of kGatherBatchSize. */
+    struct FGatherStats
+    {
+        uint64_t Objects = 0;
+        // Objects that were null, or whose path crossed a null object pointer. Their output is Default.
+        uint64_t Skipped = 0;
+
+        uint32_t Batches = 0;
+        double TotalNs = 0.0;
+        double MinBatchNs = 0.0;
+        double MaxBatchNs = 0.0;
+    };
+
+    constexpr size_t kGatherBatchSize = 4096;
+
+    // How many objects ahead of the current one are prefetched.
+    constexpr size_t kGatherPrefetchDistance = 8;
+
+    /**
+     * @brief Reads one property from many objects into a contiguous array, prefetching object memory ahead of the reads.
+     * @brief Bit-field properties are gathered as 0 or 1, into bool or uint8_t.
+     *
+     * @tparam T - Output element type, must be the same size as the property unless it's a bit-field.
+     * @param[in] Objects - Objects to read from, null objects are skipped.
+     * @param[in] Property - Property of the objects' class, e.g. from UStruct::FindProperty or FSProperty.
+     * @param[out] Out - One element per object, in the same order.
+     * @param[in] Default - Written for skipped objects.
+     * @param[out] Stats - Optional timings, only measured if not null.
+     *
+     * @throws std::invalid_argument - If the property wasn't found, T doesn't match it or Out is smaller than Objects.
+     */
+    template <typename T>
+    void GatherProperty(std::span<UObject* const> Objects, const PropertyInfo& Property, std::span<T> Out, T Default = {}, FGatherStats* Stats = nullptr);
+
+    /**
+     * @brief GatherProperty through a chain of properties, e.g. { RootComponent, RelativeLocation }.
+     * @brief Object properties in the path are followed, struct properties are read inline. The last property is gathered.
+     *
+     * @param[in] Path - Properties from the objects' class to the gathered property, each a member of the previous one's type.
+     *
+     * @throws std::invalid_argument - If the path is empty, a property wasn't found, a non-last property is neither an object nor a struct
+     * @throws property, T doesn't match the last property or Out is smaller than Objects.
+     */
+    template <typename T>
+    void GatherPropertyPath(
+        std::span<UObject* const> Objects, std::span<const PropertyInfo> Path, std::span<T> Out, T Default = {}, FGatherStats* Stats = nullptr);
+}
+
+namespace SDK::Gather
+{
+    // One step of a compiled path: add Offset, then load a pointer if Deref.
+    struct FPathStep
+    {
+        int32_t Offset = 0;
+        bool Deref = false;
+    };
+
+    // A path with adjacent inline offsets merged. The gathered value is at Resolve(Obj) + FinalOffset.
+    struct FCompiledPath
+    {
+        std::vector<FPathStep> Steps;
+        int32_t FinalOffset = 0;
+        int32_t ElementSize = 0;
+        uint8_t ByteMask = 0;
+    };
+
+    FCompiledPath CompilePath(std::span<const PropertyInfo> Path);
+
+    void CheckGather(const PropertyInfo& Property, size_t ValueSize, bool IsFlag, size_t NumObjects, size_t NumOut);
+
+    // Collects per-batch timings, does nothing if Stats is null.
+    class FStatsRecorder
+    {
+    public:
+        explicit FStatsRecorder(FGatherStats* Stats);
+
+    public:
+        void BeginBatch();
+        void EndBatch(size_t Objects, size_t Skipped);
+
+    private:
+        FGatherStats* m_Stats;
+        int64_t m_BatchStart = 0;
+    };
+}
+
+#include <uesdk/helpers/PropertyGather.inl>
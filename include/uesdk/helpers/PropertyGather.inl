@@ -0,0 +1,137 @@
+#pragma once
+#include <uesdk/helpers/PropertyGather.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <xmmintrin.h>
+
+namespace SDK::Gather
+{
+    template <typename T>
+    constexpr bool kIsFlagType = std::is_same_v<T, bool> || std::is_same_v<T, uint8_t>;
+
+    // Prefetching never faults, so the address may be computed from a null or stale object.
+    inline void Prefetch(const void* Base, int32_t Offset)
+    {
+        _mm_prefetch(reinterpret_cast<const char*>(reinterpret_cast<uintptr_t>(Base) + Offset), _MM_HINT_T0);
+    }
+
+    template <typename T>
+    inline T ReadValue(const uint8_t* Address, uint8_t ByteMask)
+    {
+        if constexpr (kIsFlagType<T>) {
+            if (ByteMask)
+                return static_cast<T>((*Address & ByteMask) != 0);
+        }
+
+        T Value;
+        std::memcpy(&Value, Address, sizeof(T));
+        return Value;
+    }
+
+    // Follows the path's steps from Obj, returning null if any object pointer on the way is null.
+    inline const uint8_t* Resolve(const FCompiledPath& Path, const uint8_t* Obj)
+    {
+        for (const FPathStep& Step : Path.Steps) {
+            if (!Obj)
+                return nullptr;
+
+            Obj += Step.Offset;
+            if (Step.Deref)
+                Obj = *reinterpret_cast<const uint8_t* const*>(Obj);
+        }
+
+        return Obj;
+    }
+}
+
+namespace SDK
+{
+    template <typename T>
+    void GatherProperty(std::span<UObject* const> Objects, const PropertyInfo& Property, std::span<T> Out, T Default, FGatherStats* Stats)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Gathered type must be trivially copyable.");
+
+        Gather::CheckGather(Property, sizeof(T), Gather::kIsFlagType<T>, Objects.size(), Out.size());
+
+        const int32_t Offset = Property.Offset;
+        const uint8_t ByteMask = Property.ByteMask;
+        Gather::FStatsRecorder Recorder(Stats);
+
+        for (size_t Begin = 0; Begin < Objects.size(); Begin += kGatherBatchSize) {
+            const size_t End = std::min(Begin + kGatherBatchSize, Objects.size());
+            size_t Skipped = 0;
+
+            Recorder.BeginBatch();
+
+            for (size_t i = Begin; i < End; i++) {
+                if (i + kGatherPrefetchDistance < Objects.size())
+                    Gather::Prefetch(Objects[i + kGatherPrefetchDistance], Offset);
+
+                const uint8_t* Obj = reinterpret_cast<const uint8_t*>(Objects[i]);
+                if (!Obj) {
+                    Out[i] = Default;
+                    Skipped++;
+                    continue;
+                }
+
+                Out[i] = Gather::ReadValue<T>(Obj + Offset, ByteMask);
+            }
+
+            Recorder.EndBatch(End - Begin, Skipped);
+        }
+    }
+
+    template <typename T>
+    void GatherPropertyPath(std::span<UObject* const> Objects, std::span<const PropertyInfo> Path, std::span<T> Out, T Default, FGatherStats* Stats)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Gathered type must be trivially copyable.");
+
+        const Gather::FCompiledPath Compiled = Gather::CompilePath(Path);
+        if (Compiled.Steps.empty()) {
+            // Only structs lead to the value, it sits at their summed offset in the object itself.
+            PropertyInfo Flattened = Path.back();
+            Flattened.Offset = Compiled.FinalOffset;
+            Flattened.ByteMask = Compiled.ByteMask;
+            GatherProperty(Objects, Flattened, Out, Default, Stats);
+            return;
+        }
+
+        Gather::CheckGather(Path.back(), sizeof(T), Gather::kIsFlagType<T>, Objects.size(), Out.size());
+
+        // The first pointer of every object is prefetched kGatherPrefetchDistance ahead. Halfway there it has arrived,
+        // so the path is resolved and the final value prefetched.
+        constexpr size_t kResolveDistance = kGatherPrefetchDistance / 2;
+        const int32_t FirstOffset = Compiled.Steps.front().Offset;
+        Gather::FStatsRecorder Recorder(Stats);
+
+        for (size_t Begin = 0; Begin < Objects.size(); Begin += kGatherBatchSize) {
+            const size_t End = std::min(Begin + kGatherBatchSize, Objects.size());
+            size_t Skipped = 0;
+
+            Recorder.BeginBatch();
+
+            for (size_t i = Begin; i < End; i++) {
+                if (i + kGatherPrefetchDistance < Objects.size())
+                    Gather::Prefetch(Objects[i + kGatherPrefetchDistance], FirstOffset);
+
+                if (i + kResolveDistance < Objects.size()) {
+                    if (const uint8_t* Ahead = Gather::Resolve(Compiled, reinterpret_cast<const uint8_t*>(Objects[i + kResolveDistance])))
+                        Gather::Prefetch(Ahead, Compiled.FinalOffset);
+                }
+
+                const uint8_t* Target = Gather::Resolve(Compiled, reinterpret_cast<const uint8_t*>(Objects[i]));
+                if (!Target) {
+                    Out[i] = Default;
+                    Skipped++;
+                    continue;
+                }
+
+                Out[i] = Gather::ReadValue<T>(Target + Compiled.FinalOffset, Compiled.ByteMask);
+            }
+
+            Recorder.EndBatch(End - Begin, Skipped);
+        }
+    }
+}
@@ -10,6 +10,7 @@ namespace SDK
     {
         bool Found = false;
         int32_t Offset = 0;
+        int32_t ElementSize = 0;
         uint8_t ByteMask = 0;
         uint64_t Flags = 0;
         union
@@ -0,0 +1,134 @@
+#pragma once
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/PropertyInfo.hpp>
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace SDK
+{
+    /**
+     * @brief Watches properties of every instance of some classes, reporting only the values that changed since the previous Capture.
+     * @brief Watched values are copied into two columnar buffers, one per frame, which are compared 16 bytes at a time.
+     * @brief The cost of a Capture is proportional to the bytes watched, not to the number of properties or classes.
+     * @brief Bit-field columns are stored as one byte per object, holding 0 or 1.
+     */
+    class FPropertySnapshot
+    {
+    public:
+        /** @brief One changed value, identified by watch set, column and row. Rows index GetObjects(Set). */
+        struct FChange
+        {
+            int32_t Set;
+            int32_t Column;
+            int32_t Row;
+        };
+
+    private:
+        struct FColumn
+        {
+            FName Name;
+            int32_t Offset = 0;
+            int32_t ElementSize = 0; // Bytes per row, ElementSize * ArrayDim of the property.
+            uint8_t ByteMask = 0;
+            // Indexed by frame, each holds one element per row.
+            std::vector<uint8_t> Data[2];
+        };
+
+        struct FSet
+        {
+            UClass* Class = nullptr;
+            std::vector<FColumn> Columns;
+
+            std::vector<UObject*> Objects;
+            std::vector<int32_t> ObjectIndices;
+            // GObjects serial numbers at RefreshObjects, a changed one means the slot now holds another object. 0 if the engine hadn't
+            // assigned one yet, Capture adopts it once it has.
+            std::vector<int32_t> SerialNumbers;
+            // Rows added by the last RefreshObjects, every column of them is reported by the next Capture.
+            std::vector<int32_t> NewRows;
+        };
+
+    public:
+        FPropertySnapshot() = default;
+
+    public:
+        /**
+         * @brief Watches properties of a class and its subclasses. The properties may be declared by the class or any of its supers.
+         *
+         * @param[in] Class - Target UClass.
+         * @param[in] Properties - Names of the properties to watch.
+         *
+         * @return The index of the new watch set.
+         *
+         * @throws std::invalid_argument - If the class is invalid or a property wasn't found.
+         */
+        int32_t Watch(UClass* Class, const std::vector<std::string>& Properties);
+
+        /**
+         * @brief Rescans GObjects for instances of the watched classes. Objects that are still alive keep their previous values.
+         * @brief Objects are matched by GObjects index and serial number. One without a serial number can't be told apart from a new object
+         * @brief at the same address, so it is treated as new and all its columns are reported by the next Capture.
+         * @brief Call this whenever objects may have been created or destroyed, Capture never picks up new objects by itself.
+         */
+        void RefreshObjects();
+
+        /**
+         * @brief Copies every watched value and compares it with the previous Capture.
+         * @brief Objects destroyed since RefreshObjects are detected through GObjects and keep their previous values.
+         *
+         * @return The changes, ordered by set, column and row. Valid until the next Capture.
+         */
+        const std::vector<FChange>& Capture();
+
+    public:
+        inline int32_t NumSets() const { return static_cast<int32_t>(m_Sets.size()); }
+
+        inline const std::vector<FChange>& GetChanges() const { return m_Changes; }
+
+        /** @throws std::out_of_range - If Set is invalid. */
+        const std::vector<UObject*>& GetObjects(int32_t Set) const;
+
+        /** @return The index of the column in Set, or -1 if it isn't watched. */
+        int32_t FindColumn(int32_t Set, const FName& Name) const;
+
+        /**
+         * @brief Gets a typed view of a column as of the last Capture, one element per row.
+         *
+         * @tparam T - Column element type, must be the same size as the property, all of it for static arrays, e.g. std::array<float, 4>.
+         * @param[in] Set - Index of the watch set.
+         * @param[in] Column - Index of the column, in Watch order.
+         * @param[in] Previous - View the Capture before the last one instead. Rows added by the last RefreshObjects have no previous value.
+         *
+         * @throws std::out_of_range - If Set or Column is invalid.
+         * @throws std::invalid_argument - If T doesn't match the property size.
+         */
+        template <typename T>
+        std::span<const T> GetColumn(int32_t Set, int32_t Column, bool Previous = false) const
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "Column type must be trivially copyable.");
+
+            const FColumn& Target = GetColumnChecked(Set, Column);
+            if (sizeof(T) != static_cast<size_t>(Target.ElementSize))
+                throw std::invalid_argument("Column type size doesn't match the property size!");
+
+            const std::vector<uint8_t>& Data = Target.Data[Previous ? m_Frame ^ 1 : m_Frame];
+            return { reinterpret_cast<const T*>(Data.data()), m_Sets[Set].Objects.size() };
+        }
+
+    private:
+        const FColumn& GetColumnChecked(int32_t Set, int32_t Column) const;
+
+        void CaptureSet(int32_t SetIndex, FSet& Set);
+
+    private:
+        std::vector<FSet> m_Sets;
+        std::vector<FChange> m_Changes;
+
+        // Index of the buffer written by the last Capture.
+        uint32_t m_Frame = 0;
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <uesdk/core/UnrealObjects.hpp>
 #include <uesdk/helpers/PropertyInfo.hpp>
+#include <uesdk/helpers/ReflectionRegistry.hpp>
 
 #include <cstdint>
 
@@ -13,20 +14,16 @@
 public:                                                                                                                                       \
     static SDK::UClass* StaticClass()                                                                                                         \
     {                                                                                                                                         \
-        static SDK::UClass* Clss = nullptr;                                                                                                   \
-        if (!Clss)                                                                                                                            \
-            Clss = SDK::GObjects->FindObjectFast<SDK::UClass>(ClassNameStr, SDK::CASTCLASS_UClass);                                           \
-        return Clss;                                                                                                                          \
+        return _ClassDesc.Get();                                                                                                              \
     }                                                                                                                                         \
     static Type* GetDefaultObj()                                                                                                              \
     {                                                                                                                                         \
-        static Type* Default = nullptr;                                                                                                       \
-        if (!Default)                                                                                                                         \
-            Default = static_cast<Type*>(StaticClass()->ClassDefaultObject);                                                                  \
-        return Default;                                                                                                                       \
+        SDK::UClass* Clss = StaticClass();                                                                                                    \
+        return Clss ? static_cast<Type*>(Clss->ClassDefaultObject) : nullptr;                                                                 \
     }                                                                                                                                         \
                                                                                                                                               \
 private:                                                                                                                                      \
+    static inline SDK::Reflection::FReflectedClass _ClassDesc { ClassNameStr };                                                               \
     static void _CheckInheritance()                                                                                                           \
     {                                                                                                                                         \
         static_assert(std::is_base_of_v<SDK::UObject, Type>, "UESDK_UOBJECT can only be used on UObjects. Class must inherit from UObject."); \
@@ -47,11 +44,11 @@ private:
 public:                                                                                                         \
     static_assert(g_ClassName, "Use either UESDK_UOBJECT or UESDK_STRUCT at the start of class/struct");        \
                                                                                                                 \
+    static inline SDK::Reflection::FReflectedProperty _PropDesc_##Name { g_ClassName, #Name };                  \
+                                                                                                                \
     static SDK::PropertyInfo& _GetPropInfo_##Name(bool SuppressFailure = true)                                  \
     {                                                                                                           \
-        static SDK::PropertyInfo Prop = SDK::GObjects                                                           \
-                                            ->FindObjectFast<SDK::UStruct>(g_ClassName, SDK::CASTCLASS_UStruct) \
-                                            ->FindProperty(#Name);                                              \
+        SDK::PropertyInfo& Prop = _PropDesc_##Name.Get();                                                       \
         if (!SuppressFailure && !Prop.Found)                                                                    \
             throw std::runtime_error("Failed to get property!");                                                \
         return Prop;                                                                                            \
@@ -63,22 +60,26 @@ public:
     }
 
 /* @brief Standard macro for defining a UPROPERTY. Does not support bit-fields */
-#define UESDK_UPROPERTY(Type, Name)                                            \
-    UESDK_UPROPERTY_IMPL(Type, Name)                                           \
-                                                                               \
-    inline int& _PutProp_##Name(Type v)                                        \
-    {                                                                          \
-        const SDK::PropertyInfo& Prop = _GetPropInfo_##Name(false);            \
-        *reinterpret_cast<Type*>((uint8_t*)this + Prop.Offset) = std::move(v); \
-        return *reinterpret_cast<int*>((uint8_t*)this + Prop.Offset);          \
-    }                                                                          \
-                                                                               \
-    inline Type& _GetProp_##Name() const                                       \
-    {                                                                          \
-        const SDK::PropertyInfo& Prop = _GetPropInfo_##Name(false);            \
-        return *reinterpret_cast<Type*>((uint8_t*)this + Prop.Offset);         \
-    }                                                                          \
-                                                                               \
+#define UESDK_UPROPERTY(Type, Name)                                                  \
+    UESDK_UPROPERTY_IMPL(Type, Name)                                                 \
+                                                                                     \
+    inline int& _PutProp_##Name(Type v)                                              \
+    {                                                                                \
+        const SDK::Reflection::FPropertyOffset& Prop = _PropDesc_##Name.GetOffset(); \
+        if (!Prop.Found) [[unlikely]]                                                \
+            SDK::Reflection::ThrowPropertyNotFound(_PropDesc_##Name);                \
+        *reinterpret_cast<Type*>((uint8_t*)this + Prop.Offset) = std::move(v);       \
+        return *reinterpret_cast<int*>((uint8_t*)this + Prop.Offset);                \
+    }                                                                                \
+                                                                                     \
+    inline Type& _GetProp_##Name() const                                             \
+    {                                                                                \
+        const SDK::Reflection::FPropertyOffset& Prop = _PropDesc_##Name.GetOffset(); \
+        if (!Prop.Found) [[unlikely]]                                                \
+            SDK::Reflection::ThrowPropertyNotFound(_PropDesc_##Name);                \
+        return *reinterpret_cast<Type*>((uint8_t*)this + Prop.Offset);               \
+    }                                                                                \
+                                                                                     \
     __declspec(property(get = _GetProp_##Name, put = _PutProp_##Name)) Type Name
 
 /* @brief Macro for UPROPERTIES that are bit-fields with fallback to handling as a bool */
@@ -87,7 +88,9 @@ public:
                                                                                          \
     inline void _PutProp_##Name(bool v)                                                  \
     {                                                                                    \
-        const SDK::PropertyInfo& Prop = _GetPropInfo_##Name(false);                      \
+        const SDK::Reflection::FPropertyOffset& Prop = _PropDesc_##Name.GetOffset();     \
+        if (!Prop.Found) [[unlikely]]                                                    \
+            SDK::Reflection::ThrowPropertyNotFound(_PropDesc_##Name);                    \
         if (Prop.ByteMask) {                                                             \
             auto& ByteValue = *reinterpret_cast<uint8_t*>((uint8_t*)this + Prop.Offset); \
             ByteValue &= ~Prop.ByteMask;                                                 \
@@ -100,7 +103,9 @@ public:
                                                                                          \
     inline bool _GetProp_##Name() const                                                  \
     {                                                                                    \
-        const SDK::PropertyInfo& Prop = _GetPropInfo_##Name(false);                      \
+        const SDK::Reflection::FPropertyOffset& Prop = _PropDesc_##Name.GetOffset();     \
+        if (!Prop.Found) [[unlikely]]                                                    \
+            SDK::Reflection::ThrowPropertyNotFound(_PropDesc_##Name);                    \
         auto Value = *reinterpret_cast<uint8_t*>((uint8_t*)this + Prop.Offset);          \
         if (Prop.ByteMask)                                                               \
             return Value & Prop.ByteMask;                                                \
@@ -0,0 +1,158 @@
+#pragma once
+#include <uesdk/helpers/PropertyInfo.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+// Capacity of the sealed offset table, every UESDK_UPROPERTY and UObject::GetMember instantiation takes one entry.
+#ifndef UESDK_MAX_REFLECTED_PROPERTIES
+#define UESDK_MAX_REFLECTED_PROPERTIES 4096
+#endif
+
+namespace SDK
+{
+    class UClass;
+}
+
+/**
+ * @brief Descriptors behind UESDK_UOBJECT, UESDK_UPROPERTY and UObject::GetMember, internal use only.
+ * @brief Every descriptor registers itself during static initialization so ResolveAllReflected can find them all in one pass.
+ */
+namespace SDK::Reflection
+{
+    struct FRegistry;
+
+    /** @brief One entry of the offset table read by property accessors. */
+    struct FPropertyOffset
+    {
+        int32_t Offset = OFFSET_NOT_FOUND;
+        uint8_t ByteMask = 0;
+        bool Found = false;
+    };
+
+    constexpr uint32_t kMaxReflectedProperties = UESDK_MAX_REFLECTED_PROPERTIES;
+
+    // Written while resolving and by Seal, afterwards only read. Entries are assigned in registration order,
+    // so the properties of one class are usually next to each other.
+    alignas(64) inline FPropertyOffset g_PropertyOffsets[kMaxReflectedProperties];
+
+    // Plain on purpose, once sealed the accessors skip the acquire load and the call into Resolve. They still load this flag,
+    // their slot and its entry, and test Found, on every access: the compiler can't hoist those out of a loop, since the
+    // unsealed path in the same loop may write the table.
+    inline bool g_Sealed = false;
+
+    /** @brief The UClass of one UESDK_UOBJECT. */
+    class FReflectedClass
+    {
+    public:
+        explicit FReflectedClass(const char* ClassName);
+
+        FReflectedClass(const FReflectedClass&) = delete;
+        FReflectedClass& operator=(const FReflectedClass&) = delete;
+
+    public:
+        /**
+         * @brief Returns the class, searching GObjects on this thread if ResolveAllReflected didn't find it.
+         * @brief An unfound class is searched for again after the next ResolveAllReflected, until Seal.
+         */
+        inline UClass* Get()
+        {
+            if (!g_Sealed && !m_Resolved.load(std::memory_order_acquire)) [[unlikely]]
+                Resolve();
+            return m_Class;
+        }
+
+    public:
+        const char* const ClassName;
+
+    private:
+        void Resolve();
+
+    private:
+        friend struct FRegistry;
+
+        UClass* m_Class = nullptr;
+        std::atomic<bool> m_Resolved = false;
+        std::atomic<uint32_t> m_MissGeneration = 0; // ResolveAllReflected generation of the last lazy search that missed.
+    };
+
+    /** @brief The property info of one UESDK_UPROPERTY or UObject::GetMember instantiation. */
+    class FReflectedProperty
+    {
+    public:
+        /** @throws std::length_error - If more than UESDK_MAX_REFLECTED_PROPERTIES properties are registered. */
+        FReflectedProperty(const char* OwnerName, const char* PropertyName);
+
+        FReflectedProperty(const FReflectedProperty&) = delete;
+        FReflectedProperty& operator=(const FReflectedProperty&) = delete;
+
+    public:
+        /**
+         * @brief Returns the property info, searching GObjects on this thread if ResolveAllReflected didn't resolve it.
+         * @brief An unfound owner is searched for again after the next ResolveAllReflected. A property missing from a found owner stays unfound.
+         */
+        inline PropertyInfo& Get()
+        {
+            if (!g_Sealed && !m_Resolved.load(std::memory_order_acquire)) [[unlikely]]
+                Resolve();
+            return m_Info;
+        }
+
+        /** @brief Same as Get, reduced to what accessors need. After Seal this is a plain table load, without atomics or locks. */
+        inline const FPropertyOffset& GetOffset()
+        {
+            if (!g_Sealed && !m_Resolved.load(std::memory_order_acquire)) [[unlikely]]
+                Resolve();
+            return g_PropertyOffsets[Slot];
+        }
+
+    public:
+        const char* const OwnerName;
+        const char* const PropertyName;
+        const uint32_t Slot; // Index into g_PropertyOffsets.
+
+    private:
+        void Resolve();
+        void Publish(const PropertyInfo& Info);
+
+    private:
+        friend struct FRegistry;
+
+        PropertyInfo m_Info = {};
+        std::atomic<bool> m_Resolved = false;
+        std::atomic<uint32_t> m_MissGeneration = 0; // ResolveAllReflected generation of the last lazy search that missed.
+    };
+
+    /** @brief Shared by the accessors so the throw stays out of line. */
+    [[noreturn]] void ThrowPropertyNotFound(const FReflectedProperty& Property);
+}
+
+namespace SDK
+{
+    /**
+     * @brief Resolves every UESDK_UOBJECT class and UESDK_UPROPERTY offset in one parallel scan of GObjects (see FastSearchParallel).
+     * @brief Call after Init, afterwards the accessors no longer search on first use. Safe to call again, e.g. after more packages load,
+     * @brief only descriptors that are still unresolved are searched for.
+     * @brief Properties whose owning class or struct isn't loaded yet are left for a later call, or resolved lazily on first access.
+     * @brief A lazy search that misses isn't repeated until the next call of this function, so call it again once more packages load.
+     *
+     * @return If every registered class and property was found.
+     */
+    bool ResolveAllReflected();
+
+    /**
+     * @brief Ends initialization of reflected members: resolves everything still pending, then freezes the results.
+     * @brief Afterwards accessors read offsets straight from the offset table with no synchronization, and unfound classes or properties
+     * @brief are never searched for again. Descriptors registered later, e.g. by a module loaded after sealing, are resolved as they register.
+     * @brief Call once, before other threads use reflected accessors. Calls after the first do nothing and return false.
+     *
+     * @return If every registered class and property was found.
+     */
+    bool Seal();
+
+    /** @return If Seal has run. */
+    inline bool IsSealed()
+    {
+        return Reflection::g_Sealed;
+    }
+}
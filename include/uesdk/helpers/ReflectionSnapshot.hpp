@@ -0,0 +1,46 @@
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace SDK
+{
+    /**
+     * @brief Version of the reflection snapshot format, written in the header line and checked by tools/sdkgen.
+     *
+     * @brief The snapshot is UTF-8 text, one tab separated record per line. Records after a CLASS or STRUCT belong to it,
+     * @brief PARM records belong to the FUNC before them and VALUE records to the ENUM before them.
+     * @brief Flags are hexadecimal, everything else is decimal.
+     *
+     * @brief UESDK_SNAPSHOT  Version  UProperty|FProperty
+     * @brief CLASS|STRUCT    Package  Name  SuperName|-  PropertiesSize  MinAlignment
+     * @brief PROP            Name  TypeName  CastFlags  Offset  ElementSize  ArrayDim  ByteMask  PropertyFlags
+     * @brief FUNC            Name  FunctionFlags  ParmsSize  ReturnValueOffset
+     * @brief PARM            Same fields as PROP
+     * @brief ENUM            Package  Name
+     * @brief VALUE           Name  Value
+     */
+    constexpr uint32_t kReflectionSnapshotVersion = 1;
+
+    /**
+     * @brief Writes every loaded UClass, UScriptStruct and UEnum, with their properties and functions, as a reflection snapshot.
+     * @brief The snapshot is read by tools/sdkgen to generate static headers for this game build, without the game running.
+     * @brief Walks all of GObjects, expect this to take a while on large games.
+     *
+     * @param[out] Stream - Target stream, written in text mode.
+     *
+     * @throws std::logic_error - If the SDK isn't initialized.
+     */
+    void WriteReflectionSnapshot(std::ostream& Stream);
+
+    /**
+     * @brief WriteReflectionSnapshot to a file.
+     *
+     * @param[in] Path - Target file, overwritten if it exists.
+     *
+     * @return If the file was opened and fully written.
+     *
+     * @throws std::logic_error - If the SDK isn't initialized.
+     */
+    bool SaveReflectionSnapshot(const std::string& Path);
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace SDK
+{
+    /**
+     * @brief Buffered file writer with constant memory, for large text dumps.
+     * @brief Writes go into one of two fixed-size buffers. When it's full it's handed to a writer thread and the other one is filled,
+     * @brief so formatting and disk I/O overlap. Writing only blocks if the writer thread is still busy with the previous buffer.
+     * @brief Not thread safe, use one writer per producing thread.
+     */
+    class FStreamingWriter
+    {
+    public:
+        /**
+         * @param[in] Path - Target file, overwritten if it exists.
+         * @param[in] BufferSize - Size of each of the two buffers in bytes.
+         *
+         * @throws std::runtime_error - If the file can't be opened.
+         * @throws std::invalid_argument - If BufferSize is 0.
+         */
+        explicit FStreamingWriter(const std::string& Path, size_t BufferSize = 1 << 20);
+
+        /** @brief Closes the file, ignoring write errors. Call Close to handle them. */
+        ~FStreamingWriter();
+
+        FStreamingWriter(const FStreamingWriter&) = delete;
+        FStreamingWriter& operator=(const FStreamingWriter&) = delete;
+
+    public:
+        void Write(const void* Data, size_t Size);
+
+        inline void Write(std::string_view Text) { Write(Text.data(), Text.size()); }
+
+        inline void Write(char Char)
+        {
+            if (m_Used == m_BufferSize)
+                Submit();
+            m_Buffers[m_Active][m_Used++] = Char;
+        }
+
+        void WriteInt(int64_t Value);
+        void WriteUInt(uint64_t Value);
+        void WriteHex(uint64_t Value);
+        void WriteFloat(double Value);
+
+        /**
+         * @brief Writes the remaining data and closes the file. Later writes are ignored.
+         * @throws std::runtime_error - If any write to the file failed.
+         */
+        void Close();
+
+    public:
+        /** @return Bytes written so far, including buffered ones. */
+        inline uint64_t GetBytesWritten() const { return m_Submitted + m_Used; }
+
+        /** @return Seconds since the writer was opened, or between opening and Close once closed. */
+        double GetSeconds() const;
+
+        /** @return GetBytesWritten per GetSeconds, in MB (10^6 bytes) per second. */
+        double GetMBPerSecond() const;
+
+    private:
+        // Hands the active buffer to the writer thread and switches to the other one.
+        void Submit();
+        void WriterThread();
+
+    private:
+        std::unique_ptr<char[]> m_Buffers[2];
+        const size_t m_BufferSize;
+        size_t m_Used = 0;
+        uint32_t m_Active = 0;
+        uint64_t m_Submitted = 0;
+
+        std::thread m_Thread;
+        std::mutex m_Mutex;
+        std::condition_variable m_Condition;
+        // Set while the writer thread owns the inactive buffer.
+        bool m_Pending = false;
+        size_t m_PendingSize = 0;
+        bool m_Stop = false;
+        bool m_Failed = false;
+        bool m_Closed = false;
+
+        std::FILE* m_File = nullptr;
+
+        int64_t m_StartNs = 0;
+        int64_t m_EndNs = 0;
+    };
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace SDK
+{
+    class UStruct;
+
+    /** @brief Version of the FStructSerializer stream format, streams of other versions are rejected. */
+    constexpr uint16_t kStructSerializerVersion = 1;
+
+    /**
+     * @brief Binary serializer for instances of one UStruct (or UClass), driven by a plan compiled once from its reflected properties.
+     * @brief Adjacent trivially copyable properties are merged into one copy, plain-old-data structs and arrays of them are copied whole.
+     * @brief FName is stored as text and FString, TArray and bit-fields are handled per element, everything else is copied raw.
+     * @brief Object pointers are copied as is, so they're only meaningful within the process that wrote them.
+     *
+     * @brief Stream layout: header (magic, version, layout hash, instance count), then every instance in plan order.
+     * @brief Deserializing requires the same layout hash, i.e. the same struct layout as when serializing.
+     * @brief Map, set, text, delegate, soft object and field path properties aren't supported and are skipped, see GetSkippedProperties.
+     */
+    class FStructSerializer
+    {
+    public:
+        enum class EOpType : uint8_t
+        {
+            Copy,   // Size bytes.
+            Bool,   // Bit-field, one byte holding 0 or 1.
+            Name,   // Count FNames.
+            String, // Count FStrings.
+            Array,  // Count TArrays, elements follow Plan.
+        };
+
+        struct FOp
+        {
+            EOpType Type = EOpType::Copy;
+            uint8_t ByteMask = 0;
+            int32_t Offset = 0;
+            // Total bytes for Copy, element size otherwise.
+            int32_t Size = 0;
+            int32_t Count = 1;
+            // Element plan of an Array.
+            int32_t Plan = -1;
+        };
+
+        struct FPlan
+        {
+            int32_t Size = 0;
+            int32_t Alignment = 1;
+            std::vector<FOp> Ops;
+
+            // A single copy of the whole element, arrays of it are copied with one memcpy.
+            inline bool IsTrivial() const { return Ops.size() == 1 && Ops[0].Type == EOpType::Copy && Ops[0].Offset == 0 && Ops[0].Size == Size; }
+        };
+
+    public:
+        /**
+         * @brief Compiles the plan of a struct, including the properties of its supers.
+         *
+         * @param[in] Struct - Target UScriptStruct or UClass.
+         *
+         * @throws std::invalid_argument - If Struct is null.
+         * @throws std::logic_error - If the SDK isn't initialized.
+         */
+        explicit FStructSerializer(const UStruct* Struct);
+
+    public:
+        /** @brief Appends a stream holding one instance to Out. */
+        inline void Serialize(const void* Instance, std::vector<uint8_t>& Out) const { SerializeMany(Instance, 1, Out); }
+
+        /** @brief Appends a stream holding Count contiguous instances, GetSize bytes apart, to Out. */
+        void SerializeMany(const void* Instances, int32_t Count, std::vector<uint8_t>& Out) const;
+
+        /**
+         * @brief Reads one instance written by Serialize into an existing instance. FStrings and TArrays are resized with FMemory.
+         * @brief If reading fails part way, the instance is left partially updated but valid.
+         * @return The number of bytes read from In.
+         * @throws std::runtime_error - If the stream is truncated, of another version or layout, or doesn't hold exactly one instance.
+         */
+        inline size_t Deserialize(void* Instance, std::span<const uint8_t> In) const { return DeserializeMany(Instance, 1, In); }
+
+        /**
+         * @brief Reads Count contiguous instances written by SerializeMany into existing instances.
+         * @return The number of bytes read from In.
+         * @throws std::runtime_error - If the stream is truncated, of another version or layout, or doesn't hold exactly Count instances.
+         */
+        size_t DeserializeMany(void* Instances, int32_t Count, std::span<const uint8_t> In) const;
+
+    public:
+        /** @return The size of one instance, UStruct::PropertiesSize. */
+        inline int32_t GetSize() const { return m_Plans[0].Size; }
+
+        inline uint32_t GetLayoutHash() const { return m_LayoutHash; }
+
+        /** @return The compiled plans, the first one is the struct's. */
+        inline const std::vector<FPlan>& GetPlans() const { return m_Plans; }
+
+        /** @return "Owner.Property" names of the properties that aren't serialized. */
+        inline const std::vector<std::string>& GetSkippedProperties() const { return m_Skipped; }
+
+    private:
+        friend struct FPlanCompiler;
+
+        std::vector<FPlan> m_Plans;
+        std::vector<std::string> m_Skipped;
+        uint32_t m_LayoutHash = 0;
+    };
+}
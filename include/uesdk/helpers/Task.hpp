@@ -0,0 +1,288 @@
+#pragma once
+#include <uesdk/helpers/GameThreadCallQueue.hpp>
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace SDK
+{
+    /**
+     * @brief Per-thread pool for coroutine frames, used by TTask.
+     * @brief Frames freed on another thread are kept by that thread, since tasks usually finish on the draining thread.
+     */
+    namespace FCoroutineFramePool
+    {
+        [[nodiscard]] void* Allocate(size_t Size);
+        void Free(void* Frame, size_t Size) noexcept;
+    }
+
+    template <typename T>
+    class TTask;
+
+    namespace Detail
+    {
+        struct FTaskPromiseBase
+        {
+            std::coroutine_handle<> Continuation;
+            std::exception_ptr Error;
+            bool Detached = false;
+            std::atomic<bool> Finished = false; // Lets the owner poll a task that finishes on another thread.
+
+            struct FinalAwaiter
+            {
+                bool await_ready() const noexcept { return false; }
+
+                template <typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> Handle) noexcept
+                {
+                    FTaskPromiseBase& Self = Handle.promise();
+                    if (Self.Continuation) {
+                        Self.Finished.store(true, std::memory_order_release);
+                        return Self.Continuation;
+                    }
+
+                    if (Self.Detached)
+                        Handle.destroy();
+                    else
+                        Self.Finished.store(true, std::memory_order_release); // Last access, the owner may destroy the frame from here on.
+
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept { }
+            };
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            FinalAwaiter final_suspend() const noexcept { return {}; }
+
+            void unhandled_exception() noexcept { Error = std::current_exception(); }
+
+            static void* operator new(size_t Size) { return FCoroutineFramePool::Allocate(Size); }
+            static void operator delete(void* Frame, size_t Size) noexcept { FCoroutineFramePool::Free(Frame, Size); }
+        };
+
+        template <typename T>
+        struct TTaskPromise : FTaskPromiseBase
+        {
+            std::optional<T> Result;
+
+            TTask<T> get_return_object() noexcept;
+
+            template <typename U>
+            void return_value(U&& Value) { Result.emplace(std::forward<U>(Value)); }
+
+            T TakeResult()
+            {
+                if (Error)
+                    std::rethrow_exception(Error);
+
+                return std::move(*Result);
+            }
+        };
+
+        template <>
+        struct TTaskPromise<void> : FTaskPromiseBase
+        {
+            TTask<void> get_return_object() noexcept;
+
+            void return_void() noexcept { }
+
+            void TakeResult()
+            {
+                if (Error)
+                    std::rethrow_exception(Error);
+            }
+        };
+    }
+
+    /**
+     * @brief Lazily started coroutine returning T. Frames are allocated from FCoroutineFramePool.
+     * @brief A task starts when it is co_awaited from another task, or by Start or Detach.
+     * @brief A task must not be destroyed while it is suspended, Detach tasks that should outlive their owner.
+     */
+    template <typename T = void>
+    class [[nodiscard]] TTask
+    {
+    public:
+        using promise_type = Detail::TTaskPromise<T>;
+        using HandleType = std::coroutine_handle<promise_type>;
+
+    public:
+        TTask() = default;
+        explicit TTask(HandleType Handle)
+            : m_Handle(Handle)
+        {
+        }
+
+        TTask(TTask&& Other) noexcept
+            : m_Handle(std::exchange(Other.m_Handle, {}))
+            , m_Started(std::exchange(Other.m_Started, false))
+        {
+        }
+        TTask& operator=(TTask&& Other) noexcept
+        {
+            if (this != &Other) {
+                if (m_Handle)
+                    m_Handle.destroy();
+
+                m_Handle = std::exchange(Other.m_Handle, {});
+                m_Started = std::exchange(Other.m_Started, false);
+            }
+            return *this;
+        }
+
+        TTask(const TTask&) = delete;
+        TTask& operator=(const TTask&) = delete;
+
+        ~TTask()
+        {
+            if (m_Handle)
+                m_Handle.destroy();
+        }
+
+    public:
+        /** @brief Runs the task on the calling thread until its first suspension. Does nothing if it already started. */
+        void Start()
+        {
+            if (m_Handle && !m_Started) {
+                m_Started = true;
+                m_Handle.resume();
+            }
+        }
+
+        /**
+         * @brief Starts the task and hands ownership of the frame to the task itself, it is destroyed when the task finishes.
+         * @throws std::logic_error - If the task already started.
+         */
+        void Detach() &&
+        {
+            if (!m_Handle || m_Started)
+                throw std::logic_error("Only tasks that haven't started can be detached");
+
+            HandleType Handle = std::exchange(m_Handle, {});
+            Handle.promise().Detached = true;
+            Handle.resume();
+        }
+
+        /** @brief Can be polled from any thread, the result is visible to the polling thread once this returns true. */
+        bool IsDone() const { return m_Handle && m_Handle.promise().Finished.load(std::memory_order_acquire); }
+
+        /**
+         * @brief Returns the result of a finished task.
+         * @throws Anything the task threw.
+         */
+        T GetResult() { return m_Handle.promise().TakeResult(); }
+
+    public:
+        bool await_ready() const noexcept { return false; }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> Awaiting) noexcept
+        {
+            m_Started = true;
+            m_Handle.promise().Continuation = Awaiting;
+            return m_Handle;
+        }
+
+        T await_resume() { return m_Handle.promise().TakeResult(); }
+
+    private:
+        HandleType m_Handle;
+        bool m_Started = false;
+    };
+
+    template <typename T>
+    TTask<T> Detail::TTaskPromise<T>::get_return_object() noexcept
+    {
+        return TTask<T>(std::coroutine_handle<TTaskPromise<T>>::from_promise(*this));
+    }
+
+    inline TTask<void> Detail::TTaskPromise<void>::get_return_object() noexcept
+    {
+        return TTask<void>(std::coroutine_handle<TTaskPromise<void>>::from_promise(*this));
+    }
+
+    /**
+     * @brief Awaitable returned by PECallWrapper::CallAsync. The queue node and the arguments live in the awaiter itself,
+     * @brief which sits in the awaiting coroutine's frame, so awaiting does not allocate.
+     * @brief The coroutine is resumed on the draining thread, right after the call ran.
+     */
+    template <typename Wrapper, typename ReturnType, typename... Args>
+    class TCallAwaiter : private FQueuedCall
+    {
+    public:
+        template <typename... CallArgs>
+        TCallAwaiter(FGameThreadCallQueue& Queue, Wrapper& CallWrapper, UObject* Obj, CallArgs&&... Arguments)
+            : m_Queue(Queue)
+            , m_Wrapper(CallWrapper)
+            , m_Obj(Obj)
+            , m_Arguments(std::forward<CallArgs>(Arguments)...)
+        {
+        }
+
+        TCallAwaiter(const TCallAwaiter&) = delete;
+        TCallAwaiter& operator=(const TCallAwaiter&) = delete;
+
+    public:
+        bool await_ready() const noexcept { return false; }
+
+        void await_suspend(std::coroutine_handle<> Handle)
+        {
+            m_Handle = Handle;
+            Execute = &TCallAwaiter::Run;
+            m_Queue.Enqueue(this);
+        }
+
+        ReturnType await_resume()
+        {
+            if (m_Error)
+                std::rethrow_exception(m_Error);
+
+            if constexpr (!std::is_void_v<ReturnType>)
+                return std::move(*m_Result);
+        }
+
+    private:
+        static void Run(FQueuedCall* Call, bool ShouldRun)
+        {
+            TCallAwaiter* Self = static_cast<TCallAwaiter*>(Call);
+
+            if (ShouldRun) {
+                try {
+                    std::apply([Self](auto&... Arguments) {
+                        if constexpr (std::is_void_v<ReturnType>)
+                            Self->m_Wrapper.CallAuto(Self->m_Obj, std::forward<Args>(Arguments)...);
+                        else
+                            Self->m_Result.emplace(Self->m_Wrapper.CallAuto(Self->m_Obj, std::forward<Args>(Arguments)...));
+                    },
+                        Self->m_Arguments);
+                }
+                catch (...) {
+                    Self->m_Error = std::current_exception();
+                }
+            }
+            else {
+                Self->m_Error = std::make_exception_ptr(std::runtime_error("FGameThreadCallQueue was destroyed before the call ran"));
+            }
+
+            // The awaiter lives in the coroutine frame, nothing can touch Self after resuming.
+            Self->m_Handle.resume();
+        }
+
+    private:
+        using ResultStorage = std::conditional_t<std::is_void_v<ReturnType>, std::nullptr_t, std::optional<ReturnType>>;
+
+        FGameThreadCallQueue& m_Queue;
+        Wrapper& m_Wrapper;
+        UObject* m_Obj = nullptr;
+        std::tuple<Args...> m_Arguments;
+        std::coroutine_handle<> m_Handle;
+        std::exception_ptr m_Error;
+        ResultStorage m_Result = {};
+    };
+}
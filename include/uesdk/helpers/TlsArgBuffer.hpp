@@ -2,49 +2,60 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <malloc.h>
 
 namespace SDK
 {
-    enum class TLSBufAllocType
+    /** @brief Statistics of the calling thread's TlsArgBuffer arena. */
+    struct FArgArenaStats
     {
-        TLS = 0,
-        Stack,
-        Heap
+        size_t BytesInUse = 0;
+        size_t HighWaterBytes = 0; // Most bytes in use at once, including alignment padding.
+        size_t ReservedBytes = 0; // Total size of the chunks currently owned by the arena.
+        size_t NumChunks = 0;
+        size_t NumChunkAllocations = 0; // Chunks allocated since the thread first used the arena, stops growing after warm-up.
     };
 
+    /**
+     * @brief Scoped parameter buffer, allocated from a per-thread bump arena.
+     * @brief Buffers must be released in reverse order of creation, which scoped use guarantees.
+     * @brief The arena allocates its first chunk on first use and keeps every chunk it grows into, so deep or large calls stop allocating after warm-up.
+     */
     class TlsArgBuffer
     {
     public:
-        TlsArgBuffer(size_t RequiredSize);
+        /**
+         * @param[in] RequiredSize - Size of the buffer in bytes.
+         * @param[in] ZeroFill - If the buffer should be zeroed. Pass false if the caller initializes every byte itself.
+         */
+        TlsArgBuffer(size_t RequiredSize, bool ZeroFill = true);
 
         ~TlsArgBuffer();
 
-        uint8_t* GetData();
+        TlsArgBuffer(const TlsArgBuffer&) = delete;
+        TlsArgBuffer& operator=(const TlsArgBuffer&) = delete;
 
-    private:
-        void AllocAsTLS(size_t RequiredSize);
+        uint8_t* GetData();
 
-        void AllocAsStack(size_t RequiredSize);
+    public:
+        /**
+         * @brief Sets how arenas grow. Only affects chunks allocated afterwards.
+         *
+         * @param[in] InitialChunkSize - Size of a thread's first chunk.
+         * @param[in] GrowthFactor - Each new chunk is at least the previous chunk's size times this, clamped to at least 1.
+         */
+        static void SetChunkGrowth(size_t InitialChunkSize, double GrowthFactor);
 
-        void AllocAsHeap(size_t RequiredSize);
+        static FArgArenaStats GetThreadStats();
 
     private:
         static constexpr size_t kAlignment = std::max<size_t>(16, sizeof(std::max_align_t)); // Required for SIMD instructions
 
-        static constexpr size_t kBufferSize = 4096;
-        static constexpr size_t kMaxDepth = 8;
-
-        static constexpr size_t kMaxStackAllocSize = _ALLOCA_S_THRESHOLD - kAlignment;
-
-        thread_local static inline uint8_t g_BufferStack[kMaxDepth][kBufferSize];
-        thread_local static inline size_t g_BufferIndex = 0;
-
     private:
-        TLSBufAllocType m_Type = TLSBufAllocType::TLS;
         uint8_t* m_Data = nullptr;
-        uint8_t* m_Raw = nullptr;
         size_t m_Size = 0;
-        bool m_Valid = false;
+
+        // Arena top before this buffer, restored on release.
+        struct FArenaChunk* m_PrevChunk = nullptr;
+        size_t m_PrevUsed = 0;
     };
 }
@@ -0,0 +1,267 @@
+#include <private/FMemoryStats.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace SDK::FMemory
+{
+    static constexpr size_t NumSites = static_cast<size_t>(EAllocSite::Num);
+    static constexpr size_t NumChainBuckets = 6;
+
+    static constexpr std::array<const char*, NumSites> SiteNames = {
+        "Unknown",
+        "TArrayConstruct",
+        "TArrayReserve",
+        "TArrayCopy",
+        "TArrayScratch",
+        "TArrayFree",
+        "InlineFitAllocation",
+        "InlineFree",
+        "FStringConstruct",
+        "StructDeserialize",
+        "StructDeserializeFree",
+    };
+
+#ifdef UESDK_FMEMORY_STATS
+    // Counters are only ever written by their owning thread, so relaxed atomics are enough to let
+    // GetStats read them from another thread without a lock. Only the chain tracking below takes one, per shard.
+    struct FSiteCounters
+    {
+        std::atomic<uint64_t> Mallocs = 0;
+        std::atomic<uint64_t> Reallocs = 0;
+        std::atomic<uint64_t> Frees = 0;
+        std::atomic<uint64_t> BytesRequested = 0;
+        std::atomic<uint64_t> ScratchHits = 0;
+        std::atomic<uint64_t> ChainLengths[NumChainBuckets] = {};
+        std::atomic<uint64_t> MaxChainLength = 0;
+    };
+
+    struct FThreadCounters
+    {
+        FSiteCounters Sites[NumSites];
+    };
+
+    // Blocks are kept alive after their thread exits so its counts still show up in GetStats.
+    static std::mutex g_CountersMutex;
+    static std::vector<std::shared_ptr<FThreadCounters>> g_AllCounters;
+
+    static FThreadCounters& GetThreadCounters()
+    {
+        thread_local static FThreadCounters* Counters = nullptr;
+
+        if (!Counters) {
+            auto Block = std::make_shared<FThreadCounters>();
+            Counters = Block.get();
+
+            std::scoped_lock Lock(g_CountersMutex);
+            g_AllCounters.push_back(std::move(Block));
+        }
+
+        return *Counters;
+    }
+
+    struct FLiveAllocation
+    {
+        uint32_t ChainLength;
+        EAllocSite Origin;
+    };
+
+    // Live allocations of every thread, so an allocation freed on another thread still ends its chain.
+    // Split into shards by address, each with its own lock, so threads allocating at the same time rarely wait on each other.
+    // Allocations the engine frees never reach Record, the cap keeps their entries from piling up; untracked allocations count as a chain of 0.
+    static constexpr size_t kNumLiveShards = 64;
+    static constexpr size_t kMaxLiveAllocationsPerShard = (1 << 20) / kNumLiveShards;
+
+    struct alignas(64) FLiveShard
+    {
+        std::mutex Mutex;
+        std::unordered_map<const void*, FLiveAllocation> Allocations;
+    };
+
+    static FLiveShard g_LiveShards[kNumLiveShards];
+
+    static FLiveShard& GetLiveShard(const void* Ptr)
+    {
+        // Allocations are at least 16 byte aligned, the low bits carry no information.
+        const uintptr_t Address = reinterpret_cast<uintptr_t>(Ptr) >> 4;
+        return g_LiveShards[(Address ^ (Address >> 6) ^ (Address >> 12)) % kNumLiveShards];
+    }
+
+    static void TrackLiveAllocation(const void* Ptr, const FLiveAllocation& Live)
+    {
+        FLiveShard& Shard = GetLiveShard(Ptr);
+        std::scoped_lock Lock(Shard.Mutex);
+
+        auto It = Shard.Allocations.find(Ptr);
+        if (It != Shard.Allocations.end())
+            It->second = Live;
+        else if (Shard.Allocations.size() < kMaxLiveAllocationsPerShard)
+            Shard.Allocations.emplace(Ptr, Live);
+    }
+
+    // Removes Ptr and returns what was tracked for it, or a chain of 0 started at Site if it wasn't.
+    static FLiveAllocation UntrackLiveAllocation(const void* Ptr, EAllocSite Site)
+    {
+        FLiveShard& Shard = GetLiveShard(Ptr);
+        std::scoped_lock Lock(Shard.Mutex);
+
+        FLiveAllocation Live = { 0, Site };
+        if (auto It = Shard.Allocations.find(Ptr); It != Shard.Allocations.end()) {
+            Live = It->second;
+            Shard.Allocations.erase(It);
+        }
+
+        return Live;
+    }
+
+    static inline void Increment(std::atomic<uint64_t>& Counter, uint64_t Value = 1)
+    {
+        Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+    }
+
+    static inline size_t GetChainBucket(uint32_t ChainLength)
+    {
+        if (ChainLength <= 2)
+            return ChainLength;
+        if (ChainLength <= 4)
+            return 3;
+        if (ChainLength <= 8)
+            return 4;
+
+        return 5;
+    }
+
+    void Stats::Record(EAllocSite Site, const void* Original, const void* Result, uint32_t Size, bool bScratch)
+    {
+        if (!Original && !Result)
+            return;
+
+        if (static_cast<size_t>(Site) >= NumSites)
+            Site = EAllocSite::Unknown;
+
+        FThreadCounters& Counters = GetThreadCounters();
+        FSiteCounters& SiteCounters = Counters.Sites[static_cast<size_t>(Site)];
+
+        if (bScratch)
+            Increment(SiteCounters.ScratchHits);
+
+        if (!Original) {
+            Increment(SiteCounters.Mallocs);
+            Increment(SiteCounters.BytesRequested, Size);
+
+            TrackLiveAllocation(Result, { 0, Site });
+            return;
+        }
+
+        FLiveAllocation Live = UntrackLiveAllocation(Original, Site);
+
+        if (!Result) {
+            Increment(SiteCounters.Frees);
+
+            // The chain is attributed to the site that created the allocation, that's the one that should reserve up front.
+            FSiteCounters& OriginCounters = Counters.Sites[static_cast<size_t>(Live.Origin)];
+            Increment(OriginCounters.ChainLengths[GetChainBucket(Live.ChainLength)]);
+            return;
+        }
+
+        Live.ChainLength++;
+        TrackLiveAllocation(Result, Live);
+
+        Increment(SiteCounters.Reallocs);
+        Increment(SiteCounters.BytesRequested, Size);
+
+        FSiteCounters& OriginCounters = Counters.Sites[static_cast<size_t>(Live.Origin)];
+        if (Live.ChainLength > OriginCounters.MaxChainLength.load(std::memory_order_relaxed))
+            OriginCounters.MaxChainLength.store(Live.ChainLength, std::memory_order_relaxed);
+    }
+#else
+    void Stats::Record(EAllocSite, const void*, const void*, uint32_t, bool) { }
+#endif
+
+    bool AreStatsEnabled()
+    {
+#ifdef UESDK_FMEMORY_STATS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::vector<FAllocSiteStats> GetStats()
+    {
+        std::vector<FAllocSiteStats> Result;
+
+#ifdef UESDK_FMEMORY_STATS
+        Result.resize(NumSites);
+        for (size_t i = 0; i < NumSites; i++) {
+            Result[i].Site = static_cast<EAllocSite>(i);
+            Result[i].SiteName = SiteNames[i];
+        }
+
+        std::scoped_lock Lock(g_CountersMutex);
+        for (const auto& Block : g_AllCounters) {
+            for (size_t i = 0; i < NumSites; i++) {
+                const FSiteCounters& Counters = Block->Sites[i];
+                FAllocSiteStats& Out = Result[i];
+
+                Out.Mallocs += Counters.Mallocs.load(std::memory_order_relaxed);
+                Out.Reallocs += Counters.Reallocs.load(std::memory_order_relaxed);
+                Out.Frees += Counters.Frees.load(std::memory_order_relaxed);
+                Out.BytesRequested += Counters.BytesRequested.load(std::memory_order_relaxed);
+                Out.ScratchHits += Counters.ScratchHits.load(std::memory_order_relaxed);
+
+                for (size_t Bucket = 0; Bucket < NumChainBuckets; Bucket++)
+                    Out.ChainLengths[Bucket] += Counters.ChainLengths[Bucket].load(std::memory_order_relaxed);
+
+                Out.MaxChainLength = std::max(Out.MaxChainLength, Counters.MaxChainLength.load(std::memory_order_relaxed));
+            }
+        }
+#endif
+
+        return Result;
+    }
+
+    std::string DumpStats()
+    {
+        std::ostringstream Stream;
+        Stream << "Site,Mallocs,Reallocs,Frees,BytesRequested,ScratchHits,Chain0,Chain1,Chain2,Chain3-4,Chain5-8,Chain9+,MaxChain\n";
+
+        for (const FAllocSiteStats& Stats : GetStats()) {
+            Stream << Stats.SiteName << ',' << Stats.Mallocs << ',' << Stats.Reallocs << ',' << Stats.Frees << ','
+                   << Stats.BytesRequested << ',' << Stats.ScratchHits;
+
+            for (uint64_t Count : Stats.ChainLengths)
+                Stream << ',' << Count;
+
+            Stream << ',' << Stats.MaxChainLength << '\n';
+        }
+
+        return Stream.str();
+    }
+
+    void ResetStats()
+    {
+#ifdef UESDK_FMEMORY_STATS
+        std::scoped_lock Lock(g_CountersMutex);
+        for (const auto& Block : g_AllCounters) {
+            for (FSiteCounters& Counters : Block->Sites) {
+                Counters.Mallocs.store(0, std::memory_order_relaxed);
+                Counters.Reallocs.store(0, std::memory_order_relaxed);
+                Counters.Frees.store(0, std::memory_order_relaxed);
+                Counters.BytesRequested.store(0, std::memory_order_relaxed);
+                Counters.ScratchHits.store(0, std::memory_order_relaxed);
+
+                for (auto& Bucket : Counters.ChainLengths)
+                    Bucket.store(0, std::memory_order_relaxed);
+
+                Counters.MaxChainLength.store(0, std::memory_order_relaxed);
+            }
+        }
+#endif
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <uesdk/core/FMemory.hpp>
+
+#include <cstdint>
+
+namespace SDK::FMemory::Stats
+{
+    /**
+     * @brief Records a single backend or scratch call. The kind of call is derived from the pointers:
+     * no Original is a malloc, no Result is a free and both is a realloc.
+     * @param[in] Site Call site the request came from.
+     * @param[in] Original Pointer passed in, or nullptr.
+     * @param[in] Result Pointer returned, or nullptr.
+     * @param[in] Size Requested size in bytes.
+     * @param[in] bScratch If the call was served by the scratch slabs.
+     */
+    void Record(EAllocSite Site, const void* Original, const void* Result, uint32_t Size, bool bScratch);
+}
+
+#ifdef UESDK_FMEMORY_STATS
+#define UESDK_FMEMORY_RECORD(Site, Original, Result, Size, bScratch) SDK::FMemory::Stats::Record(Site, Original, Result, Size, bScratch)
+#else
+#define UESDK_FMEMORY_RECORD(Site, Original, Result, Size, bScratch) ((void)0)
+#endif
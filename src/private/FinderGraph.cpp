@@ -0,0 +1,216 @@
+#include <private/FinderGraph.hpp>
+#include <private/OffsetCandidates.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+namespace SDK::OffsetFinder
+{
+    static double NowMs()
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void FFinderGraph::Add(FFinderNode Node)
+    {
+        const size_t Index = m_Nodes.size();
+        std::vector<size_t> Dependencies;
+
+        for (const std::string& Input : Node.Inputs) {
+            const auto It = m_Producers.find(Input);
+            if (It == m_Producers.end())
+                throw std::logic_error("FFinderGraph: " + Node.Name + " reads " + Input + ", which no earlier node produces");
+
+            if (std::find(Dependencies.begin(), Dependencies.end(), It->second) == Dependencies.end())
+                Dependencies.push_back(It->second);
+        }
+
+        for (const std::string& Output : Node.Outputs) {
+            if (!m_Producers.emplace(Output, Index).second)
+                throw std::logic_error("FFinderGraph: " + Output + " is produced by more than one node");
+        }
+
+        m_Nodes.push_back(std::move(Node));
+        m_Dependencies.push_back(std::move(Dependencies));
+    }
+
+    // Fills the critical path of Report from the step timings, steps that didn't run count as taking no time.
+    static void FindCriticalPath(const std::vector<std::vector<size_t>>& Dependencies, const std::vector<bool>& Completed, FSetupReport& Report)
+    {
+        const size_t NumNodes = Report.Steps.size();
+        std::vector<double> Finish(NumNodes, 0.0);
+        std::vector<size_t> Previous(NumNodes, SIZE_MAX);
+        size_t Last = SIZE_MAX;
+
+        // Nodes were added producers first, so every dependency is already done here.
+        for (size_t i = 0; i < NumNodes; i++) {
+            if (!Completed[i] && !Report.Steps[i].Ran)
+                continue;
+
+            for (size_t Dependency : Dependencies[i]) {
+                if (Finish[Dependency] > Finish[i] || Previous[i] == SIZE_MAX) {
+                    Finish[i] = Finish[Dependency];
+                    Previous[i] = Dependency;
+                }
+            }
+
+            Finish[i] += Report.Steps[i].DurationMs;
+            if (Last == SIZE_MAX || Finish[i] > Finish[Last])
+                Last = i;
+        }
+
+        for (size_t i = Last; i != SIZE_MAX; i = Previous[i]) {
+            if (Report.Steps[i].Ran)
+                Report.CriticalPath.push_back(i);
+        }
+
+        std::reverse(Report.CriticalPath.begin(), Report.CriticalPath.end());
+        Report.CriticalPathMs = Last != SIZE_MAX ? Finish[Last] : 0.0;
+    }
+
+    ESDKStatus FFinderGraph::Run(uint32_t NumThreads, FSetupReport& Report, const std::function<void(size_t, size_t)>& OnProgress) const
+    {
+        const size_t NumNodes = m_Nodes.size();
+
+        if (NumThreads == 0)
+            NumThreads = std::max(1u, std::thread::hardware_concurrency());
+        NumThreads = static_cast<uint32_t>(std::clamp<size_t>(NumThreads, 1, std::max<size_t>(1, NumNodes)));
+
+        Report = {};
+        Report.Threads = NumThreads;
+        Report.Steps.resize(NumNodes);
+
+        std::vector<size_t> Waiting(NumNodes);
+        std::vector<std::vector<size_t>> Dependents(NumNodes);
+        // Lowest index first, so a single thread runs the nodes in the order they were added.
+        std::set<size_t> Ready;
+
+        for (size_t i = 0; i < NumNodes; i++) {
+            Report.Steps[i].Name = m_Nodes[i].Name;
+            for (size_t Dependency : m_Dependencies[i]) {
+                Report.Steps[i].Inputs.push_back(m_Nodes[Dependency].Name);
+                Dependents[Dependency].push_back(i);
+            }
+
+            Waiting[i] = m_Dependencies[i].size();
+            if (!Waiting[i])
+                Ready.insert(i);
+        }
+
+        std::mutex Mutex;
+        std::condition_variable Condition;
+        std::vector<bool> Completed(NumNodes, false);
+        size_t Running = 0;
+        size_t Finished = 0;
+        size_t FirstFailed = NumNodes;
+        std::exception_ptr Error;
+        size_t ErrorNode = NumNodes;
+
+        // Nodes after a failure aren't started, their status can't change the result.
+        auto HasWork = [&]() { return !Error && !Ready.empty() && *Ready.begin() < FirstFailed; };
+
+        const double StartMs = NowMs();
+
+        auto Worker = [&](uint32_t Thread) {
+            std::unique_lock Lock(Mutex);
+
+            while (true) {
+                Condition.wait(Lock, [&]() { return HasWork() || Running == 0; });
+                if (!HasWork())
+                    break;
+
+                const size_t Index = *Ready.begin();
+                Ready.erase(Ready.begin());
+                Running++;
+                Lock.unlock();
+
+                const FFinderNode& Node = m_Nodes[Index];
+                ESDKStatus Status = ESDKStatus::Success;
+                std::exception_ptr NodeError;
+                bool Ran = false;
+                // Catches the sample searches of the finder, so ambiguous offsets show up in the report.
+                Memory::FOffsetCandidateRecorder Recorder;
+
+                const double NodeStartMs = NowMs();
+                try {
+                    if (!Node.Condition || Node.Condition()) {
+                        Ran = true;
+                        Status = Node.Run();
+                    }
+                }
+                catch (...) {
+                    NodeError = std::current_exception();
+                }
+                const double NodeEndMs = NowMs();
+
+                Lock.lock();
+                Running--;
+
+                FSetupStep& Step = Report.Steps[Index];
+                Step.Status = Status;
+                Step.Ran = Ran;
+                Step.StartMs = NodeStartMs - StartMs;
+                Step.DurationMs = Ran ? NodeEndMs - NodeStartMs : 0.0;
+                Step.Thread = Thread;
+
+                for (const Memory::FOffsetCandidate& Candidate : Recorder.Candidates)
+                    Step.Candidates.push_back(Candidate.Offset);
+                if (!Recorder.Candidates.empty())
+                    Step.Confidence = Recorder.Candidates[0].Confidence;
+
+                if (NodeError) {
+                    if (Index < ErrorNode) {
+                        Error = NodeError;
+                        ErrorNode = Index;
+                    }
+                }
+                else if (Status != ESDKStatus::Success) {
+                    FirstFailed = std::min(FirstFailed, Index);
+                }
+                else {
+                    Completed[Index] = true;
+                    for (size_t Dependent : Dependents[Index]) {
+                        if (--Waiting[Dependent] == 0)
+                            Ready.insert(Dependent);
+                    }
+                }
+
+                Finished++;
+                if (OnProgress)
+                    OnProgress(Finished, NumNodes);
+
+                Condition.notify_all();
+            }
+
+            // Wake the other workers so they see there's nothing left.
+            Condition.notify_all();
+        };
+
+        std::vector<std::thread> Workers;
+        Workers.reserve(NumThreads - 1);
+
+        for (uint32_t Thread = 1; Thread < NumThreads; Thread++)
+            Workers.emplace_back(Worker, Thread);
+        Worker(0);
+
+        for (std::thread& Thread : Workers)
+            Thread.join();
+
+        Report.WallMs = NowMs() - StartMs;
+        for (const FSetupStep& Step : Report.Steps)
+            Report.WorkMs += Step.DurationMs;
+
+        FindCriticalPath(m_Dependencies, Completed, Report);
+
+        if (Error)
+            std::rethrow_exception(Error);
+
+        return FirstFailed < NumNodes ? Report.Steps[FirstFailed].Status : ESDKStatus::Success;
+    }
+}
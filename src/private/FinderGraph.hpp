@@ -0,0 +1,57 @@
+#pragma once
+#include <uesdk/SetupReport.hpp>
+#include <uesdk/Status.hpp>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SDK::OffsetFinder
+{
+    struct FFinderNode
+    {
+        std::string Name;
+        // Outputs of earlier nodes this node reads, it only starts once all of their producers succeeded or were skipped.
+        std::vector<std::string> Inputs;
+        // What this node writes, e.g. "UStruct::Children" or "State::UsesFProperty".
+        std::vector<std::string> Outputs;
+
+        // Returns ESDKStatus::Success or the failure reported by Init.
+        std::function<ESDKStatus()> Run;
+        // Checked once the inputs are ready, the node is skipped if it returns false. Always runs if empty.
+        std::function<bool()> Condition;
+    };
+
+    /**
+     * @brief Runs finder nodes on a few threads, each as soon as the nodes producing its inputs are done.
+     *
+     * @brief Nodes must be added in an order that is valid to run on one thread, i.e. producers before their consumers.
+     * @brief After a failure only nodes added before the failed one are started, so the returned status is the one
+     * @brief running the nodes one by one in that order would return.
+     */
+    class FFinderGraph
+    {
+    public:
+        /** @throws std::logic_error - If an input isn't the output of an earlier node, or an output is produced twice. */
+        void Add(FFinderNode Node);
+
+        /**
+         * @param[in] NumThreads - Threads to run the nodes on, including the calling one. 0 uses the hardware concurrency.
+         * @param[out] Report - Timing of every node and the critical path.
+         * @param[in] OnProgress - Called with the number of finished nodes and the total after every node, on the thread that ran it.
+         *
+         * @return ESDKStatus::Success, or the status of the first failed node in the order they were added.
+         *
+         * @throws Anything a node throws, after the nodes that are running finished.
+         */
+        ESDKStatus Run(uint32_t NumThreads, FSetupReport& Report, const std::function<void(size_t, size_t)>& OnProgress = {}) const;
+
+    private:
+        std::vector<FFinderNode> m_Nodes;
+        // Indices of the nodes each node depends on.
+        std::vector<std::vector<size_t>> m_Dependencies;
+        // Index of the node producing each output.
+        std::unordered_map<std::string, size_t> m_Producers;
+    };
+}
@@ -19,19 +19,6 @@ namespace SDK::Memory
         return ((ModRM & 0b11000111) == 0b00000101);
     }
 
-    bool IsInProcessRange(uintptr_t Addr)
-    {
-        // NtCurrentPeb() + 0x10 = ImageBaseAddress.
-
-        PIMAGE_DOS_HEADER DosHeader = *(PIMAGE_DOS_HEADER*)(__readgsqword(0x60) + 0x10);
-        PIMAGE_NT_HEADERS NtHeaders = (PIMAGE_NT_HEADERS)((uintptr_t)DosHeader + DosHeader->e_lfanew);
-
-        const auto ImageBase = (uintptr_t)DosHeader;
-        const auto ImageSize = NtHeaders->OptionalHeader.SizeOfImage;
-
-        return Addr > ImageBase && Addr < (ImageBase + ImageSize);
-    }
-
     std::byte* IterateAll(hat::signature_view Signature, const std::string& Section, const std::function<bool(std::byte*)>& It)
     {
         auto Module = hat::process::get_process_module();
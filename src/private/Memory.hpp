@@ -1,11 +1,16 @@
 #pragma once
 #include <uesdk/helpers/PropertyInfo.hpp>
 
+#include <private/OffsetCandidates.hpp>
+#include <private/RegionMap.hpp>
+
 #include <libhat.hpp>
 
-#include <Windows.h>
+#include <cstring>
+#include <cwchar>
 #include <functional>
-#include <vector>
+#include <span>
+#include <string>
 
 // Credit to https://github.com/Encryqed/Dumper-7 for the FindOffset and GetValidPointerOffset function.
 
@@ -14,7 +19,8 @@ namespace SDK::Memory
     uintptr_t CalculateRVA(uintptr_t Addr, uint32_t Offset);
     bool Is32BitRelativeAddress(uint8_t ModRM);
 
-    bool IsInProcessRange(uintptr_t Addr);
+    /** @return If Addr is inside the main module, see FRegionMap::IsInMainModule. */
+    inline bool IsInProcessRange(uintptr_t Addr) { return FRegionMap::Get().IsInMainModule(Addr); }
 
     std::byte* IterateAll(hat::signature_view Signature, const std::string& Section, const std::function<bool(std::byte*)>& It);
     std::byte* FindPatternInRange(const std::byte* Start, const std::byte* End, hat::signature_view Signature);
@@ -63,45 +69,11 @@ namespace SDK::Memory
         return Result;
     }
 
-    template <int Alignement = 4, typename T>
-    inline int32_t FindOffset(std::vector<std::pair<void*, T>>& ObjectValuePair, int MinOffset = 0x28, int MaxOffset = 0x1A0)
-    {
-        int32_t HighestFoundOffset = MinOffset;
-
-        for (int i = 0; i < ObjectValuePair.size(); i++) {
-            uint8_t* BytePtr = (uint8_t*)(ObjectValuePair[i].first);
-
-            for (int j = HighestFoundOffset; j < MaxOffset; j += Alignement) {
-                if (*reinterpret_cast<T*>(BytePtr + j) == ObjectValuePair[i].second && j >= HighestFoundOffset) {
-                    if (j > HighestFoundOffset) {
-                        HighestFoundOffset = j;
-                        i = 0;
-                    }
-                    j = MaxOffset;
-                }
-            }
-        }
-
-        return HighestFoundOffset != MinOffset ? HighestFoundOffset : OFFSET_NOT_FOUND;
-    }
-
     template <bool bCheckForVft = true>
     inline int32_t GetValidPointerOffset(uint8_t* ObjA, uint8_t* ObjB, int32_t StartingOffset, int32_t MaxOffset)
     {
-        auto IsBadReadPtr = [](void* p) -> bool {
-            MEMORY_BASIC_INFORMATION mbi;
-
-            if (VirtualQuery(p, &mbi, sizeof(mbi))) {
-                constexpr DWORD mask = (PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY);
-                bool b = !(mbi.Protect & mask);
-                if (mbi.Protect & (PAGE_GUARD | PAGE_NOACCESS))
-                    b = true;
-
-                return b;
-            }
-
-            return true;
-        };
+        // Checked against the cached region map, probing a pointer no longer costs a VirtualQuery.
+        auto IsBadReadPtr = [](void* p) -> bool { return !FRegionMap::Get().IsReadable(p, sizeof(void*)); };
 
         if (IsBadReadPtr(ObjA) || IsBadReadPtr(ObjB))
             return OFFSET_NOT_FOUND;
@@ -0,0 +1,199 @@
+#include <private/OffsetCandidates.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <emmintrin.h>
+
+namespace SDK::Memory
+{
+    static thread_local FOffsetCandidateRecorder* t_Recorder = nullptr;
+
+    FOffsetCandidateRecorder::FOffsetCandidateRecorder()
+        : m_Previous(t_Recorder)
+    {
+        t_Recorder = this;
+    }
+
+    FOffsetCandidateRecorder::~FOffsetCandidateRecorder()
+    {
+        t_Recorder = m_Previous;
+    }
+
+    // Sets bit i of Mask for every byte i of Window equal to Byte. Window is a whole number of 16 byte chunks.
+    static void MatchByte(const uint8_t* Window, size_t WindowSize, uint8_t Byte, uint64_t* Mask)
+    {
+        const __m128i Needle = _mm_set1_epi8(static_cast<char>(Byte));
+
+        for (size_t i = 0; i < WindowSize; i += 16) {
+            const __m128i Chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Window + i));
+            const uint64_t Bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, Needle)));
+
+            Mask[i / 64] |= Bits << (i % 64);
+        }
+    }
+
+    // The two ways samples are passed in, read the same way by the solver.
+    struct FSampleSpan
+    {
+        std::span<const FOffsetSample> Samples;
+
+        size_t Num() const { return Samples.size(); }
+        const uint8_t* GetObject(size_t i) const { return static_cast<const uint8_t*>(Samples[i].Object); }
+        const void* GetValue(size_t i) const { return Samples[i].Value; }
+    };
+
+    struct FSampleArray
+    {
+        FOffsetSampleArray Array;
+
+        size_t Num() const { return Array.Num; }
+        const uint8_t* GetObject(size_t i) const { return *reinterpret_cast<const uint8_t* const*>(Array.Data + i * Array.Stride + Array.ObjectOffset); }
+        const void* GetValue(size_t i) const { return Array.Data + i * Array.Stride + Array.ValueOffset; }
+    };
+
+    // If every sample holds its value at Offset, stopping at the first one that doesn't. The fixed sizes let memcmp become one compare.
+    template <size_t Size, typename TSamples>
+    static bool HoldsAll(const TSamples& Samples, size_t Offset, size_t ValueSize)
+    {
+        for (size_t i = 0; i < Samples.Num(); i++) {
+            const uint8_t* Object = Samples.GetObject(i);
+            if (!Object || std::memcmp(Object + Offset, Samples.GetValue(i), Size ? Size : ValueSize) != 0)
+                return false;
+        }
+        return true;
+    }
+
+    // Every offset all samples hold their value at, lowest first.
+    template <size_t Size, typename TSamples>
+    static void FindCommon(const TSamples& Samples, size_t ValueSize, int32_t Alignment, int32_t MinOffset, size_t LastOffset, std::vector<FOffsetCandidate>& Candidates)
+    {
+        for (size_t Offset = 0; Offset <= LastOffset; Offset += Alignment) {
+            if (HoldsAll<Size>(Samples, MinOffset + Offset, ValueSize))
+                Candidates.push_back({ MinOffset + static_cast<int32_t>(Offset), static_cast<int32_t>(Samples.Num()), 0.0 });
+        }
+    }
+
+    // Bit i of every mask is offset MinOffset + i.
+    struct FSampleMatcher
+    {
+        size_t ValueSize;
+        int32_t MinOffset;
+        // The bytes a scalar search would read.
+        size_t ReadSize;
+        // ReadSize rounded up to whole chunks, so the SIMD compares never read past the copied bytes.
+        size_t WindowSize;
+        size_t NumWords;
+        std::vector<uint64_t> Aligned;
+        std::vector<uint8_t> Window;
+        // One spare word, the shifts below read the word after each one.
+        std::vector<uint64_t> ByteMask;
+
+        // Sets Mask to every aligned offset Object holds Value at, comparing the whole window at once.
+        void MatchAll(const uint8_t* Object, const void* Value, std::vector<uint64_t>& Mask)
+        {
+            std::memcpy(Window.data(), Object + MinOffset, ReadSize);
+            Mask = Aligned;
+
+            // The value is at offset i if byte b of it is at i + b for every b, so the byte masks are shifted down by b and intersected.
+            for (size_t b = 0; b < ValueSize; b++) {
+                std::fill(ByteMask.begin(), ByteMask.end(), 0);
+                MatchByte(Window.data(), WindowSize, static_cast<const uint8_t*>(Value)[b], ByteMask.data());
+
+                for (size_t w = 0; w < NumWords; w++) {
+                    const uint64_t Shifted = b ? (ByteMask[w] >> b) | (ByteMask[w + 1] << (64 - b)) : ByteMask[w];
+                    Mask[w] &= Shifted;
+                }
+            }
+        }
+    };
+
+    template <typename TSamples>
+    static std::vector<FOffsetCandidate> Solve(const TSamples& Samples, size_t ValueSize, int32_t Alignment, int32_t MinOffset, int32_t MaxOffset)
+    {
+        if (Samples.Num() == 0 || ValueSize == 0 || Alignment <= 0 || MaxOffset <= MinOffset)
+            return {};
+
+        const size_t NumOffsets = static_cast<size_t>(MaxOffset - MinOffset);
+        const size_t LastOffset = (NumOffsets - 1) / Alignment * Alignment;
+
+        // Offset by offset like a scalar search, but without stopping at the first match. Wrong offsets usually fail
+        // on the first or second sample, so this costs about one compare per offset plus one per sample at each right one.
+        std::vector<FOffsetCandidate> Candidates;
+        const int32_t NumSamples = static_cast<int32_t>(Samples.Num());
+
+        switch (ValueSize) {
+        case 1:
+            FindCommon<1>(Samples, ValueSize, Alignment, MinOffset, LastOffset, Candidates);
+            break;
+        case 2:
+            FindCommon<2>(Samples, ValueSize, Alignment, MinOffset, LastOffset, Candidates);
+            break;
+        case 4:
+            FindCommon<4>(Samples, ValueSize, Alignment, MinOffset, LastOffset, Candidates);
+            break;
+        case 8:
+            FindCommon<8>(Samples, ValueSize, Alignment, MinOffset, LastOffset, Candidates);
+            break;
+        default:
+            FindCommon<0>(Samples, ValueSize, Alignment, MinOffset, LastOffset, Candidates);
+            break;
+        }
+
+        // No offset every sample agrees on, fall back to the ones the most samples agree on. That needs every sample
+        // matched at every offset, so only failed searches compare whole windows, 16 offsets at a time.
+        if (Candidates.empty()) {
+            FSampleMatcher Matcher;
+            Matcher.ValueSize = ValueSize;
+            Matcher.MinOffset = MinOffset;
+            Matcher.ReadSize = LastOffset + ValueSize;
+            Matcher.WindowSize = (Matcher.ReadSize + 15) & ~size_t(15);
+            Matcher.NumWords = (NumOffsets + 63) / 64;
+            Matcher.Aligned.assign(Matcher.NumWords, 0);
+            Matcher.Window.resize(Matcher.WindowSize);
+            Matcher.ByteMask.resize(std::max((Matcher.WindowSize + 63) / 64, Matcher.NumWords) + 1);
+
+            for (size_t i = 0; i <= LastOffset; i += Alignment)
+                Matcher.Aligned[i / 64] |= uint64_t(1) << (i % 64);
+
+            std::vector<uint64_t> SampleMask(Matcher.NumWords);
+            std::vector<int32_t> Matches(NumOffsets, 0);
+
+            for (size_t i = 0; i < Samples.Num(); i++) {
+                if (!Samples.GetObject(i))
+                    continue;
+
+                Matcher.MatchAll(Samples.GetObject(i), Samples.GetValue(i), SampleMask);
+                for (size_t w = 0; w < Matcher.NumWords; w++) {
+                    for (uint64_t Bits = SampleMask[w]; Bits; Bits &= Bits - 1)
+                        Matches[w * 64 + std::countr_zero(Bits)]++;
+                }
+            }
+
+            const int32_t Best = *std::max_element(Matches.begin(), Matches.end());
+
+            for (size_t i = 0; Best && i < NumOffsets; i++) {
+                if (Matches[i] == Best)
+                    Candidates.push_back({ MinOffset + static_cast<int32_t>(i), Best, 0.0 });
+            }
+        }
+
+        for (FOffsetCandidate& Candidate : Candidates)
+            Candidate.Confidence = static_cast<double>(Candidate.Matches) / NumSamples / static_cast<double>(Candidates.size());
+
+        if (t_Recorder)
+            t_Recorder->Candidates = Candidates;
+
+        return Candidates;
+    }
+
+    std::vector<FOffsetCandidate> FindOffsetCandidates(std::span<const FOffsetSample> Samples, size_t ValueSize, int32_t Alignment, int32_t MinOffset, int32_t MaxOffset)
+    {
+        return Solve(FSampleSpan { Samples }, ValueSize, Alignment, MinOffset, MaxOffset);
+    }
+
+    std::vector<FOffsetCandidate> FindOffsetCandidatesInPlace(const FOffsetSampleArray& Samples, size_t ValueSize, int32_t Alignment, int32_t MinOffset, int32_t MaxOffset)
+    {
+        return Solve(FSampleArray { Samples }, ValueSize, Alignment, MinOffset, MaxOffset);
+    }
+}
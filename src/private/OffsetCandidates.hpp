@@ -0,0 +1,95 @@
+#pragma once
+#include <uesdk/helpers/PropertyInfo.hpp>
+
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Kept apart from Memory.hpp, the sample search only reads memory it's given and doesn't need libhat.
+
+namespace SDK::Memory
+{
+    struct FOffsetSample
+    {
+        const void* Object;
+        const void* Value;
+    };
+
+    /** @brief Samples stored in place Stride bytes apart, with the object pointer and the value itself at fixed offsets, e.g. a vector of std::pair<void*, T>. */
+    struct FOffsetSampleArray
+    {
+        const uint8_t* Data;
+        size_t Num;
+        size_t Stride;
+        size_t ObjectOffset;
+        size_t ValueOffset;
+    };
+
+    struct FOffsetCandidate
+    {
+        int32_t Offset;
+        // Number of samples holding their value at Offset.
+        int32_t Matches;
+        // Matches / samples, split evenly between the returned candidates. 1 only if Offset is the single offset every sample agrees on.
+        double Confidence;
+    };
+
+    /**
+     * @brief Finds the offsets in [MinOffset, MaxOffset), every Alignment bytes from MinOffset, where every sample's object holds its value.
+     * @brief Each offset is checked like a scalar search, up to its first mismatching sample, so a successful search costs about as much as one.
+     * @brief Only if no offset matches every sample are the samples compared against the whole window with SSE2, to count the matches per offset.
+     * @brief Samples with a null object match nowhere.
+     *
+     * @return Every offset all samples match, lowest first. If there is none, the offsets the most samples match. Empty if no sample matches.
+     */
+    std::vector<FOffsetCandidate> FindOffsetCandidates(std::span<const FOffsetSample> Samples, size_t ValueSize, int32_t Alignment, int32_t MinOffset, int32_t MaxOffset);
+
+    /** @brief FindOffsetCandidates over samples read in place, so they don't have to be copied to FOffsetSamples first. */
+    std::vector<FOffsetCandidate> FindOffsetCandidatesInPlace(const FOffsetSampleArray& Samples, size_t ValueSize, int32_t Alignment, int32_t MinOffset, int32_t MaxOffset);
+
+    /**
+     * @brief While alive, keeps the candidates of the last FindOffsetCandidates call on this thread.
+     * @brief Lets callers of finders that return a single offset see whether the choice was ambiguous.
+     */
+    class FOffsetCandidateRecorder
+    {
+    public:
+        FOffsetCandidateRecorder();
+        ~FOffsetCandidateRecorder();
+
+        FOffsetCandidateRecorder(const FOffsetCandidateRecorder&) = delete;
+        FOffsetCandidateRecorder& operator=(const FOffsetCandidateRecorder&) = delete;
+
+    public:
+        std::vector<FOffsetCandidate> Candidates;
+
+    private:
+        FOffsetCandidateRecorder* m_Previous;
+    };
+
+    template <int Alignement = 4, typename T>
+    inline std::vector<FOffsetCandidate> FindOffsetCandidates(const std::vector<std::pair<void*, T>>& ObjectValuePair, int MinOffset = 0x28, int MaxOffset = 0x1A0)
+    {
+        if (ObjectValuePair.empty())
+            return {};
+
+        const auto& First = ObjectValuePair[0];
+        const uint8_t* Data = reinterpret_cast<const uint8_t*>(&First);
+        const FOffsetSampleArray Samples = { Data, ObjectValuePair.size(), sizeof(First), static_cast<size_t>(reinterpret_cast<const uint8_t*>(&First.first) - Data),
+                                             static_cast<size_t>(reinterpret_cast<const uint8_t*>(&First.second) - Data) };
+
+        return FindOffsetCandidatesInPlace(Samples, sizeof(T), Alignement, MinOffset, MaxOffset);
+    }
+
+    /** @return The lowest offset every object holds its value at, see FindOffsetCandidates. */
+    template <int Alignement = 4, typename T>
+    inline int32_t FindOffset(const std::vector<std::pair<void*, T>>& ObjectValuePair, int MinOffset = 0x28, int MaxOffset = 0x1A0)
+    {
+        const std::vector<FOffsetCandidate> Candidates = FindOffsetCandidates<Alignement>(ObjectValuePair, MinOffset, MaxOffset);
+        if (Candidates.empty() || Candidates[0].Matches != static_cast<int32_t>(ObjectValuePair.size()))
+            return OFFSET_NOT_FOUND;
+
+        return Candidates[0].Offset;
+    }
+}
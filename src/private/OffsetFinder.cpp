@@ -1,25 +1,25 @@
 #include <uesdk/Offsets.hpp>
+#include <uesdk/SetupReport.hpp>
 #include <uesdk/State.hpp>
 #include <uesdk/Status.hpp>
 #include <uesdk/core/FMemory.hpp>
 #include <uesdk/core/ObjectArray.hpp>
 #include <uesdk/helpers/FastSearch.hpp>
 
+#include <private/FinderGraph.hpp>
 #include <private/Memory.hpp>
 
 #include <libhat.hpp>
 
+#include <algorithm>
 #include <format>
+#include <iomanip>
 #include <memory>
 #include <sstream>
+#include <thread>
 
 // Most of the member offset finding is based off of https://github.com/Encryqed/Dumper-7, so credits to them.
 
-#define GET_OFFSET(Function, Variable, ErrorCode) \
-    Variable = Function();                        \
-    if (Variable == OFFSET_NOT_FOUND)             \
-        return ErrorCode;
-
 // Variables.
 //
 namespace SDK::OffsetFinder
@@ -64,6 +64,11 @@ namespace SDK::OffsetFinder
     UFunction* WasRecentlyRendered = nullptr;
     UFunction* CrossProduct2D = nullptr;
     UFunction* GetSpectatorPawn = nullptr;
+
+    // Most finders take well under a millisecond, more threads than this only add startup cost.
+    constexpr uint32_t kMaxSetupThreads = 8;
+
+    FSetupReport SetupReport;
 }
 
 // Helper functions.
@@ -222,7 +227,67 @@ namespace SDK::OffsetFinder
             { GObjects->FindClassFast("PlayerController")->FindMember(FName("bAutoManageActiveCameraTarget")), 0xFF }
         };
 
-        return Memory::FindOffset<1>(ValuePair, Offsets::UProperty::Offset) - 0x3;
+        // The bool members follow the int32 UProperty::Offset.
+        const int32_t FieldMask = Memory::FindOffset<1>(ValuePair, Offsets::UProperty::Offset + sizeof(int32_t));
+        return FieldMask != OFFSET_NOT_FOUND ? FieldMask - 0x3 : OFFSET_NOT_FOUND;
+    }
+
+    // UStruct::FindProperty fills the same union member either way, this is just the property object.
+    void* GetPropertyObject(const UObject* Owner, const char* Name)
+    {
+        const PropertyInfo Info = static_cast<const UStruct*>(Owner)->FindProperty(FName(Name));
+        return Info.Found ? static_cast<void*>(Info.Prop) : nullptr;
+    }
+
+    int32_t Find_UStructProperty_Struct()
+    {
+        std::vector<std::pair<void*, void*>> ValuePair = {
+            { GetPropertyObject(Transform, "Translation"), Vector },
+            { GetPropertyObject(Transform, "Scale3D"), Vector }
+        };
+
+        for (const auto& [Property, _] : ValuePair) {
+            if (!Property)
+                return OFFSET_NOT_FOUND;
+        }
+
+        return Memory::FindOffset<8>(ValuePair);
+    }
+    int32_t Find_UArrayProperty_Inner()
+    {
+        uint8_t* Tags = static_cast<uint8_t*>(GetPropertyObject(Actor, "Tags"));
+        if (!Tags || Offsets::UStructProperty::Struct == OFFSET_NOT_FOUND)
+            return OFFSET_NOT_FOUND;
+
+        // Inner is the first member after the base property, like UStructProperty::Struct, unless the engine puts ArrayFlags before it.
+        // Compiled-in inner properties have the same name as their array.
+        for (int32_t Offset : { Offsets::UStructProperty::Struct, Offsets::UStructProperty::Struct + 0x8 }) {
+            const uintptr_t Inner = *reinterpret_cast<uintptr_t*>(Tags + Offset);
+            if (Inner < 0x10000)
+                continue;
+
+            const FName InnerName = State::UsesFProperty ? reinterpret_cast<FField*>(Inner)->Name : reinterpret_cast<UObject*>(Inner)->Name;
+            if (InnerName == FName("Tags"))
+                return Offset;
+        }
+
+        return OFFSET_NOT_FOUND;
+    }
+
+    int32_t Find_UEnumProperty_UnderlyingProp()
+    {
+        // An enum class member, so it's an enum property rather than a byte property. Engines before 4.17 don't have it.
+        uint8_t* Method = static_cast<uint8_t*>(GetPropertyObject(Actor, "SpawnCollisionHandlingMethod"));
+        if (!Method || Offsets::UStructProperty::Struct == OFFSET_NOT_FOUND)
+            return OFFSET_NOT_FOUND;
+
+        // UnderlyingProp is the first member after the base property, the engine names it UnderlyingType.
+        const uintptr_t Underlying = *reinterpret_cast<uintptr_t*>(Method + Offsets::UStructProperty::Struct);
+        if (Underlying < 0x10000)
+            return OFFSET_NOT_FOUND;
+
+        const FName UnderlyingName = State::UsesFProperty ? reinterpret_cast<FField*>(Underlying)->Name : reinterpret_cast<UObject*>(Underlying)->Name;
+        return UnderlyingName == FName("UnderlyingType") ? Offsets::UStructProperty::Struct : OFFSET_NOT_FOUND;
     }
 
     int32_t Find_UEnum_Names()
@@ -232,7 +297,8 @@ namespace SDK::OffsetFinder
             { ETraceTypeQuery, 0x22 }
         };
 
-        return Memory::FindOffset(ValuePair) - 0x8;
+        const int32_t NamesNum = Memory::FindOffset(ValuePair);
+        return NamesNum != OFFSET_NOT_FOUND ? NamesNum - 0x8 : OFFSET_NOT_FOUND;
     }
 
     int32_t Find_UFunction_FunctionFlags()
@@ -461,98 +527,212 @@ namespace SDK::OffsetFinder
         return FuncIdx != OFFSET_NOT_FOUND;
     }
 
-    ESDKStatus SetupMemberOffsets()
+    // A finder Init can't do without, failing with ErrorCode if the offset isn't found.
+    static FFinderNode OffsetNode(const char* Name, std::vector<std::string> Inputs, int32_t (*Find)(), Offsets::Offset_t& Variable, ESDKStatus ErrorCode)
     {
-        std::vector<FSEntry> Search = {
-            { FSUObject("PlayerController", &PlayerController) },
-            { FSUObject("Controller", &Controller) },
-
-            { FSUObject("Vector", &Vector) },
-            { FSUObject("Vector4", &Vector4) },
-            { FSUObject("Vector2D", &Vector2D) },
-            { FSUObject("Guid", &Guid) },
-            { FSUObject("Transform", &Transform) },
-
-            { FSUObject("KismetSystemLibrary", &KismetSystemLibrary) },
-            { FSUObject("KismetStringLibrary", &KismetStringLibrary) },
-
-            { FSUObject("Struct", &Struct) },
-            { FSUObject("Field", &Field) },
-            { FSUObject("Class", &Class) },
-
-            { FSUObject("Actor", &Actor) },
-            { FSUObject("Object", &Object) },
-
-            { FSUObject("Default__Object", &Default__Object) },
-            { FSUObject("Default__Field", &Default__Field) },
+        return { .Name = Name, .Inputs = std::move(Inputs), .Outputs = { Name }, .Run = [Find, &Variable, ErrorCode]() {
+                    Variable = Find();
+                    return Variable == OFFSET_NOT_FOUND ? ErrorCode : ESDKStatus::Success;
+                } };
+    }
 
-            { FSUObject("Color", &Color) },
-            { FSUObject("Engine", &Engine) },
+    // A finder for an offset only some helpers use, it never fails Init.
+    static FFinderNode OptionalOffsetNode(const char* Name, std::vector<std::string> Inputs, int32_t (*Find)(), Offsets::Offset_t& Variable)
+    {
+        return { .Name = Name, .Inputs = std::move(Inputs), .Outputs = { Name }, .Run = [Find, &Variable]() {
+                    Variable = Find();
+                    return ESDKStatus::Success;
+                } };
+    }
 
-            { FSUObject("ENetRole", &ENetRole) },
-            { FSUObject("ETraceTypeQuery", &ETraceTypeQuery) }
-        };
-        if (!FastSearch(Search))
-            return ESDKStatus::Failed_FastSearchPass1;
-
-        // The order of the functions below is very important as there is a dependency chain.
-        // Do not change the order.
-
-        GET_OFFSET(Find_UStruct_Children, Offsets::UStruct::Children, ESDKStatus::Failed_UStruct_Children);
-        GET_OFFSET(Find_UField_Next, Offsets::UField::Next, ESDKStatus::Failed_UField_Next);
-        GET_OFFSET(Find_UStruct_SuperStruct, Offsets::UStruct::SuperStruct, ESDKStatus::Failed_UStruct_SuperStruct);
-        GET_OFFSET(Find_UStruct_PropertiesSize, Offsets::UStruct::PropertiesSize, ESDKStatus::Failed_UStruct_PropertiesSize);
-        GET_OFFSET(Find_UStruct_MinAlignment, Offsets::UStruct::MinAlignment, ESDKStatus::Failed_UStrct_MinAlignment);
-        GET_OFFSET(Find_UClass_ClassCastFlags, Offsets::UClass::ClassCastFlags, ESDKStatus::Failed_UClass_ClassCastFlags);
-
-        // In order to do the second pass, we required UClass::CastFlags.
-
-        Search = {
-            { FSUFunction("PlayerController", "WasInputKeyJustPressed", &WasInputKeyJustPressed) },
-            { FSUFunction("PlayerController", "ToggleSpeaking", &ToggleSpeaking) },
-            { FSUFunction("PlayerController", "SwitchLevel", &SwitchLevel) },
-            { FSUFunction("PlayerController", "SetViewTargetWithBlend", &SetViewTargetWithBlend) },
-            { FSUFunction("PlayerController", "SetHapticsByValue", &SetHapticsByValue) },
-            { FSUFunction("PlayerController", "GetSpectatorPawn", &GetSpectatorPawn) },
-            { FSUFunction("KismetSystemLibrary", "SphereTraceSingleForObjects", &SphereTraceSingleForObjects) },
-            { FSUFunction("KismetMathLibrary", "CrossProduct2D", &CrossProduct2D) },
-            { FSUFunction("Actor", "WasRecentlyRendered", &WasRecentlyRendered) },
+    ESDKStatus SetupMemberOffsets(const std::function<void(size_t, size_t)>& OnProgress)
+    {
+        // Everything UStruct::FindProperty reads, for whichever of FProperty and UProperty the engine uses.
+        const std::vector<std::string> PropertyLayout = { "State::UsesFProperty", "UField::Next", "UClass::ClassCastFlags", "UStruct::ChildProperties",
+                                                          "UProperty::Offset", "UProperty::ElementSize", "UProperty::PropertyFlags", "UBoolProperty::Base" };
+
+        auto UsesFProperty = []() { return State::UsesFProperty; };
+        auto UsesUProperty = []() { return !State::UsesFProperty; };
+
+        // Each node lists the outputs it reads, nodes whose inputs are ready run concurrently.
+        // Nodes are added in the order they'd run in on one thread, see FFinderGraph.
+        FFinderGraph Graph;
+
+        Graph.Add({ .Name = "FastSearchPass1", .Outputs = { "FastSearchPass1" }, .Run = []() {
+                       std::vector<FSEntry> Search = {
+                           { FSUObject("PlayerController", &PlayerController) },
+                           { FSUObject("Controller", &Controller) },
+
+                           { FSUObject("Vector", &Vector) },
+                           { FSUObject("Vector4", &Vector4) },
+                           { FSUObject("Vector2D", &Vector2D) },
+                           { FSUObject("Guid", &Guid) },
+                           { FSUObject("Transform", &Transform) },
+
+                           { FSUObject("KismetSystemLibrary", &KismetSystemLibrary) },
+                           { FSUObject("KismetStringLibrary", &KismetStringLibrary) },
+
+                           { FSUObject("Struct", &Struct) },
+                           { FSUObject("Field", &Field) },
+                           { FSUObject("Class", &Class) },
+
+                           { FSUObject("Actor", &Actor) },
+                           { FSUObject("Object", &Object) },
+
+                           { FSUObject("Default__Object", &Default__Object) },
+                           { FSUObject("Default__Field", &Default__Field) },
+
+                           { FSUObject("Color", &Color) },
+                           { FSUObject("Engine", &Engine) },
+
+                           { FSUObject("ENetRole", &ENetRole) },
+                           { FSUObject("ETraceTypeQuery", &ETraceTypeQuery) }
+                       };
+                       return FastSearch(Search) ? ESDKStatus::Success : ESDKStatus::Failed_FastSearchPass1;
+                   } });
+
+        // Find_UStruct_Children also decides between FProperty and UProperty.
+        FFinderNode ChildrenNode = OffsetNode("UStruct::Children", { "FastSearchPass1" }, Find_UStruct_Children, Offsets::UStruct::Children, ESDKStatus::Failed_UStruct_Children);
+        ChildrenNode.Outputs.push_back("State::UsesFProperty");
+        Graph.Add(std::move(ChildrenNode));
+
+        Graph.Add(OffsetNode("UField::Next", { "FastSearchPass1", "UStruct::Children" }, Find_UField_Next, Offsets::UField::Next, ESDKStatus::Failed_UField_Next));
+        Graph.Add(OffsetNode("UStruct::SuperStruct", { "FastSearchPass1" }, Find_UStruct_SuperStruct, Offsets::UStruct::SuperStruct, ESDKStatus::Failed_UStruct_SuperStruct));
+        Graph.Add(OffsetNode("UStruct::PropertiesSize", { "FastSearchPass1" }, Find_UStruct_PropertiesSize, Offsets::UStruct::PropertiesSize,
+                             ESDKStatus::Failed_UStruct_PropertiesSize));
+        Graph.Add(OffsetNode("UStruct::MinAlignment", { "FastSearchPass1" }, Find_UStruct_MinAlignment, Offsets::UStruct::MinAlignment, ESDKStatus::Failed_UStrct_MinAlignment));
+        Graph.Add(OffsetNode("UClass::ClassCastFlags", { "FastSearchPass1" }, Find_UClass_ClassCastFlags, Offsets::UClass::ClassCastFlags,
+                             ESDKStatus::Failed_UClass_ClassCastFlags));
+
+        // The second pass finds functions by walking class children, which requires UClass::CastFlags.
+        Graph.Add({ .Name = "FastSearchPass2", .Inputs = { "UStruct::Children", "UField::Next", "UClass::ClassCastFlags" }, .Outputs = { "FastSearchPass2" }, .Run = []() {
+                       std::vector<FSEntry> Search = {
+                           { FSUFunction("PlayerController", "WasInputKeyJustPressed", &WasInputKeyJustPressed) },
+                           { FSUFunction("PlayerController", "ToggleSpeaking", &ToggleSpeaking) },
+                           { FSUFunction("PlayerController", "SwitchLevel", &SwitchLevel) },
+                           { FSUFunction("PlayerController", "SetViewTargetWithBlend", &SetViewTargetWithBlend) },
+                           { FSUFunction("PlayerController", "SetHapticsByValue", &SetHapticsByValue) },
+                           { FSUFunction("PlayerController", "GetSpectatorPawn", &GetSpectatorPawn) },
+                           { FSUFunction("KismetSystemLibrary", "SphereTraceSingleForObjects", &SphereTraceSingleForObjects) },
+                           { FSUFunction("KismetMathLibrary", "CrossProduct2D", &CrossProduct2D) },
+                           { FSUFunction("Actor", "WasRecentlyRendered", &WasRecentlyRendered) },
+                       };
+                       return FastSearch(Search) ? ESDKStatus::Success : ESDKStatus::Failed_FastSearchPass2;
+                   } });
+
+        Graph.Add(OffsetNode("UEnum::Names", { "FastSearchPass1" }, Find_UEnum_Names, Offsets::UEnum::Names, ESDKStatus::Failed_UEnum_Names));
+
+        Graph.Add(OffsetNode("UFunction::FunctionFlags", { "FastSearchPass2" }, Find_UFunction_FunctionFlags, Offsets::UFunction::FunctionFlags,
+                             ESDKStatus::Failed_UFunction_FunctionFlags));
+        Graph.Add(OffsetNode("UFunction::NumParms", { "FastSearchPass2" }, Find_UFunction_NumParms, Offsets::UFunction::NumParms, ESDKStatus::Failed_UFunction_NumParms));
+        Graph.Add(OffsetNode("UFunction::ParmsSize", { "FastSearchPass2" }, Find_UFunction_ParmsSize, Offsets::UFunction::ParmsSize, ESDKStatus::Failed_UFunction_ParmsSize));
+        Graph.Add(OffsetNode("UFunction::ReturnValueOffset", { "FastSearchPass2" }, Find_UFunction_ReturnValueOffset, Offsets::UFunction::ReturnValueOffset,
+                             ESDKStatus::Failed_UFunction_ReturnValueOffset));
+        Graph.Add(OffsetNode("UFunction::Func", { "FastSearchPass2" }, Find_UFunction_Func, Offsets::UFunction::Func, ESDKStatus::Failed_UFunction_FuncOffset));
+
+        FFinderNode ChildPropertiesNode = OffsetNode("UStruct::ChildProperties", { "FastSearchPass1", "UStruct::Children", "State::UsesFProperty" },
+                                                     Find_UStruct_ChildProperties, Offsets::UStruct::ChildProperties, ESDKStatus::Failed_UStruct_ChildProperties);
+        ChildPropertiesNode.Condition = UsesFProperty;
+        Graph.Add(std::move(ChildPropertiesNode));
+
+        // UProperty members are found by looking up members of Color and Guid through UStruct::FindMember.
+        const std::vector<std::string> MemberLookup = { "FastSearchPass1", "State::UsesFProperty", "UStruct::Children", "UField::Next" };
+
+        FFinderNode UPropertyNodes[] = {
+            OffsetNode("UProperty::Offset", MemberLookup, Find_UProperty_Offset, Offsets::UProperty::Offset, ESDKStatus::Failed_UProperty_Offset),
+            OffsetNode("UProperty::ElementSize", MemberLookup, Find_UProperty_ElementSize, Offsets::UProperty::ElementSize, ESDKStatus::Failed_UProperty_ElementSize),
+            OffsetNode("UProperty::PropertyFlags", MemberLookup, Find_UProperty_PropertyFlags, Offsets::UProperty::PropertyFlags, ESDKStatus::Failed_UProperty_PropertyFlags),
         };
-        if (!FastSearch(Search))
-            return ESDKStatus::Failed_FastSearchPass2;
-
-        GET_OFFSET(Find_UEnum_Names, Offsets::UEnum::Names, ESDKStatus::Failed_UEnum_Names);
+        for (FFinderNode& Node : UPropertyNodes) {
+            Node.Condition = UsesUProperty;
+            Graph.Add(std::move(Node));
+        }
 
-        GET_OFFSET(Find_UFunction_FunctionFlags, Offsets::UFunction::FunctionFlags, ESDKStatus::Failed_UFunction_FunctionFlags);
-        GET_OFFSET(Find_UFunction_NumParms, Offsets::UFunction::NumParms, ESDKStatus::Failed_UFunction_NumParms);
-        GET_OFFSET(Find_UFunction_ParmsSize, Offsets::UFunction::ParmsSize, ESDKStatus::Failed_UFunction_ParmsSize);
-        GET_OFFSET(Find_UFunction_ReturnValueOffset, Offsets::UFunction::ReturnValueOffset, ESDKStatus::Failed_UFunction_ReturnValueOffset);
-        GET_OFFSET(Find_UFunction_Func, Offsets::UFunction::Func, ESDKStatus::Failed_UFunction_FuncOffset);
+        // Also looks up PlayerController with FindClassFast, which checks the cast flags.
+        FFinderNode BoolBaseNode = OffsetNode("UBoolProperty::Base", { "FastSearchPass1", "State::UsesFProperty", "UStruct::Children", "UField::Next", "UClass::ClassCastFlags", "UProperty::Offset" },
+                                              Find_UBoolProperty_Base, Offsets::UBoolProperty::Base, ESDKStatus::Failed_UBoolProperty_Base);
+        BoolBaseNode.Condition = UsesUProperty;
+        Graph.Add(std::move(BoolBaseNode));
+
+        Graph.Add(OffsetNode("UClass::ClassDefaultObject", { "FastSearchPass1" }, Find_UClass_ClassDefaultObject, Offsets::UClass::ClassDefaultObject,
+                             ESDKStatus::Failed_UClass_ClassDefaultObject));
+
+        // Optional, only used by FStructSerializer.
+        std::vector<std::string> StructInputs = PropertyLayout;
+        StructInputs.push_back("FastSearchPass1");
+        Graph.Add(OptionalOffsetNode("UStructProperty::Struct", StructInputs, Find_UStructProperty_Struct, Offsets::UStructProperty::Struct));
+        Graph.Add(OptionalOffsetNode("UArrayProperty::Inner", { "FastSearchPass1", "State::UsesFProperty", "UStructProperty::Struct" }, Find_UArrayProperty_Inner,
+                                     Offsets::UArrayProperty::Inner));
+        Graph.Add(OptionalOffsetNode("UEnumProperty::UnderlyingProp", { "FastSearchPass1", "State::UsesFProperty", "UStructProperty::Struct" },
+                                     Find_UEnumProperty_UnderlyingProp, Offsets::UEnumProperty::UnderlyingProp));
+
+        Graph.Add({ .Name = "FastSearchPass3", .Inputs = PropertyLayout, .Outputs = { "UDataTable::RowStruct", "UDataTable::RowMap" }, .Run = []() {
+                       PropertyInfo RowStructProp {};
+                       std::vector<FSEntry> Search = {
+                           { FSProperty("DataTable", "RowStruct", &RowStructProp) }
+                       };
+                       if (!FastSearch(Search))
+                           return ESDKStatus::Failed_FastSearchPass3;
+
+                       // In every version I've tested, this is correct.
+                       Offsets::UDataTable::RowStruct = RowStructProp.Offset;
+                       Offsets::UDataTable::RowMap = Offsets::UDataTable::RowStruct + 0x8;
+                       return ESDKStatus::Success;
+                   } });
+
+        const uint32_t NumThreads = std::min(kMaxSetupThreads, std::max(1u, std::thread::hardware_concurrency()));
+        const ESDKStatus Status = Graph.Run(NumThreads, SetupReport, OnProgress);
+        if (Status != ESDKStatus::Success)
+            return Status;
 
-        if (State::UsesFProperty) {
-            GET_OFFSET(Find_UStruct_ChildProperties, Offsets::UStruct::ChildProperties, ESDKStatus::Failed_UStruct_ChildProperties);
-        }
-        else {
-            GET_OFFSET(Find_UProperty_Offset, Offsets::UProperty::Offset, ESDKStatus::Failed_UProperty_Offset);
-            GET_OFFSET(Find_UProperty_ElementSize, Offsets::UProperty::ElementSize, ESDKStatus::Failed_UProperty_ElementSize);
-            GET_OFFSET(Find_UProperty_PropertyFlags, Offsets::UProperty::PropertyFlags, ESDKStatus::Failed_UProperty_PropertyFlags);
-            GET_OFFSET(Find_UBoolProperty_Base, Offsets::UBoolProperty::Base, ESDKStatus::Failed_UBoolProperty_Base);
-        }
+        State::SetupMemberOffsets = true;
+        return ESDKStatus::Success;
+    }
+}
 
-        GET_OFFSET(Find_UClass_ClassDefaultObject, Offsets::UClass::ClassDefaultObject, ESDKStatus::Failed_UClass_ClassDefaultObject);
+namespace SDK
+{
+    const FSetupReport& GetSetupReport()
+    {
+        return OffsetFinder::SetupReport;
+    }
 
-        PropertyInfo RowStructProp {};
-        Search = {
-            { FSProperty("DataTable", "RowStruct", &RowStructProp) }
-        };
-        if (!FastSearch(Search))
-            return ESDKStatus::Failed_FastSearchPass3;
+    std::string DumpSetupReport()
+    {
+        const FSetupReport& Report = OffsetFinder::SetupReport;
+
+        std::ostringstream Stream;
+        Stream << std::fixed << std::setprecision(3);
+        Stream << "Member offsets: " << Report.WallMs << " ms on " << Report.Threads << " threads, " << Report.WorkMs << " ms of work, critical path "
+               << Report.CriticalPathMs << " ms\n";
+
+        for (const FSetupStep& Step : Report.Steps) {
+            Stream << "  " << Step.Name << ": ";
+            if (Step.Ran) {
+                Stream << "start " << Step.StartMs << " ms, took " << Step.DurationMs << " ms on thread " << Step.Thread;
+                if (Step.Status != ESDKStatus::Success)
+                    Stream << ", failed with status " << static_cast<int>(Step.Status);
+
+                if (Step.Candidates.size() > 1) {
+                    Stream << ", ambiguous with confidence " << Step.Confidence << ", candidates" << std::hex;
+                    for (int32_t Candidate : Step.Candidates)
+                        Stream << " 0x" << Candidate;
+                    Stream << std::dec;
+                }
+            }
+            else {
+                Stream << "not run";
+            }
+            Stream << '\n';
+        }
 
-        // In every version I've tested, this is correct.
-        Offsets::UDataTable::RowStruct = RowStructProp.Offset;
-        Offsets::UDataTable::RowMap = Offsets::UDataTable::RowStruct + 0x8;
+        Stream << "Critical path:";
+        for (size_t i = 0; i < Report.CriticalPath.size(); i++) {
+            const FSetupStep& Step = Report.Steps[Report.CriticalPath[i]];
+            Stream << (i ? " -> " : " ") << Step.Name << " (" << Step.DurationMs << " ms)";
+        }
+        Stream << '\n';
 
-        State::SetupMemberOffsets = true;
-        return ESDKStatus::Success;
+        return Stream.str();
     }
 }
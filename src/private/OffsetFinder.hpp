@@ -1,6 +1,8 @@
 #pragma once
 #include <uesdk/Status.hpp>
 
+#include <functional>
+
 namespace SDK::OffsetFinder
 {
     bool FindFMemoryRealloc();
@@ -10,5 +12,6 @@ namespace SDK::OffsetFinder
     bool FindAppendString();
     bool FindProcessEventIdx();
 
-    ESDKStatus SetupMemberOffsets();
+    // OnProgress is called with the number of finished finder steps and the total, see FFinderGraph::Run.
+    ESDKStatus SetupMemberOffsets(const std::function<void(size_t, size_t)>& OnProgress = {});
 }
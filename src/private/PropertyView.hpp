@@ -0,0 +1,102 @@
+#pragma once
+#include <uesdk/Offsets.hpp>
+#include <uesdk/State.hpp>
+#include <uesdk/core/UnrealObjects.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace SDK::Properties
+{
+    /** @brief The members of a UProperty or FProperty that don't depend on which of the two the engine uses. */
+    struct FPropertyView
+    {
+        const void* Property = nullptr;
+        uint64_t CastFlags = 0;
+        int32_t Offset = 0;
+        int32_t ElementSize = 0;
+        int32_t ArrayDim = 1;
+        uint8_t ByteMask = 0;
+        uint64_t Flags = 0;
+
+        inline bool HasTypeFlag(EClassCastFlags TypeFlag) const { return CastFlags & TypeFlag; }
+
+        std::string GetName() const
+        {
+            return State::UsesFProperty ? static_cast<const FProperty*>(Property)->Name.ToString() : static_cast<const UProperty*>(Property)->GetName();
+        }
+
+        std::string GetTypeName() const
+        {
+            return State::UsesFProperty ? static_cast<const FProperty*>(Property)->ClassPrivate->Name.ToString()
+                                        : static_cast<const UProperty*>(Property)->Class->GetName();
+        }
+
+        /** @return A pointer member of the property, e.g. Offsets::UStructProperty::Struct, or nullptr if the offset wasn't found. */
+        template <typename T>
+        T* GetMember(Offsets::Offset_t MemberOffset) const
+        {
+            if (MemberOffset == OFFSET_NOT_FOUND)
+                return nullptr;
+
+            return *reinterpret_cast<T* const*>(static_cast<const uint8_t*>(Property) + MemberOffset);
+        }
+    };
+
+    /** @param[in] Property - A UProperty or FProperty, depending on State::UsesFProperty. */
+    inline FPropertyView MakeView(const void* Property)
+    {
+        FPropertyView View;
+        View.Property = Property;
+
+        if (State::UsesFProperty) {
+            const FProperty* Prop = static_cast<const FProperty*>(Property);
+            View.CastFlags = Prop->ClassPrivate->CastFlags;
+            View.Offset = Prop->Offset;
+            View.ElementSize = Prop->ElementSize;
+            View.ArrayDim = Prop->ArrayDim;
+            View.Flags = Prop->PropertyFlags;
+
+            if (Prop->HasTypeFlag(CASTCLASS_FBoolProperty)) {
+                FBoolProperty* BoolProperty = const_cast<FBoolProperty*>(static_cast<const FBoolProperty*>(Prop));
+                if (!BoolProperty->IsNativeBool())
+                    View.ByteMask = BoolProperty->GetFieldMask();
+            }
+        }
+        else {
+            const UProperty* Prop = static_cast<const UProperty*>(Property);
+            View.CastFlags = static_cast<uint64_t>(Prop->Class->ClassCastFlags);
+            View.Offset = Prop->Offset;
+            View.ElementSize = Prop->ElementSize;
+            // UProperty keeps ArrayDim right before ElementSize, it isn't searched for separately.
+            View.ArrayDim = *reinterpret_cast<const int32_t*>(reinterpret_cast<const uint8_t*>(Prop) + Offsets::UProperty::ElementSize - sizeof(int32_t));
+            View.Flags = Prop->PropertyFlags;
+
+            if (Prop->HasTypeFlag(CASTCLASS_FBoolProperty)) {
+                const UBoolProperty* BoolProperty = static_cast<const UBoolProperty*>(Prop);
+                if (!BoolProperty->IsNativeBool())
+                    View.ByteMask = BoolProperty->GetFieldMask();
+            }
+        }
+
+        return View;
+    }
+
+    /** @brief Calls Visit with every property of Struct, excluding inherited ones, in declaration order. */
+    template <typename VisitorType>
+    void ForEachProperty(const UStruct* Struct, VisitorType&& Visit)
+    {
+        if (State::UsesFProperty) {
+            for (FField* Field = Struct->ChildProperties; Field; Field = Field->Next) {
+                if (Field->HasTypeFlag(CASTCLASS_FProperty))
+                    Visit(MakeView(Field));
+            }
+        }
+        else {
+            for (UField* Child = Struct->Children; Child; Child = Child->Next) {
+                if (Child->HasTypeFlag(CASTCLASS_FProperty))
+                    Visit(MakeView(Child));
+            }
+        }
+    }
+}
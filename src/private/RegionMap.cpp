@@ -0,0 +1,256 @@
+#include <private/RegionMap.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#endif
+
+namespace SDK::Memory
+{
+    static int64_t NowMs()
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+#ifdef _WIN32
+    static uint8_t GetAccess(DWORD Protect)
+    {
+        if (Protect & (PAGE_GUARD | PAGE_NOACCESS))
+            return Region_None;
+
+        uint8_t Access = Region_None;
+        if (Protect & (PAGE_READONLY | PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY))
+            Access |= Region_Read;
+        if (Protect & (PAGE_READWRITE | PAGE_WRITECOPY | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY))
+            Access |= Region_Write;
+        if (Protect & (PAGE_EXECUTE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE | PAGE_EXECUTE_WRITECOPY))
+            Access |= Region_Execute;
+
+        return Access;
+    }
+
+    static void QueryRegions(std::vector<FRegion>& Regions)
+    {
+        SYSTEM_INFO Info;
+        GetSystemInfo(&Info);
+
+        uintptr_t Address = reinterpret_cast<uintptr_t>(Info.lpMinimumApplicationAddress);
+        const uintptr_t MaxAddress = reinterpret_cast<uintptr_t>(Info.lpMaximumApplicationAddress);
+
+        MEMORY_BASIC_INFORMATION Mbi;
+        while (Address < MaxAddress && VirtualQuery(reinterpret_cast<void*>(Address), &Mbi, sizeof(Mbi))) {
+            const uintptr_t Begin = reinterpret_cast<uintptr_t>(Mbi.BaseAddress);
+            if (Mbi.State == MEM_COMMIT)
+                Regions.push_back({ Begin, Begin + Mbi.RegionSize, GetAccess(Mbi.Protect) });
+
+            Address = Begin + Mbi.RegionSize;
+        }
+    }
+
+    static void QueryMainModule(uintptr_t& ModuleBegin, uintptr_t& ModuleEnd)
+    {
+        const auto DosHeader = reinterpret_cast<PIMAGE_DOS_HEADER>(GetModuleHandleW(nullptr));
+        const auto NtHeaders = reinterpret_cast<PIMAGE_NT_HEADERS>(reinterpret_cast<uintptr_t>(DosHeader) + DosHeader->e_lfanew);
+
+        ModuleBegin = reinterpret_cast<uintptr_t>(DosHeader);
+        ModuleEnd = ModuleBegin + NtHeaders->OptionalHeader.SizeOfImage;
+    }
+#else
+    // Calls Visit(Begin, End, Perms, Path) for every line of /proc/self/maps.
+    template <typename VisitorType>
+    static void ForEachMapping(VisitorType&& Visit)
+    {
+        std::FILE* Maps = std::fopen("/proc/self/maps", "r");
+        if (!Maps)
+            return;
+
+        // start-end perms offset dev inode [path]
+        char Line[4096 + 128];
+        while (std::fgets(Line, sizeof(Line), Maps)) {
+            unsigned long long Begin = 0;
+            unsigned long long End = 0;
+            char Perms[5] = {};
+            int PathStart = 0;
+
+            if (std::sscanf(Line, "%llx-%llx %4s %*s %*s %*s %n", &Begin, &End, Perms, &PathStart) < 3)
+                continue;
+
+            char* Path = Line + PathStart;
+            Path[std::strcspn(Path, "\n")] = '\0';
+
+            Visit(static_cast<uintptr_t>(Begin), static_cast<uintptr_t>(End), Perms, PathStart ? Path : "");
+        }
+
+        std::fclose(Maps);
+    }
+
+    static void QueryRegions(std::vector<FRegion>& Regions)
+    {
+        ForEachMapping([&](uintptr_t Begin, uintptr_t End, const char* Perms, const char*) {
+            uint8_t Access = Region_None;
+            if (Perms[0] == 'r')
+                Access |= Region_Read;
+            if (Perms[1] == 'w')
+                Access |= Region_Write;
+            if (Perms[2] == 'x')
+                Access |= Region_Execute;
+
+            Regions.push_back({ Begin, End, Access });
+        });
+    }
+
+    static void QueryMainModule(uintptr_t& ModuleBegin, uintptr_t& ModuleEnd)
+    {
+        char ExePath[4096] = {};
+        if (readlink("/proc/self/exe", ExePath, sizeof(ExePath) - 1) <= 0)
+            return;
+
+        ModuleBegin = UINTPTR_MAX;
+        ModuleEnd = 0;
+
+        ForEachMapping([&](uintptr_t Begin, uintptr_t End, const char*, const char* Path) {
+            if (std::strcmp(Path, ExePath) != 0)
+                return;
+
+            ModuleBegin = std::min(ModuleBegin, Begin);
+            ModuleEnd = std::max(ModuleEnd, End);
+        });
+
+        if (ModuleBegin > ModuleEnd)
+            ModuleBegin = ModuleEnd = 0;
+    }
+#endif
+
+    FRegionMap& FRegionMap::Get()
+    {
+        static FRegionMap Map;
+        return Map;
+    }
+
+    void FRegionMap::TakeSnapshot()
+    {
+        std::vector<FRegion> Regions;
+        QueryRegions(Regions);
+
+        m_Begins.clear();
+        m_Ends.clear();
+        m_Access.clear();
+
+        // Both backends report regions in address order, adjacent ones with the same access are merged to keep the search short.
+        for (const FRegion& Region : Regions) {
+            if (!m_Begins.empty() && m_Ends.back() == Region.Begin && m_Access.back() == Region.Access) {
+                m_Ends.back() = Region.End;
+                continue;
+            }
+
+            m_Begins.push_back(Region.Begin);
+            m_Ends.push_back(Region.End);
+            m_Access.push_back(Region.Access);
+        }
+
+        m_HasSnapshot = true;
+        m_SnapshotMs = NowMs();
+    }
+
+    bool FRegionMap::Find(uintptr_t Address, FRegion& OutRegion) const
+    {
+        size_t Count = m_Begins.size();
+        if (!Count)
+            return false;
+
+        // Last region beginning at or before Address. The select compiles to a conditional move, so the loop has no data dependent branch.
+        const uintptr_t* Base = m_Begins.data();
+        while (Count > 1) {
+            const size_t Half = Count / 2;
+            Base = Base[Half] <= Address ? Base + Half : Base;
+            Count -= Half;
+        }
+
+        const size_t Index = static_cast<size_t>(Base - m_Begins.data());
+        if (Address < m_Begins[Index] || Address >= m_Ends[Index])
+            return false;
+
+        OutRegion = { m_Begins[Index], m_Ends[Index], m_Access[Index] };
+        return true;
+    }
+
+    bool FRegionMap::FindOrRefresh(uintptr_t Address, FRegion& OutRegion)
+    {
+        {
+            std::shared_lock Lock(m_Mutex);
+            if (Find(Address, OutRegion))
+                return true;
+
+            if (m_HasSnapshot && NowMs() - m_SnapshotMs < kRefreshIntervalMs)
+                return false;
+        }
+
+        std::unique_lock Lock(m_Mutex);
+
+        // Another thread may have refreshed while the lock was released.
+        if (!m_HasSnapshot || NowMs() - m_SnapshotMs >= kRefreshIntervalMs)
+            TakeSnapshot();
+
+        return Find(Address, OutRegion);
+    }
+
+    bool FRegionMap::IsReadable(const void* Address, size_t Size)
+    {
+        uintptr_t Current = reinterpret_cast<uintptr_t>(Address);
+        const uintptr_t End = Current + (Size ? Size : 1);
+        if (End < Current)
+            return false;
+
+        // Ranges spanning regions with different access are checked region by region.
+        while (Current < End) {
+            FRegion Region;
+            if (!FindOrRefresh(Current, Region) || !(Region.Access & Region_Read))
+                return false;
+
+            Current = Region.End;
+        }
+
+        return true;
+    }
+
+    bool FRegionMap::IsExecutable(const void* Address)
+    {
+        FRegion Region;
+        return FindOrRefresh(reinterpret_cast<uintptr_t>(Address), Region) && (Region.Access & Region_Execute);
+    }
+
+    bool FRegionMap::IsInMainModule(uintptr_t Address)
+    {
+        // The main module never moves, its bounds are read once and then checked without locking.
+        std::call_once(m_ModuleOnce, [this]() { QueryMainModule(m_ModuleBegin, m_ModuleEnd); });
+        return Address > m_ModuleBegin && Address < m_ModuleEnd;
+    }
+
+    void FRegionMap::Refresh()
+    {
+        std::unique_lock Lock(m_Mutex);
+        TakeSnapshot();
+    }
+
+    std::vector<FRegion> FRegionMap::GetRegions()
+    {
+        std::unique_lock Lock(m_Mutex);
+        if (!m_HasSnapshot)
+            TakeSnapshot();
+
+        std::vector<FRegion> Regions;
+        Regions.reserve(m_Begins.size());
+
+        for (size_t i = 0; i < m_Begins.size(); i++)
+            Regions.push_back({ m_Begins[i], m_Ends[i], m_Access[i] });
+
+        return Regions;
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace SDK::Memory
+{
+    enum ERegionAccess : uint8_t
+    {
+        Region_None = 0,
+        Region_Read = 1 << 0,
+        Region_Write = 1 << 1,
+        Region_Execute = 1 << 2,
+    };
+
+    struct FRegion
+    {
+        uintptr_t Begin;
+        uintptr_t End;
+        uint8_t Access;
+    };
+
+    /**
+     * @brief Snapshot of the committed memory regions of the process, and the bounds of its main module, for cheap pointer validation.
+     * @brief Queries binary search a sorted array instead of asking the OS, using VirtualQuery on Windows and /proc/self/maps elsewhere.
+     *
+     * @brief The snapshot is taken on first use. An address outside every region refreshes it, at most once per kRefreshIntervalMs,
+     * @brief since memory mapped after the snapshot would otherwise be rejected. Memory unmapped after the snapshot is still reported
+     * @brief as readable until the next refresh, call Refresh after the process layout is known to have changed.
+     * @brief Thread safe.
+     */
+    class FRegionMap
+    {
+    public:
+        static constexpr int64_t kRefreshIntervalMs = 250;
+
+    public:
+        /** @return The map of the current process. */
+        static FRegionMap& Get();
+
+    public:
+        /** @return If every byte of [Address, Address + Size) is in a readable region. */
+        bool IsReadable(const void* Address, size_t Size = 1);
+
+        bool IsExecutable(const void* Address);
+
+        /** @return If Address is inside the main module of the process, excluding its first byte. */
+        bool IsInMainModule(uintptr_t Address);
+
+        /** @brief Takes a new snapshot now. */
+        void Refresh();
+
+        /** @return A copy of the current snapshot, adjacent regions with the same access merged. */
+        std::vector<FRegion> GetRegions();
+
+    private:
+        FRegionMap() = default;
+
+        // Finds the region holding Address in the current snapshot, the caller holds the lock.
+        bool Find(uintptr_t Address, FRegion& OutRegion) const;
+        // Find, refreshing once on a miss if the snapshot is old enough.
+        bool FindOrRefresh(uintptr_t Address, FRegion& OutRegion);
+        void TakeSnapshot();
+
+    private:
+        std::shared_mutex m_Mutex;
+        bool m_HasSnapshot = false;
+        int64_t m_SnapshotMs = 0;
+
+        // Sorted by Begin and non-overlapping. Kept apart so the search only touches the begins.
+        std::vector<uintptr_t> m_Begins;
+        std::vector<uintptr_t> m_Ends;
+        std::vector<uint8_t> m_Access;
+
+        std::once_flag m_ModuleOnce;
+        uintptr_t m_ModuleBegin = 0;
+        uintptr_t m_ModuleEnd = 0;
+    };
+}
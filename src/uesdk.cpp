@@ -1,35 +1,202 @@
-#include <UESDK.hpp>
+#include <uesdk/Init.hpp>
+#include <uesdk/State.hpp>
 #include <private/OffsetFinder.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+
 namespace SDK
 {
-    ESDKStatus Init()
+    enum class EComponentState : uint8_t
+    {
+        Pending,
+        Running,
+        Done
+    };
+
+    constexpr size_t kNumComponents = static_cast<size_t>(ESDKComponent::Count);
+
+    // Guards the component states and State::Setup. Components are set up outside of it.
+    static std::mutex InitMutex;
+    static std::condition_variable InitCondition;
+    static EComponentState ComponentStates[kNumComponents] = {};
+    // Status and number of the failed attempts of each component.
+    static ESDKStatus ComponentStatuses[kNumComponents] = {};
+    static uint32_t ComponentFailures[kNumComponents] = {};
+
+    static std::atomic<uint32_t> ComponentsDone = 0;
+    static std::atomic<uint32_t> StepsDone = 0;
+    static std::atomic<uint32_t> Steps = 0;
+
+    // From std::async, so destroying the last copy at exit waits for a background Init that is still running.
+    static std::shared_future<ESDKStatus> AsyncInit;
+
+    static std::span<const ESDKComponent> GetRequirements(ESDKComponent Component)
+    {
+        static constexpr ESDKComponent FName[] = { ESDKComponent::FMemory };
+        static constexpr ESDKComponent MemberOffsets[] = { ESDKComponent::FMemory, ESDKComponent::GObjects, ESDKComponent::FName };
+        static constexpr ESDKComponent ProcessEvent[] = { ESDKComponent::GObjects, ESDKComponent::MemberOffsets };
+
+        switch (Component) {
+        case ESDKComponent::FName:
+            return FName;
+        case ESDKComponent::MemberOffsets:
+            return MemberOffsets;
+        case ESDKComponent::ProcessEvent:
+            return ProcessEvent;
+        default:
+            return {};
+        }
+    }
+
+    static ESDKStatus SetupComponent(ESDKComponent Component)
+    {
+        switch (Component) {
+        case ESDKComponent::FMemory:
+            return OffsetFinder::FindFMemoryRealloc() ? ESDKStatus::Success : ESDKStatus::Failed_FMemoryRealloc;
+
+        case ESDKComponent::GObjects:
+            return OffsetFinder::FindGObjects() ? ESDKStatus::Success : ESDKStatus::Failed_GObjects;
+
+        case ESDKComponent::FName:
+            if (!OffsetFinder::FindFNameConstructorNarrow())
+                return ESDKStatus::Failed_NarrowFNameConstructor;
+
+            if (!OffsetFinder::FindFNameConstructorWide())
+                return ESDKStatus::Failed_WideFNameConstructor;
+
+            if (!OffsetFinder::FindAppendString())
+                return ESDKStatus::Failed_AppendString;
+
+            return ESDKStatus::Success;
+
+        case ESDKComponent::MemberOffsets:
+            // A retry starts the steps over.
+            StepsDone = 0;
+            Steps = 0;
+            return OffsetFinder::SetupMemberOffsets([](size_t Done, size_t Total) {
+                Steps = static_cast<uint32_t>(Total);
+                StepsDone = static_cast<uint32_t>(Done);
+            });
+
+        case ESDKComponent::ProcessEvent:
+            return OffsetFinder::FindProcessEventIdx() ? ESDKStatus::Success : ESDKStatus::Failed_ProcessEvent;
+
+        default:
+            throw std::invalid_argument("Invalid ESDKComponent");
+        }
+    }
+
+    static ESDKStatus SetupWithRequirements(ESDKComponent Component)
     {
-        if (State::Setup)
-            return ESDKStatus::Failed_AlreadySetup;
+        const size_t Index = static_cast<size_t>(Component);
+        if (Index >= kNumComponents)
+            throw std::invalid_argument("Invalid ESDKComponent");
+
+        for (ESDKComponent Required : GetRequirements(Component)) {
+            if (const auto Status = SetupWithRequirements(Required); Status != ESDKStatus::Success)
+                return Status;
+        }
+
+        std::unique_lock Lock(InitMutex);
+
+        // A thread that waited on a failed attempt returns its failure instead of scanning again right away.
+        const uint32_t Failures = ComponentFailures[Index];
+        InitCondition.wait(Lock, [Index]() { return ComponentStates[Index] != EComponentState::Running; });
+
+        if (ComponentStates[Index] == EComponentState::Done)
+            return ESDKStatus::Success;
+
+        if (ComponentFailures[Index] != Failures)
+            return ComponentStatuses[Index];
 
-        if (!OffsetFinder::FindFMemoryRealloc())
-            return ESDKStatus::Failed_FMemoryRealloc;
+        ComponentStates[Index] = EComponentState::Running;
+        Lock.unlock();
 
-        if (!OffsetFinder::FindGObjects())
-            return ESDKStatus::Failed_GObjects;
+        ESDKStatus Status;
+        try {
+            Status = SetupComponent(Component);
+        }
+        catch (...) {
+            Lock.lock();
+            ComponentStates[Index] = EComponentState::Pending;
+            InitCondition.notify_all();
+            throw;
+        }
+
+        Lock.lock();
+        if (Status == ESDKStatus::Success) {
+            ComponentStates[Index] = EComponentState::Done;
+            State::Setup = ++ComponentsDone == kNumComponents;
+        }
+        else {
+            // Failed components are tried again by the next call, e.g. once the game loaded further.
+            ComponentStates[Index] = EComponentState::Pending;
+            ComponentStatuses[Index] = Status;
+            ComponentFailures[Index]++;
+        }
+
+        InitCondition.notify_all();
+        return Status;
+    }
+
+    ESDKStatus EnsureInitialized(ESDKComponent Component, bool ContinueInBackground)
+    {
+        const ESDKStatus Status = SetupWithRequirements(Component);
 
-        if (!OffsetFinder::FindFNameConstructorNarrow())
-            return ESDKStatus::Failed_NarrowFNameConstructor;
+        if (Status == ESDKStatus::Success && ContinueInBackground) {
+            bool Setup;
+            {
+                std::scoped_lock Lock(InitMutex);
+                Setup = State::Setup;
+            }
 
-        if (!OffsetFinder::FindFNameConstructorWide())
-            return ESDKStatus::Failed_WideFNameConstructor;
+            if (!Setup)
+                InitAsync();
+        }
 
-        if (!OffsetFinder::FindAppendString())
-            return ESDKStatus::Failed_AppendString;
+        return Status;
+    }
 
-        if (const auto Status = OffsetFinder::SetupMemberOffsets(); Status != ESDKStatus::Success)
-            return Status;
+    ESDKStatus Init()
+    {
+        {
+            std::scoped_lock Lock(InitMutex);
+            if (State::Setup)
+                return ESDKStatus::Failed_AlreadySetup;
+        }
 
-        if (!OffsetFinder::FindProcessEventIdx())
-            return ESDKStatus::Failed_ProcessEvent;
+        // In declaration order, so the first failure is the same whichever components were demanded before.
+        for (size_t i = 0; i < kNumComponents; i++) {
+            if (const auto Status = SetupWithRequirements(static_cast<ESDKComponent>(i)); Status != ESDKStatus::Success)
+                return Status;
+        }
 
-        State::Setup = true;
         return ESDKStatus::Success;
     }
+
+    std::shared_future<ESDKStatus> InitAsync()
+    {
+        std::scoped_lock Lock(InitMutex);
+
+        // A finished run that failed is started over, like calling Init again.
+        const bool Failed = AsyncInit.valid() && AsyncInit.wait_for(std::chrono::seconds(0)) == std::future_status::ready && !State::Setup;
+        if (!AsyncInit.valid() || Failed)
+            AsyncInit = std::async(std::launch::async, Init).share();
+
+        return AsyncInit;
+    }
+
+    FInitProgress GetInitProgress()
+    {
+        FInitProgress Progress;
+        Progress.ComponentsDone = ComponentsDone;
+        Progress.StepsDone = StepsDone;
+        Progress.Steps = Steps;
+        return Progress;
+    }
 }
@@ -1,23 +1,251 @@
 #include <uesdk/Offsets.hpp>
 #include <uesdk/core/FMemory.hpp>
 
+#include <private/FMemoryStats.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
 namespace SDK::FMemory
 {
-    using ReallocParams = void* (*)(void* Original, uint32_t Size, uint32_t Alignment);
+    static ReallocFunc g_Backend = nullptr;
+
+    static inline ReallocFunc GetReallocFunction()
+    {
+        return g_Backend ? g_Backend : reinterpret_cast<ReallocFunc>(Offsets::FMemory::Realloc);
+    }
 
-    void Free(void* Original)
+    void SetBackend(ReallocFunc Backend)
+    {
+        g_Backend = Backend;
+    }
+    ReallocFunc GetBackend()
     {
-        ReallocParams ReallocFunction = reinterpret_cast<ReallocParams>(Offsets::FMemory::Realloc);
-        ReallocFunction(Original, 0, 0);
+        return g_Backend;
     }
-    [[nodiscard]] void* Malloc(uint32_t Size, uint32_t Alignment)
+
+    // Stored directly before every HostRealloc allocation.
+    struct FHostAllocHeader
     {
-        ReallocParams ReallocFunction = reinterpret_cast<ReallocParams>(Offsets::FMemory::Realloc);
-        return ReallocFunction(nullptr, Size, Alignment);
+        void* Raw;
+        uint32_t Size;
+        uint32_t Alignment;
+    };
+
+    [[nodiscard]] void* HostRealloc(void* Original, uint32_t Size, uint32_t Alignment)
+    {
+        FHostAllocHeader* OriginalHeader = Original ? reinterpret_cast<FHostAllocHeader*>(Original) - 1 : nullptr;
+
+        if (Size == 0) {
+            if (OriginalHeader)
+                std::free(OriginalHeader->Raw);
+
+            return nullptr;
+        }
+
+        // Same default as the engine, 16 bytes for allocations of at least 16 bytes, otherwise 8.
+        if (Alignment == 0)
+            Alignment = Size >= 16 ? 16 : 8;
+
+        Alignment = std::max<uint32_t>(Alignment, alignof(FHostAllocHeader));
+
+        const size_t TotalSize = static_cast<size_t>(Size) + Alignment + sizeof(FHostAllocHeader);
+        uint8_t* Raw = static_cast<uint8_t*>(std::malloc(TotalSize));
+        if (!Raw)
+            throw std::bad_alloc();
+
+        const uintptr_t Unaligned = reinterpret_cast<uintptr_t>(Raw) + sizeof(FHostAllocHeader);
+        uint8_t* Data = reinterpret_cast<uint8_t*>((Unaligned + Alignment - 1) & ~static_cast<uintptr_t>(Alignment - 1));
+
+        FHostAllocHeader* Header = reinterpret_cast<FHostAllocHeader*>(Data) - 1;
+        Header->Raw = Raw;
+        Header->Size = Size;
+        Header->Alignment = Alignment;
+
+        if (OriginalHeader) {
+            std::memcpy(Data, Original, std::min(Size, OriginalHeader->Size));
+            std::free(OriginalHeader->Raw);
+        }
+
+        return Data;
     }
-    [[nodiscard]] void* Realloc(void* Original, uint32_t Size, uint32_t Alignment)
+
+    /**
+     * @brief Per-thread slabs of fixed-size blocks, one slab per size class, carved out of a single host allocation.
+     * @brief Block occupancy is a bitmask per class, so allocating and releasing never takes a lock.
+     */
+    class FScratchSlabs
     {
-        ReallocParams ReallocFunction = reinterpret_cast<ReallocParams>(Offsets::FMemory::Realloc);
-        return ReallocFunction(Original, Size, Alignment);
+    private:
+        static constexpr uint32_t kNumClasses = 3;
+        static constexpr uint32_t kBlocksPerClass = 8;
+        static constexpr uint32_t kBlockSizes[kNumClasses] = { 256, 1024, 4096 };
+        static constexpr uint32_t kMaxAlignment = 64;
+
+    public:
+        static constexpr uint32_t kMaxBlockSize = kBlockSizes[kNumClasses - 1];
+
+    public:
+        ~FScratchSlabs()
+        {
+            std::free(m_Raw);
+        }
+
+    public:
+        void* Allocate(uint32_t Size, uint32_t Alignment)
+        {
+            if (Size > kMaxBlockSize || Alignment > kMaxAlignment)
+                return nullptr;
+
+            if (!m_Base && !Commit())
+                return nullptr;
+
+            for (uint32_t Class = 0; Class < kNumClasses; Class++) {
+                if (Size > kBlockSizes[Class] || m_UsedMask[Class] == UINT8_MAX)
+                    continue;
+
+                const uint32_t Block = std::countr_one(m_UsedMask[Class]);
+                m_UsedMask[Class] |= static_cast<uint8_t>(1u << Block);
+
+                return m_ClassBase[Class] + Block * kBlockSizes[Class];
+            }
+
+            return nullptr;
+        }
+
+        void Release(const void* Ptr)
+        {
+            const uint32_t Class = GetClass(Ptr);
+            const uint32_t Block = static_cast<uint32_t>((static_cast<const uint8_t*>(Ptr) - m_ClassBase[Class]) / kBlockSizes[Class]);
+
+            m_UsedMask[Class] &= static_cast<uint8_t>(~(1u << Block));
+        }
+
+        inline bool Owns(const void* Ptr) const
+        {
+            return Ptr >= m_Base && Ptr < m_End;
+        }
+
+        inline uint32_t GetBlockSize(const void* Ptr) const
+        {
+            return kBlockSizes[GetClass(Ptr)];
+        }
+
+    private:
+        bool Commit()
+        {
+            size_t TotalSize = 0;
+            for (uint32_t BlockSize : kBlockSizes)
+                TotalSize += static_cast<size_t>(BlockSize) * kBlocksPerClass;
+
+            m_Raw = static_cast<uint8_t*>(std::malloc(TotalSize + kMaxAlignment));
+            if (!m_Raw)
+                return false;
+
+            m_Base = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(m_Raw) + kMaxAlignment - 1) & ~static_cast<uintptr_t>(kMaxAlignment - 1));
+            m_End = m_Base + TotalSize;
+
+            uint8_t* ClassBase = m_Base;
+            for (uint32_t Class = 0; Class < kNumClasses; Class++) {
+                m_ClassBase[Class] = ClassBase;
+                ClassBase += static_cast<size_t>(kBlockSizes[Class]) * kBlocksPerClass;
+            }
+
+            return true;
+        }
+
+        inline uint32_t GetClass(const void* Ptr) const
+        {
+            uint32_t Class = 0;
+            while (Class + 1 < kNumClasses && Ptr >= m_ClassBase[Class + 1])
+                Class++;
+
+            return Class;
+        }
+
+    private:
+        uint8_t* m_Raw = nullptr;
+        uint8_t* m_Base = nullptr;
+        uint8_t* m_End = nullptr;
+        uint8_t* m_ClassBase[kNumClasses] = {};
+        uint8_t m_UsedMask[kNumClasses] = {};
+    };
+
+    static std::atomic<bool> g_ScratchEnabled = false;
+    thread_local static FScratchSlabs g_ScratchSlabs;
+
+    void SetScratchEnabled(bool Enabled)
+    {
+        g_ScratchEnabled.store(Enabled, std::memory_order_relaxed);
+    }
+    bool IsScratchEnabled()
+    {
+        return g_ScratchEnabled.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] void* MallocScratch(uint32_t Size, uint32_t Alignment, EAllocSite Site)
+    {
+        if (IsScratchEnabled()) {
+            if (void* Ptr = g_ScratchSlabs.Allocate(Size, Alignment)) {
+                UESDK_FMEMORY_RECORD(Site, nullptr, Ptr, Size, true);
+                return Ptr;
+            }
+        }
+
+        return Malloc(Size, Alignment, Site);
+    }
+    bool IsScratch(const void* Ptr)
+    {
+        return g_ScratchSlabs.Owns(Ptr);
+    }
+
+    void Free(void* Original, [[maybe_unused]] EAllocSite Site)
+    {
+        if (g_ScratchSlabs.Owns(Original)) {
+            UESDK_FMEMORY_RECORD(Site, Original, nullptr, 0, true);
+            g_ScratchSlabs.Release(Original);
+            return;
+        }
+
+        UESDK_FMEMORY_RECORD(Site, Original, nullptr, 0, false);
+        GetReallocFunction()(Original, 0, 0);
+    }
+    [[nodiscard]] void* Malloc(uint32_t Size, uint32_t Alignment, [[maybe_unused]] EAllocSite Site)
+    {
+        void* Result = GetReallocFunction()(nullptr, Size, Alignment);
+        UESDK_FMEMORY_RECORD(Site, nullptr, Result, Size, false);
+        return Result;
+    }
+    [[nodiscard]] void* Realloc(void* Original, uint32_t Size, uint32_t Alignment, [[maybe_unused]] EAllocSite Site)
+    {
+        if (g_ScratchSlabs.Owns(Original)) {
+            const uint32_t BlockSize = g_ScratchSlabs.GetBlockSize(Original);
+
+            if (Size == 0) {
+                UESDK_FMEMORY_RECORD(Site, Original, nullptr, 0, true);
+                g_ScratchSlabs.Release(Original);
+                return nullptr;
+            }
+
+            // Shrinking, or growing within the block, keeps the allocation in place.
+            if (Size <= BlockSize) {
+                UESDK_FMEMORY_RECORD(Site, Original, Original, Size, true);
+                return Original;
+            }
+
+            void* Moved = GetReallocFunction()(nullptr, Size, Alignment);
+            UESDK_FMEMORY_RECORD(Site, Original, Moved, Size, false);
+            std::memcpy(Moved, Original, BlockSize);
+            g_ScratchSlabs.Release(Original);
+            return Moved;
+        }
+
+        void* Result = GetReallocFunction()(Original, Size, Alignment);
+        UESDK_FMEMORY_RECORD(Site, Original, Result, Size, false);
+        return Result;
     }
 }
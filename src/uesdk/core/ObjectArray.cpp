@@ -15,6 +15,13 @@ namespace SDK
 
         return GetDecrytedObjPtr()[ChunkIndex][InChunkIdx].Object;
     }
+    FUObjectItem* Chunked_TUObjectArray::GetItemByIndex(const int32_t Index) const
+    {
+        if (Index < 0 || Index >= NumElements)
+            return nullptr;
+
+        return &GetDecrytedObjPtr()[Index / ElementsPerChunk][Index % ElementsPerChunk];
+    }
     UObject* Fixed_TUObjectArray::GetByIndex(const int32_t Index) const
     {
         if (Index < 0 || Index > NumElements)
@@ -22,6 +29,13 @@ namespace SDK
 
         return GetDecrytedObjPtr()[Index].Object;
     }
+    FUObjectItem* Fixed_TUObjectArray::GetItemByIndex(const int32_t Index) const
+    {
+        if (Index < 0 || Index >= NumElements)
+            return nullptr;
+
+        return &GetDecrytedObjPtr()[Index];
+    }
 
     TUObjectArray::TUObjectArray(bool IsChunked, void* Objects)
         : m_IsChunked(IsChunked)
@@ -59,4 +73,13 @@ namespace SDK
 
         return nullptr;
     }
+    FUObjectItem* TUObjectArray::GetItemByIndex(int32_t Index)
+    {
+        if (m_IsChunked && m_ChunkedObjects)
+            return m_ChunkedObjects->GetItemByIndex(Index);
+        else if (!m_IsChunked && m_FixedObjects)
+            return m_FixedObjects->GetItemByIndex(Index);
+
+        return nullptr;
+    }
 }
@@ -3,6 +3,160 @@
 #include <uesdk/State.hpp>
 #include <uesdk/core/UnrealContainers.hpp>
 #include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/CallProfiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+// UEnum lookup cache.
+//
+namespace SDK
+{
+    /** @brief Lookup tables built from a snapshot of UEnum::Names. Immutable once published. */
+    struct FEnumLookup
+    {
+        // Invalidation key, the engine reallocates Names whenever enumerators are added or removed.
+        const void* NamesData = nullptr;
+        int32_t NamesNum = 0;
+
+        std::unordered_map<uint32_t, int64_t> NameToValue;
+        std::unordered_map<int64_t, FName> ValueToName;
+
+        // Contiguous enums are served from an array indexed by (Value - DenseMin), holes are None.
+        int64_t DenseMin = 0;
+        std::vector<FName> Dense;
+
+        bool IsBitflags = false;
+        FName ZeroName;
+        std::vector<std::pair<int64_t, FName>> Bits;
+    };
+
+    static std::shared_mutex EnumLookupMutex;
+    static std::unordered_map<const UEnum*, std::shared_ptr<const FEnumLookup>> EnumLookups;
+
+    static std::shared_ptr<const FEnumLookup> BuildEnumLookup(const TArray<TPair<FName, int64_t>>& Names)
+    {
+        auto Lookup = std::make_shared<FEnumLookup>();
+        Lookup->NamesData = Names.GetData();
+        Lookup->NamesNum = Names.Num();
+
+        const int32_t Num = Names.IsValid() ? Names.Num() : 0;
+        const TPair<FName, int64_t>* Entries = Names.GetData();
+
+        int64_t MinValue = INT64_MAX;
+        int64_t MaxValue = INT64_MIN;
+
+        Lookup->NameToValue.reserve(Num);
+        Lookup->ValueToName.reserve(Num);
+        for (int32_t i = 0; i < Num; i++) {
+            const FName& Name = Entries[i].Key();
+            const int64_t Value = Entries[i].Value();
+
+            // emplace keeps the first match, same as the original linear scan.
+            Lookup->NameToValue.emplace(Name.ComparisonIndex, Value);
+            Lookup->ValueToName.emplace(Value, Name);
+
+            MinValue = std::min(MinValue, Value);
+            MaxValue = std::max(MaxValue, Value);
+        }
+
+        if (Num == 0)
+            return Lookup;
+
+        constexpr uint64_t kMaxDenseSlack = 64;
+        // Subtracted as unsigned, the distance between two int64_t values doesn't always fit an int64_t.
+        const uint64_t Distance = static_cast<uint64_t>(MaxValue) - static_cast<uint64_t>(MinValue);
+        if (Distance < static_cast<uint64_t>(Num) * 2 || Distance < kMaxDenseSlack) {
+            Lookup->DenseMin = MinValue;
+            Lookup->Dense.resize(Distance + 1);
+
+            for (const auto& [Value, Name] : Lookup->ValueToName)
+                Lookup->Dense[static_cast<uint64_t>(Value) - static_cast<uint64_t>(MinValue)] = Name;
+        }
+
+        // UHT appends a generated _MAX enumerator, which is never a flag itself.
+        const bool HasMaxEntry = Num > 1 && Entries[Num - 1].Value() == MaxValue;
+        const int32_t NumFlagCandidates = HasMaxEntry ? Num - 1 : Num;
+
+        bool AllSingleBits = true;
+        int64_t HighestBit = 0;
+        for (int32_t i = 0; i < NumFlagCandidates; i++) {
+            const int64_t Value = Entries[i].Value();
+            if (Value == 0) {
+                if (!Lookup->ZeroName.ComparisonIndex)
+                    Lookup->ZeroName = Entries[i].Key();
+                continue;
+            }
+
+            if (Value < 0 || (Value & (Value - 1)) != 0) {
+                AllSingleBits = false;
+                continue;
+            }
+
+            HighestBit = std::max(HighestBit, Value);
+            Lookup->Bits.emplace_back(Value, Entries[i].Key());
+        }
+
+        std::sort(Lookup->Bits.begin(), Lookup->Bits.end(), [](const auto& Left, const auto& Right) {
+            return Left.first < Right.first;
+        });
+        Lookup->Bits.erase(std::unique(Lookup->Bits.begin(), Lookup->Bits.end(), [](const auto& Left, const auto& Right) {
+            return Left.first == Right.first;
+        }),
+            Lookup->Bits.end());
+
+        // A plain 0..N enum only ever contains 0x4 if it also contains 0x3, so requiring a bit above 0x2 rules them out.
+        Lookup->IsBitflags = AllSingleBits && Lookup->Bits.size() >= 2 && HighestBit > 0x2;
+
+        return Lookup;
+    }
+
+    static const FEnumLookup* GetEnumLookup(const UEnum* Enum)
+    {
+        // Per-thread memo of the last lookup, so repeated decoding of the same enum never touches the lock.
+        thread_local const UEnum* LastEnum = nullptr;
+        thread_local std::shared_ptr<const FEnumLookup> LastLookup;
+
+        const auto& Names = Enum->Names;
+        const void* NamesData = Names.GetData();
+        const int32_t NamesNum = Names.Num();
+
+        auto IsCurrent = [NamesData, NamesNum](const FEnumLookup& Lookup) {
+            return Lookup.NamesData == NamesData && Lookup.NamesNum == NamesNum;
+        };
+
+        if (LastEnum == Enum && IsCurrent(*LastLookup))
+            return LastLookup.get();
+
+        {
+            std::shared_lock Lock(EnumLookupMutex);
+
+            auto It = EnumLookups.find(Enum);
+            if (It != EnumLookups.end() && IsCurrent(*It->second)) {
+                LastEnum = Enum;
+                LastLookup = It->second;
+                return LastLookup.get();
+            }
+        }
+
+        std::unique_lock Lock(EnumLookupMutex);
+
+        auto& Entry = EnumLookups[Enum];
+        if (!Entry || !IsCurrent(*Entry))
+            Entry = BuildEnumLookup(Names);
+
+        LastEnum = Enum;
+        LastLookup = Entry;
+        return LastLookup.get();
+    }
+}
 
 namespace SDK
 {
@@ -51,9 +205,143 @@ namespace SDK
     {
         using ProcessEvent_t = void (*)(UObject*, UFunction*, void*);
         ProcessEvent_t PE = reinterpret_cast<ProcessEvent_t>(VFT[Offsets::UObject::ProcessEventIdx]);
+
+        // PECallWrapper and DynamicCall time their own calls with the marshalling around them.
+        if (!Profiler::FCallScope::ClaimCallee(Function)) {
+            Profiler::FCallScope Profile(Function, Function->ParmsSize);
+            Profile.BeginCallee();
+            Profiler::FCallScope::ClaimCallee(Function);
+            PE(this, Function, Parms);
+            Profile.EndCallee();
+            return;
+        }
+
         PE(this, Function, Parms);
     }
 
+    // Native calls.
+    //
+
+    // FFrame derives from FOutputDevice, thunks only use its virtuals to log script errors.
+    static uintptr_t NullOutputDeviceFunc()
+    {
+        return 0;
+    }
+    static const std::array<void*, 32> NullOutputDeviceVFT = [] {
+        std::array<void*, 32> VFT;
+        VFT.fill(reinterpret_cast<void*>(&NullOutputDeviceFunc));
+        return VFT;
+    }();
+
+    struct FOutParmRec
+    {
+        FProperty* Property;
+        uint8_t* PropAddr;
+        FOutParmRec* NextOutParm;
+    };
+
+    static constexpr size_t kMaxFrameSize = 0x200;
+    static constexpr size_t kMaxNativeOutParms = 32;
+
+    static bool HasFrameLayout()
+    {
+        using namespace Offsets::FFrame;
+
+        for (Offsets::Offset_t Offset : { Node, Object, Code, Locals, OutParms, PropertyChainForCompiledIn, CurrentNativeFunction, Size }) {
+            if (Offset == OFFSET_NOT_FOUND)
+                return false;
+        }
+
+        return static_cast<size_t>(Size) <= kMaxFrameSize;
+    }
+
+    // True if Function is the implementation Class would dispatch to, i.e. Class derives from the function's owner
+    // and no class in between declares a function with the same name.
+    static bool IsResolvedImplementation(UClass* Class, UFunction* Function)
+    {
+        thread_local static UClass* LastClass = nullptr;
+        thread_local static UFunction* LastFunction = nullptr;
+        thread_local static bool LastResult = false;
+
+        if (Class == LastClass && Function == LastFunction)
+            return LastResult;
+
+        const UObject* Owner = Function->Outer;
+
+        bool Result = false;
+        for (UStruct* Super = Class; Super; Super = Super->SuperStruct) {
+            if (Super == Owner) {
+                Result = true;
+                break;
+            }
+
+            if (Super->FindFunction(Function->Name))
+                break;
+        }
+
+        LastClass = Class;
+        LastFunction = Function;
+        LastResult = Result;
+        return Result;
+    }
+
+    void UObject::CallNative(UFunction* Function, void* Parms)
+    {
+        const EFunctionFlags Flags = Function->FunctionFlags;
+
+        if (!State::UsesFProperty || !Function->Func || !(Flags & FUNC_Native) || (Flags & FUNC_Net) || !HasFrameLayout() || !IsResolvedImplementation(Class, Function)) {
+            ProcessEvent(Function, Parms);
+            return;
+        }
+
+        uint8_t* Locals = static_cast<uint8_t*>(Parms);
+
+        // Same out parameter list ProcessEvent hands to the thunk, used by P_GET_*_REF.
+        FOutParmRec OutParmRecs[kMaxNativeOutParms];
+        FOutParmRec* FirstOutParm = nullptr;
+        FOutParmRec** LastOutParm = &FirstOutParm;
+        size_t NumOutParms = 0;
+
+        for (FField* Field = Function->ChildProperties; Field; Field = Field->Next) {
+            if (!Field->HasTypeFlag(CASTCLASS_FProperty))
+                continue;
+
+            FProperty* Property = static_cast<FProperty*>(Field);
+            if (!Property->HasPropertyFlag(CPF_OutParm))
+                continue;
+
+            if (NumOutParms == kMaxNativeOutParms) {
+                ProcessEvent(Function, Parms);
+                return;
+            }
+
+            FOutParmRec& Rec = OutParmRecs[NumOutParms++];
+            Rec = { Property, Locals + Property->Offset, nullptr };
+
+            *LastOutParm = &Rec;
+            LastOutParm = &Rec.NextOutParm;
+        }
+
+        alignas(16) uint8_t Frame[kMaxFrameSize] = {};
+        auto SetFrameMember = [&Frame](Offsets::Offset_t Offset, const void* Value) {
+            std::memcpy(Frame + Offset, &Value, sizeof(Value));
+        };
+
+        SetFrameMember(0, NullOutputDeviceVFT.data());
+        SetFrameMember(Offsets::FFrame::Node, Function);
+        SetFrameMember(Offsets::FFrame::Object, this);
+        SetFrameMember(Offsets::FFrame::Code, nullptr); // No bytecode, P_GET_* reads from Locals through PropertyChainForCompiledIn.
+        SetFrameMember(Offsets::FFrame::Locals, Locals);
+        SetFrameMember(Offsets::FFrame::OutParms, FirstOutParm);
+        SetFrameMember(Offsets::FFrame::PropertyChainForCompiledIn, static_cast<FField*>(Function->ChildProperties));
+        SetFrameMember(Offsets::FFrame::CurrentNativeFunction, Function);
+
+        const uint16_t ReturnValueOffset = Function->ReturnValueOffset;
+        void* Result = ReturnValueOffset != UINT16_MAX && Locals ? Locals + ReturnValueOffset : nullptr;
+
+        Function->Func(this, Frame, Result);
+    }
+
     UField* UStruct::FindMember(const FName& Name, EClassCastFlags TypeFlag) const
     {
         for (UField* Child = Children; Child; Child = Child->Next) {
@@ -80,6 +368,8 @@ namespace SDK
                     Result.Found = true;
                     Result.Flags = Property->PropertyFlags;
                     Result.Offset = Property->Offset;
+                    Result.ElementSize = Property->ElementSize;
+                    Result.FProp = Property;
 
                     if (Property->HasTypeFlag(CASTCLASS_FBoolProperty)) {
                         FBoolProperty* BoolProperty = reinterpret_cast<FBoolProperty*>(Property);
@@ -103,8 +393,10 @@ namespace SDK
 
                 if (Child->Name == Name) {
                     Result.Found = true;
-                    Result.Flags = Child->Flags;
+                    Result.Flags = Property->PropertyFlags;
                     Result.Offset = Property->Offset;
+                    Result.ElementSize = Property->ElementSize;
+                    Result.Prop = Property;
 
                     if (Property->HasTypeFlag(CASTCLASS_FBoolProperty)) {
                         UBoolProperty* BoolProperty = reinterpret_cast<UBoolProperty*>(Property);
@@ -166,15 +458,94 @@ namespace SDK
         return 0xFF;
     }
 
+    uint8_t* UDataTable::FindRowUnchecked(const FName& RowName) const
+    {
+        // 0 = untested, 1 = hashed lookups work, -1 = the engine hashes FNames differently.
+        static std::atomic<int8_t> HashedLookupState = 0;
+
+        const TMap<FName, uint8_t*>& Map = RowMap;
+        auto Equals = [](const FName& Left, const FName& Right) {
+            return Left == Right && Left.Number == Right.Number;
+        };
+
+        if (HashedLookupState.load(std::memory_order_relaxed) >= 0) {
+            if (uint8_t* const* Row = Map.FindByHash(RowName, GetTypeHash(RowName), Equals))
+                return *Row;
+
+            if (HashedLookupState.load(std::memory_order_relaxed) == 1)
+                return nullptr;
+
+            // Verify the hash against a row we know exists before trusting a miss.
+            auto First = begin(Map);
+            if (First == end(Map))
+                return nullptr;
+
+            const FName& KnownName = First->Key();
+            const bool HashWorks = Map.FindByHash(KnownName, GetTypeHash(KnownName), Equals) != nullptr;
+            HashedLookupState.store(HashWorks ? 1 : -1, std::memory_order_relaxed);
+
+            if (HashWorks)
+                return nullptr;
+        }
+
+        for (auto It = begin(Map); It != end(Map); ++It) {
+            if (Equals(It->Key(), RowName))
+                return It->Value();
+        }
+
+        return nullptr;
+    }
+
     int64_t UEnum::FindEnumerator(const FName& Name) const
     {
-        auto NamesArray = Names;
-        for (auto& It : NamesArray) {
-            if (It.Key() == Name) {
-                return It.Value();
+        const FEnumLookup* Lookup = GetEnumLookup(this);
+
+        auto It = Lookup->NameToValue.find(Name.ComparisonIndex);
+        if (It == Lookup->NameToValue.end())
+            return OFFSET_NOT_FOUND;
+
+        return It->second;
+    }
+    FName UEnum::FindEnumeratorName(int64_t Value) const
+    {
+        const FEnumLookup* Lookup = GetEnumLookup(this);
+
+        if (!Lookup->Dense.empty()) {
+            const uint64_t DenseIndex = static_cast<uint64_t>(Value) - static_cast<uint64_t>(Lookup->DenseMin);
+            return DenseIndex < Lookup->Dense.size() ? Lookup->Dense[DenseIndex] : FName();
+        }
+
+        auto It = Lookup->ValueToName.find(Value);
+        if (It == Lookup->ValueToName.end())
+            return FName();
+
+        return It->second;
+    }
+    bool UEnum::IsBitflags() const
+    {
+        return GetEnumLookup(this)->IsBitflags;
+    }
+    std::vector<FName> UEnum::DecomposeFlags(int64_t Value, int64_t* OutRemainder) const
+    {
+        const FEnumLookup* Lookup = GetEnumLookup(this);
+
+        std::vector<FName> Result;
+        if (Value == 0) {
+            if (Lookup->ZeroName.ComparisonIndex)
+                Result.push_back(Lookup->ZeroName);
+        }
+        else {
+            for (const auto& [Bit, Name] : Lookup->Bits) {
+                if (Value & Bit) {
+                    Result.push_back(Name);
+                    Value &= ~Bit;
+                }
             }
         }
 
-        return OFFSET_NOT_FOUND;
+        if (OutRemainder)
+            *OutRemainder = Value;
+
+        return Result;
     }
 }
@@ -34,7 +34,11 @@ namespace SDK
         if (!AppendString)
             AppendString = reinterpret_cast<void (*)(const FName*, FString*)>(Offsets::FName::AppendString);
 
-        FString TempString;
+        // NAME_SIZE characters plus the "_Number" suffix, so the engine never has to grow (and reallocate) the scratch buffer.
+        constexpr int32_t kMaxNameLength = 1024 + 16;
+
+        // Without the slabs MallocScratch falls back to the engine allocator, let the engine size the string itself then.
+        FString TempString = FMemory::IsScratchEnabled() ? FString::Scratch(kMaxNameLength) : FString();
         AppendString(const_cast<FName*>(this), &TempString);
 
         return TempString.ToString();
@@ -0,0 +1,385 @@
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/CallProfiler.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace SDK::Profiler
+{
+#ifdef UESDK_PROFILER
+    // Log-linear buckets, 4 per power of two. Values below 4 get their own bucket.
+    static constexpr size_t kNumBuckets = 256;
+    static constexpr size_t kNumTraceEvents = 8192;
+
+    static inline size_t GetBucket(uint64_t Ticks)
+    {
+        if (Ticks < 4)
+            return static_cast<size_t>(Ticks);
+
+        const size_t Exponent = 63 - std::countl_zero(Ticks);
+        const size_t Sub = static_cast<size_t>(Ticks >> (Exponent - 2)) & 3;
+        return 4 + (Exponent - 2) * 4 + Sub;
+    }
+
+    static inline double GetBucketMidpoint(size_t Bucket)
+    {
+        if (Bucket < 4)
+            return static_cast<double>(Bucket);
+
+        const size_t Exponent = (Bucket - 4) / 4 + 2;
+        const size_t Sub = (Bucket - 4) % 4;
+        const double Lower = static_cast<double>((4 + Sub) << (Exponent - 2));
+        return Lower + static_cast<double>(size_t(1) << (Exponent - 2)) * 0.5;
+    }
+
+    // Every counter has a single writer, the owning thread. Relaxed atomics let Collect read them without locking.
+    struct FFunctionEntry
+    {
+        UFunction* Function = nullptr;
+        uint32_t ParmsSize = 0;
+        FFunctionEntry* Next = nullptr; // Older entry of the same thread, immutable once published.
+
+        std::atomic<uint64_t> Calls = 0;
+        std::atomic<uint64_t> TotalTicks = 0;
+        std::atomic<uint64_t> CalleeTicks = 0;
+        std::array<std::atomic<uint64_t>, kNumBuckets> Buckets = {};
+    };
+
+    struct FTraceEvent
+    {
+        std::atomic<UFunction*> Function = nullptr;
+        std::atomic<uint64_t> Start = 0;
+        std::atomic<uint64_t> CalleeStart = 0;
+        std::atomic<uint64_t> CalleeEnd = 0;
+        std::atomic<uint64_t> End = 0;
+    };
+
+    struct FThreadProfile
+    {
+        uint32_t ThreadId = 0;
+        std::atomic<FFunctionEntry*> Entries = nullptr;
+
+        std::unique_ptr<FTraceEvent[]> Events = std::make_unique<FTraceEvent[]>(kNumTraceEvents);
+        std::atomic<uint64_t> NumEvents = 0;
+        std::atomic<uint64_t> TraceStart = 0; // Events before this were cleared by Reset.
+
+        ~FThreadProfile()
+        {
+            FFunctionEntry* Entry = Entries.load(std::memory_order_relaxed);
+            while (Entry) {
+                FFunctionEntry* Next = Entry->Next;
+                delete Entry;
+                Entry = Next;
+            }
+        }
+    };
+
+    // Profiles are kept after their thread exits so its calls still show up.
+    static std::mutex g_ProfilesMutex;
+    static std::vector<std::shared_ptr<FThreadProfile>> g_Profiles;
+
+    // Reference point to convert TSC ticks to time.
+    static const uint64_t g_StartTSC = ReadTSC();
+    static const auto g_StartTime = std::chrono::steady_clock::now();
+
+    static double GetNsPerTick()
+    {
+        const uint64_t Ticks = ReadTSC() - g_StartTSC;
+        const double Ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_StartTime).count());
+        return Ticks ? Ns / static_cast<double>(Ticks) : 0.0;
+    }
+
+    struct FThreadState
+    {
+        FThreadProfile* Profile = nullptr;
+        std::unordered_map<UFunction*, FFunctionEntry*> Lookup;
+        FFunctionEntry* LastEntry = nullptr;
+    };
+
+    thread_local static FThreadState g_ThreadState;
+
+    static FThreadProfile& GetThreadProfile()
+    {
+        if (!g_ThreadState.Profile) {
+            static std::atomic<uint32_t> NextThreadId = 1;
+
+            auto Profile = std::make_shared<FThreadProfile>();
+            Profile->ThreadId = NextThreadId.fetch_add(1, std::memory_order_relaxed);
+            g_ThreadState.Profile = Profile.get();
+
+            std::scoped_lock Lock(g_ProfilesMutex);
+            g_Profiles.push_back(std::move(Profile));
+        }
+
+        return *g_ThreadState.Profile;
+    }
+
+    static inline void Increment(std::atomic<uint64_t>& Counter, uint64_t Value = 1)
+    {
+        Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+    }
+
+    void RecordCall(UFunction* Function, uint32_t ParmsSize, uint64_t Start, uint64_t CalleeStart, uint64_t CalleeEnd, uint64_t End)
+    {
+        FThreadProfile& Profile = GetThreadProfile();
+
+        FFunctionEntry* Entry = g_ThreadState.LastEntry;
+        if (!Entry || Entry->Function != Function) {
+            FFunctionEntry*& Found = g_ThreadState.Lookup[Function];
+            if (!Found) {
+                Found = new FFunctionEntry();
+                Found->Function = Function;
+                Found->ParmsSize = ParmsSize;
+                Found->Next = Profile.Entries.load(std::memory_order_relaxed);
+                Profile.Entries.store(Found, std::memory_order_release);
+            }
+
+            Entry = g_ThreadState.LastEntry = Found;
+        }
+
+        const uint64_t Total = End - Start;
+
+        Increment(Entry->Calls);
+        Increment(Entry->TotalTicks, Total);
+        Increment(Entry->CalleeTicks, CalleeEnd - CalleeStart);
+        Increment(Entry->Buckets[GetBucket(Total)]);
+
+        const uint64_t EventIndex = Profile.NumEvents.load(std::memory_order_relaxed);
+        FTraceEvent& Event = Profile.Events[EventIndex % kNumTraceEvents];
+        Event.Function.store(Function, std::memory_order_relaxed);
+        Event.Start.store(Start, std::memory_order_relaxed);
+        Event.CalleeStart.store(CalleeStart, std::memory_order_relaxed);
+        Event.CalleeEnd.store(CalleeEnd, std::memory_order_relaxed);
+        Event.End.store(End, std::memory_order_relaxed);
+        Profile.NumEvents.store(EventIndex + 1, std::memory_order_release);
+    }
+
+    static std::vector<std::shared_ptr<FThreadProfile>> GetProfiles()
+    {
+        std::scoped_lock Lock(g_ProfilesMutex);
+        return g_Profiles;
+    }
+#endif
+
+    bool IsEnabled()
+    {
+#ifdef UESDK_PROFILER
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::vector<FFunctionProfile> Collect()
+    {
+        std::vector<FFunctionProfile> Result;
+
+#ifdef UESDK_PROFILER
+        struct FMerged
+        {
+            uint32_t ParmsSize = 0;
+            uint64_t Calls = 0;
+            uint64_t TotalTicks = 0;
+            uint64_t CalleeTicks = 0;
+            std::array<uint64_t, kNumBuckets> Buckets = {};
+        };
+
+        std::unordered_map<UFunction*, FMerged> Merged;
+        for (const auto& Profile : GetProfiles()) {
+            for (FFunctionEntry* Entry = Profile->Entries.load(std::memory_order_acquire); Entry; Entry = Entry->Next) {
+                FMerged& Out = Merged[Entry->Function];
+                Out.ParmsSize = Entry->ParmsSize;
+                Out.Calls += Entry->Calls.load(std::memory_order_relaxed);
+                Out.TotalTicks += Entry->TotalTicks.load(std::memory_order_relaxed);
+                Out.CalleeTicks += Entry->CalleeTicks.load(std::memory_order_relaxed);
+
+                for (size_t i = 0; i < kNumBuckets; i++)
+                    Out.Buckets[i] += Entry->Buckets[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        const double NsPerTick = GetNsPerTick();
+
+        auto GetPercentile = [NsPerTick](const FMerged& Stats, double Percentile) {
+            uint64_t Histogrammed = 0;
+            for (uint64_t Count : Stats.Buckets)
+                Histogrammed += Count;
+
+            const uint64_t Target = static_cast<uint64_t>(static_cast<double>(Histogrammed) * Percentile);
+
+            uint64_t Seen = 0;
+            for (size_t i = 0; i < kNumBuckets; i++) {
+                Seen += Stats.Buckets[i];
+                if (Seen > Target)
+                    return GetBucketMidpoint(i) * NsPerTick;
+            }
+
+            return 0.0;
+        };
+
+        Result.reserve(Merged.size());
+        for (const auto& [Function, Stats] : Merged) {
+            if (!Stats.Calls)
+                continue;
+
+            FFunctionProfile& Out = Result.emplace_back();
+            Out.Function = Function;
+            Out.Name = Function ? Function->GetFullName() : "None";
+            Out.Calls = Stats.Calls;
+            Out.ParmsSize = Stats.ParmsSize;
+            Out.TotalNs = static_cast<double>(Stats.TotalTicks) * NsPerTick;
+            Out.CalleeNs = static_cast<double>(Stats.CalleeTicks) * NsPerTick;
+            Out.MarshalNs = std::max(Out.TotalNs - Out.CalleeNs, 0.0);
+            Out.P50Ns = GetPercentile(Stats, 0.50);
+            Out.P99Ns = GetPercentile(Stats, 0.99);
+        }
+
+        std::sort(Result.begin(), Result.end(), [](const FFunctionProfile& A, const FFunctionProfile& B) {
+            return A.TotalNs > B.TotalNs;
+        });
+#endif
+
+        return Result;
+    }
+
+    // Quoted, with quotes doubled. Commas and backslashes need nothing else inside quotes.
+    static void WriteCSVField(std::ostream& Stream, const std::string& Field)
+    {
+        Stream << '"';
+        for (char Char : Field) {
+            if (Char == '"')
+                Stream << '"';
+            Stream << Char;
+        }
+        Stream << '"';
+    }
+
+#ifdef UESDK_PROFILER
+    static void WriteJSONString(std::ostream& Stream, const std::string& String)
+    {
+        Stream << '"';
+        for (char Char : String) {
+            switch (Char) {
+            case '"':
+            case '\\':
+                Stream << '\\' << Char;
+                break;
+            case '\n':
+                Stream << "\\n";
+                break;
+            case '\r':
+                Stream << "\\r";
+                break;
+            case '\t':
+                Stream << "\\t";
+                break;
+            default:
+                // Other control characters have no short escape.
+                if (static_cast<unsigned char>(Char) < 0x20) {
+                    const char* const Hex = "0123456789abcdef";
+                    Stream << "\\u00" << Hex[Char >> 4] << Hex[Char & 0xF];
+                }
+                else {
+                    Stream << Char;
+                }
+                break;
+            }
+        }
+        Stream << '"';
+    }
+#endif
+
+    std::string ExportCSV()
+    {
+        std::ostringstream Stream;
+        Stream << std::fixed << std::setprecision(1);
+        Stream << "Function,Calls,ParmsSize,TotalNs,CalleeNs,MarshalNs,AvgNs,P50Ns,P99Ns\n";
+
+        for (const FFunctionProfile& Profile : Collect()) {
+            WriteCSVField(Stream, Profile.Name);
+            Stream << ',' << Profile.Calls << ',' << Profile.ParmsSize << ','
+                   << Profile.TotalNs << ',' << Profile.CalleeNs << ',' << Profile.MarshalNs << ','
+                   << Profile.TotalNs / static_cast<double>(Profile.Calls) << ',' << Profile.P50Ns << ',' << Profile.P99Ns << '\n';
+        }
+
+        return Stream.str();
+    }
+
+    std::string ExportChromeTrace()
+    {
+        std::ostringstream Stream;
+        Stream << std::fixed << std::setprecision(3);
+        Stream << "{\"traceEvents\":[";
+
+#ifdef UESDK_PROFILER
+        const double UsPerTick = GetNsPerTick() / 1000.0;
+        std::unordered_map<UFunction*, std::string> Names;
+
+        bool First = true;
+        auto WriteEvent = [&](const std::string& Name, uint32_t ThreadId, uint64_t Start, uint64_t End) {
+            Stream << (First ? "" : ",") << "{\"name\":";
+            WriteJSONString(Stream, Name);
+            Stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << ThreadId
+                   << ",\"ts\":" << static_cast<double>(Start - g_StartTSC) * UsPerTick
+                   << ",\"dur\":" << static_cast<double>(End - Start) * UsPerTick << '}';
+            First = false;
+        };
+
+        for (const auto& Profile : GetProfiles()) {
+            const uint64_t NumEvents = Profile->NumEvents.load(std::memory_order_acquire);
+            const uint64_t FirstEvent = std::max(NumEvents > kNumTraceEvents ? NumEvents - kNumTraceEvents : 0, Profile->TraceStart.load(std::memory_order_relaxed));
+
+            for (uint64_t i = FirstEvent; i < NumEvents; i++) {
+                const FTraceEvent& Event = Profile->Events[i % kNumTraceEvents];
+
+                UFunction* Function = Event.Function.load(std::memory_order_relaxed);
+                const uint64_t Start = Event.Start.load(std::memory_order_relaxed);
+                const uint64_t CalleeStart = Event.CalleeStart.load(std::memory_order_relaxed);
+                const uint64_t CalleeEnd = Event.CalleeEnd.load(std::memory_order_relaxed);
+                const uint64_t End = Event.End.load(std::memory_order_relaxed);
+
+                // The slot may have been overwritten by the owning thread since NumEvents was read.
+                if (Profile->NumEvents.load(std::memory_order_acquire) - i > kNumTraceEvents)
+                    continue;
+
+                auto [It, Inserted] = Names.try_emplace(Function);
+                if (Inserted)
+                    It->second = Function ? Function->GetName() : "None";
+
+                WriteEvent(It->second, Profile->ThreadId, Start, End);
+                WriteEvent("ProcessEvent", Profile->ThreadId, CalleeStart, CalleeEnd);
+            }
+        }
+#endif
+
+        Stream << "]}";
+        return Stream.str();
+    }
+
+    void Reset()
+    {
+#ifdef UESDK_PROFILER
+        for (const auto& Profile : GetProfiles()) {
+            for (FFunctionEntry* Entry = Profile->Entries.load(std::memory_order_acquire); Entry; Entry = Entry->Next) {
+                Entry->Calls.store(0, std::memory_order_relaxed);
+                Entry->TotalTicks.store(0, std::memory_order_relaxed);
+                Entry->CalleeTicks.store(0, std::memory_order_relaxed);
+
+                for (auto& Bucket : Entry->Buckets)
+                    Bucket.store(0, std::memory_order_relaxed);
+            }
+
+            // Only the owning thread writes NumEvents, the trace is cleared by skipping past the current events instead.
+            Profile->TraceStart.store(Profile->NumEvents.load(std::memory_order_acquire), std::memory_order_relaxed);
+        }
+#endif
+    }
+}
@@ -0,0 +1,75 @@
+#include <uesdk/helpers/DataTableSnapshot.hpp>
+#include <private/PropertyView.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace SDK
+{
+    FDataTableSnapshot::FDataTableSnapshot(const UDataTable* Table, const std::vector<std::string>& Columns)
+        : m_Table(Table)
+    {
+        if (!Table || !Table->RowStruct)
+            throw std::invalid_argument("Invalid UDataTable!");
+
+        const UScriptStruct* RowStruct = Table->RowStruct;
+
+        m_Columns.reserve(Columns.size());
+        for (const std::string& ColumnName : Columns) {
+            FName Name(ColumnName);
+
+            PropertyInfo Info = RowStruct->FindProperty(Name);
+            if (!Info.Found)
+                throw std::invalid_argument("Failed to find column '" + ColumnName + "' in '" + RowStruct->GetName() + "'");
+
+            FColumn Column;
+            Column.Name = Name;
+            Column.Offset = Info.Offset;
+            Column.ByteMask = Info.ByteMask;
+            // Static arrays are copied whole, one ElementSize per element.
+            Column.ElementSize = Info.ByteMask ? 1 : Info.ElementSize * std::max(Properties::MakeView(Info.Prop).ArrayDim, 1);
+            m_Columns.push_back(std::move(Column));
+        }
+
+        Refresh();
+    }
+
+    void FDataTableSnapshot::Refresh()
+    {
+        const TMap<FName, uint8_t*>& RowMap = m_Table->RowMap;
+
+        const size_t NumRows = static_cast<size_t>(std::max(RowMap.Num(), 0));
+
+        m_RowNames.clear();
+        m_RowNames.reserve(NumRows);
+        for (FColumn& Column : m_Columns)
+            Column.Data.resize(NumRows * Column.ElementSize);
+
+        size_t RowIndex = 0;
+        for (auto It = begin(RowMap); It != end(RowMap); ++It) {
+            const uint8_t* Row = It->Value();
+            m_RowNames.push_back(It->Key());
+
+            for (FColumn& Column : m_Columns) {
+                uint8_t* Dest = Column.Data.data() + RowIndex * Column.ElementSize;
+
+                if (Column.ByteMask)
+                    *Dest = (Row[Column.Offset] & Column.ByteMask) ? 1 : 0;
+                else
+                    std::memcpy(Dest, Row + Column.Offset, Column.ElementSize);
+            }
+
+            RowIndex++;
+        }
+    }
+
+    int32_t FDataTableSnapshot::FindColumn(const FName& Name) const
+    {
+        for (size_t i = 0; i < m_Columns.size(); i++) {
+            if (m_Columns[i].Name == Name)
+                return static_cast<int32_t>(i);
+        }
+
+        return -1;
+    }
+}
@@ -0,0 +1,405 @@
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/CallProfiler.hpp>
+#include <uesdk/helpers/DynamicCall.hpp>
+#include <uesdk/helpers/FunctionLayout.hpp>
+#include <uesdk/helpers/TlsArgBuffer.hpp>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SDK
+{
+    // How a parameter is marshalled, decided once from the property's cast flags.
+    enum class EParamKind : uint8_t
+    {
+        Bool,
+        SignedInt,
+        UnsignedInt,
+        Float,
+        Double,
+        Name,
+        String,
+        Object,
+        Raw
+    };
+
+    struct FDynamicParam
+    {
+        int32_t Offset = 0;
+        int32_t Size = 0;
+        EParamKind Kind = EParamKind::Raw;
+        bool IsOutParm = false;
+    };
+
+    struct FDynamicFunction
+    {
+        UFunction* Function = nullptr;
+        // Copied from the function's layout, the entry is rebuilt when the address belongs to another object.
+        int32_t ObjectIndex = -1;
+        int32_t SerialNumber = 0;
+        int32_t ParmsSize = 0;
+
+        std::vector<FDynamicParam> Params; // Without the return value.
+
+        bool HasReturnValue = false;
+        FDynamicParam ReturnValue;
+
+        std::vector<int32_t> StringOffsets; // FString slots to destroy after the call, including the return value.
+    };
+
+    static EParamKind GetParamKind(const FParamLayout& Param)
+    {
+        const uint64_t CastFlags = Param.CastFlags;
+        const bool IsIntSize = Param.Size == 1 || Param.Size == 2 || Param.Size == 4 || Param.Size == 8;
+
+        if (CastFlags & CASTCLASS_FBoolProperty)
+            return EParamKind::Bool;
+        if ((CastFlags & (CASTCLASS_FInt8Property | CASTCLASS_FInt16Property | CASTCLASS_FIntProperty | CASTCLASS_FInt64Property)) && IsIntSize)
+            return EParamKind::SignedInt;
+        if ((CastFlags & (CASTCLASS_FByteProperty | CASTCLASS_FUInt16Property | CASTCLASS_FUInt32Property | CASTCLASS_FUInt64Property | CASTCLASS_FEnumProperty)) && IsIntSize)
+            return EParamKind::UnsignedInt;
+        if ((CastFlags & CASTCLASS_FFloatProperty) && Param.Size == sizeof(float))
+            return EParamKind::Float;
+        if ((CastFlags & CASTCLASS_FDoubleProperty) && Param.Size == sizeof(double))
+            return EParamKind::Double;
+        if ((CastFlags & CASTCLASS_FNameProperty) && Param.Size == sizeof(FName))
+            return EParamKind::Name;
+        if ((CastFlags & CASTCLASS_FStrProperty) && Param.Size == sizeof(FString))
+            return EParamKind::String;
+
+        // Weak, lazy and soft object properties share FObjectPropertyBase but aren't plain pointers.
+        if ((CastFlags & (CASTCLASS_FObjectProperty | CASTCLASS_FClassProperty)) && Param.Size == sizeof(UObject*))
+            return EParamKind::Object;
+
+        return EParamKind::Raw;
+    }
+
+    static FDynamicParam MakeParam(const FParamLayout& Param)
+    {
+        return { Param.Offset, Param.Size, GetParamKind(Param), Param.IsOutParm() };
+    }
+
+    static std::unique_ptr<FDynamicFunction> BuildFunction(UFunction* Function)
+    {
+        const FFunctionLayout& Layout = FFunctionLayoutCache::Get(Function);
+
+        auto Result = std::make_unique<FDynamicFunction>();
+        Result->Function = Function;
+        Result->ObjectIndex = Layout.ObjectIndex;
+        Result->SerialNumber = Layout.SerialNumber;
+        Result->ParmsSize = Layout.ParmsSize;
+
+        Result->Params.reserve(Layout.Params.size());
+        for (const FParamLayout& Param : Layout.Params) {
+            Result->Params.push_back(MakeParam(Param));
+            if (Result->Params.back().Kind == EParamKind::String)
+                Result->StringOffsets.push_back(Param.Offset);
+        }
+
+        if (Layout.HasReturnValue) {
+            Result->HasReturnValue = true;
+            Result->ReturnValue = MakeParam(Layout.ReturnValue);
+            if (Result->ReturnValue.Kind == EParamKind::String)
+                Result->StringOffsets.push_back(Layout.ReturnValue.Offset);
+        }
+
+        return Result;
+    }
+
+    // Function cache, keyed by the object's class and the requested name.
+
+    struct FFunctionKey
+    {
+        const UClass* Class;
+        std::string Name;
+    };
+
+    struct FFunctionKeyView
+    {
+        const UClass* Class;
+        std::string_view Name;
+    };
+
+    struct FFunctionKeyHash
+    {
+        using is_transparent = void;
+
+        size_t operator()(const FFunctionKeyView& Key) const { return std::hash<std::string_view> {}(Key.Name) ^ (std::hash<const void*> {}(Key.Class) * 31); }
+        size_t operator()(const FFunctionKey& Key) const { return (*this)(FFunctionKeyView { Key.Class, Key.Name }); }
+    };
+
+    struct FFunctionKeyEqual
+    {
+        using is_transparent = void;
+
+        static FFunctionKeyView View(const FFunctionKey& Key) { return { Key.Class, Key.Name }; }
+        static FFunctionKeyView View(const FFunctionKeyView& Key) { return Key; }
+
+        template <typename A, typename B>
+        bool operator()(const A& Left, const B& Right) const
+        {
+            const FFunctionKeyView L = View(Left), R = View(Right);
+            return L.Class == R.Class && L.Name == R.Name;
+        }
+    };
+
+    static std::shared_mutex g_FunctionsMutex;
+    static std::unordered_map<FFunctionKey, std::unique_ptr<const FDynamicFunction>, FFunctionKeyHash, FFunctionKeyEqual> g_Functions;
+    // Entries replaced after their function was garbage collected, kept since a call on another thread may still be using them.
+    static std::vector<std::unique_ptr<const FDynamicFunction>> g_RetiredFunctions;
+
+    static bool IsCurrent(const FDynamicFunction& Entry)
+    {
+        return FFunctionLayoutCache::IsCurrent(Entry.Function, Entry.ObjectIndex, Entry.SerialNumber);
+    }
+
+    static UFunction* FindFunctionInHierarchy(const UClass* Class, std::string_view FunctionName)
+    {
+        // FName needs a null terminated string.
+        const FName Name(std::string(FunctionName).c_str());
+
+        for (const UStruct* Struct = Class; Struct; Struct = Struct->SuperStruct) {
+            if (UFunction* Function = Struct->FindFunction(Name))
+                return Function;
+        }
+
+        return nullptr;
+    }
+
+    static const FDynamicFunction& GetFunction(UObject* Obj, std::string_view FunctionName)
+    {
+        const UClass* Class = Obj->Class;
+
+        // Config driven callers tend to repeat the same call.
+        struct FLastHit
+        {
+            const UClass* Class = nullptr;
+            std::string Name;
+            const FDynamicFunction* Function = nullptr;
+        };
+        thread_local static FLastHit LastHit;
+
+        if (LastHit.Function && LastHit.Class == Class && LastHit.Name == FunctionName && IsCurrent(*LastHit.Function))
+            return *LastHit.Function;
+
+        const FDynamicFunction* Found = nullptr;
+        {
+            std::shared_lock Lock(g_FunctionsMutex);
+            if (auto It = g_Functions.find(FFunctionKeyView { Class, FunctionName }); It != g_Functions.end() && IsCurrent(*It->second))
+                Found = It->second.get();
+        }
+
+        if (!Found) {
+            UFunction* Function = FindFunctionInHierarchy(Class, FunctionName);
+            if (!Function)
+                throw std::invalid_argument("DynamicCall: '" + std::string(FunctionName) + "' not found on '" + Obj->GetFullName() + "'");
+
+            // Built outside the lock, a racing thread may build the same entry, the first one inserted wins.
+            std::unique_ptr<const FDynamicFunction> Built = BuildFunction(Function);
+
+            std::unique_lock Lock(g_FunctionsMutex);
+            auto [It, Inserted] = g_Functions.try_emplace(FFunctionKey { Class, std::string(FunctionName) }, std::move(Built));
+            if (!Inserted && !IsCurrent(*It->second)) {
+                g_RetiredFunctions.push_back(std::move(It->second));
+                It->second = std::move(Built);
+            }
+            Found = It->second.get();
+        }
+
+        LastHit.Class = Class;
+        LastHit.Name.assign(FunctionName);
+        LastHit.Function = Found;
+        return *Found;
+    }
+
+    // Marshalling
+
+    static const char* GetKindName(EParamKind Kind)
+    {
+        switch (Kind) {
+        case EParamKind::Bool: return "bool";
+        case EParamKind::SignedInt:
+        case EParamKind::UnsignedInt: return "integer";
+        case EParamKind::Float:
+        case EParamKind::Double: return "float";
+        case EParamKind::Name: return "name";
+        case EParamKind::String: return "string";
+        case EParamKind::Object: return "object";
+        default: return "bytes";
+        }
+    }
+
+    static bool IsConvertible(const FDynamicParam& Param, const FArgValue& Value)
+    {
+        const EArgType Type = Value.GetType();
+        if (Type == EArgType::None)
+            return true;
+
+        switch (Param.Kind) {
+        case EParamKind::Bool:
+        case EParamKind::SignedInt:
+        case EParamKind::UnsignedInt: return Type == EArgType::Bool || Type == EArgType::Int;
+        case EParamKind::Float:
+        case EParamKind::Double: return Type == EArgType::Float || Type == EArgType::Int;
+        case EParamKind::Name: return Type == EArgType::Name || Type == EArgType::String;
+        case EParamKind::String: return Type == EArgType::String;
+        case EParamKind::Object: return Type == EArgType::Object;
+        default: return Type == EArgType::Bytes && Value.GetSize() == static_cast<uint32_t>(Param.Size);
+        }
+    }
+
+    static int64_t ToInt(const FArgValue& Value)
+    {
+        return Value.GetType() == EArgType::Bool ? Value.GetBool() : Value.GetInt();
+    }
+
+    static double ToFloat(const FArgValue& Value)
+    {
+        return Value.GetType() == EArgType::Int ? static_cast<double>(Value.GetInt()) : Value.GetFloat();
+    }
+
+    // Only called after IsConvertible passed for every argument, so nothing here throws halfway through the buffer.
+    static void WriteArg(uint8_t* Parms, const FDynamicParam& Param, const FArgValue& Value)
+    {
+        uint8_t* Slot = Parms + Param.Offset;
+
+        switch (Param.Kind) {
+        case EParamKind::Bool:
+            *Slot = ToInt(Value) != 0;
+            break;
+        case EParamKind::SignedInt:
+        case EParamKind::UnsignedInt: {
+            // Little endian, the low bytes are the narrowed value for either signedness.
+            const int64_t Int = ToInt(Value);
+            memcpy(Slot, &Int, Param.Size);
+            break;
+        }
+        case EParamKind::Float:
+            *reinterpret_cast<float*>(Slot) = static_cast<float>(ToFloat(Value));
+            break;
+        case EParamKind::Double:
+            *reinterpret_cast<double*>(Slot) = ToFloat(Value);
+            break;
+        case EParamKind::Name:
+            *reinterpret_cast<FName*>(Slot) = Value.GetType() == EArgType::Name ? Value.GetName() : FName(Value.GetString().data());
+            break;
+        case EParamKind::String:
+            new (Slot) FString(Value.GetString().data());
+            break;
+        case EParamKind::Object:
+            *reinterpret_cast<UObject**>(Slot) = Value.GetObject();
+            break;
+        default:
+            memcpy(Slot, Value.GetData(), Param.Size);
+            break;
+        }
+    }
+
+    static FArgValue ReadValue(const uint8_t* Parms, const FDynamicParam& Param)
+    {
+        const uint8_t* Slot = Parms + Param.Offset;
+
+        switch (Param.Kind) {
+        case EParamKind::Bool:
+            return FArgValue(*Slot != 0);
+        case EParamKind::SignedInt: {
+            switch (Param.Size) {
+            case 1: return FArgValue(*reinterpret_cast<const int8_t*>(Slot));
+            case 2: return FArgValue(*reinterpret_cast<const int16_t*>(Slot));
+            case 4: return FArgValue(*reinterpret_cast<const int32_t*>(Slot));
+            default: return FArgValue(*reinterpret_cast<const int64_t*>(Slot));
+            }
+        }
+        case EParamKind::UnsignedInt: {
+            uint64_t Int = 0;
+            memcpy(&Int, Slot, Param.Size);
+            return FArgValue(static_cast<int64_t>(Int));
+        }
+        case EParamKind::Float:
+            return FArgValue(*reinterpret_cast<const float*>(Slot));
+        case EParamKind::Double:
+            return FArgValue(*reinterpret_cast<const double*>(Slot));
+        case EParamKind::Name:
+            return FArgValue(*reinterpret_cast<const FName*>(Slot));
+        case EParamKind::String: {
+            const FString& Str = *reinterpret_cast<const FString*>(Slot);
+            return FArgValue(Str ? std::wstring_view(Str.CStr()) : std::wstring_view());
+        }
+        case EParamKind::Object:
+            return FArgValue(*reinterpret_cast<UObject* const*>(Slot));
+        default:
+            return FArgValue::FromBytes(Slot, Param.Size);
+        }
+    }
+
+    // Frees the FStrings in the parameters buffer on every exit path.
+    struct FStringSlotGuard
+    {
+        const FDynamicFunction& Function;
+        uint8_t* Parms;
+
+        ~FStringSlotGuard()
+        {
+            for (int32_t Offset : Function.StringOffsets)
+                reinterpret_cast<FString*>(Parms + Offset)->~FString();
+        }
+    };
+
+    FArgValue DynamicCall(UObject* Obj, std::string_view FunctionName, std::span<const FArgValue> Args, std::span<FArgValue> OutParams)
+    {
+        if (!Obj)
+            throw std::invalid_argument("DynamicCall: Obj is nullptr");
+
+        const FDynamicFunction& Function = GetFunction(Obj, FunctionName);
+
+        if (Args.size() != Function.Params.size()) {
+            throw std::invalid_argument("DynamicCall: '" + Function.Function->GetFullName() + "' expects " + std::to_string(Function.Params.size()) + " argument(s), "
+                + std::to_string(Args.size()) + " passed");
+        }
+
+        for (size_t i = 0; i < Args.size(); i++) {
+            if (!IsConvertible(Function.Params[i], Args[i])) {
+                throw std::invalid_argument("DynamicCall: argument " + std::to_string(i) + " of '" + Function.Function->GetFullName() + "' expects "
+                    + GetKindName(Function.Params[i].Kind) + " of size " + std::to_string(Function.Params[i].Size));
+            }
+        }
+
+        Profiler::FCallScope Profile(Function.Function, static_cast<uint32_t>(Function.ParmsSize));
+
+        // Zero filled, None arguments and unwritten padding are left as zeroes like the engine would.
+        TlsArgBuffer Parms(Function.ParmsSize);
+        uint8_t* Data = Function.ParmsSize ? Parms.GetData() : nullptr;
+
+        for (size_t i = 0; i < Args.size(); i++) {
+            if (!Args[i].IsNone())
+                WriteArg(Data, Function.Params[i], Args[i]);
+        }
+
+        FStringSlotGuard Guard { Function, Data };
+
+        Profile.BeginCallee();
+        Obj->ProcessEvent(Function.Function, Data);
+        Profile.EndCallee();
+
+        size_t OutIndex = 0;
+        for (const FDynamicParam& Param : Function.Params) {
+            if (!Param.IsOutParm)
+                continue;
+            if (OutIndex >= OutParams.size())
+                break;
+
+            OutParams[OutIndex++] = ReadValue(Data, Param);
+        }
+
+        if (!Function.HasReturnValue)
+            return FArgValue();
+
+        return ReadValue(Data, Function.ReturnValue);
+    }
+}
@@ -4,16 +4,26 @@
 #include <uesdk/core/UnrealObjects.hpp>
 #include <uesdk/helpers/FastSearch.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
 namespace SDK
 {
-    bool ProcessSearchEntry(const UObject* Obj, const FSEntry& Entry)
+    // Below this many objects per thread, spawning threads costs more than the scan.
+    static constexpr int32_t kMinObjectsPerThread = 16384;
+
+    // Check if Obj satisfies Entry, only writing the entry's outputs if WriteOutput is set.
+    static bool MatchSearchEntry(const UObject* Obj, const FSEntry& Entry, bool WriteOutput)
     {
         switch (Entry.Type) {
         case FSType::UObject: {
             if (!Obj->HasTypeFlag(Entry.Object.RequiredType) || Obj->Name != Entry.Object.ObjectName)
                 break;
 
-            *Entry.Object.OutObject = const_cast<UObject*>(Obj);
+            if (WriteOutput)
+                *Entry.Object.OutObject = const_cast<UObject*>(Obj);
             return true;
         }
         case FSType::UEnum: {
@@ -25,9 +35,9 @@ namespace SDK
             if (Value == OFFSET_NOT_FOUND)
                 break;
 
-            if (Entry.Enum.OutEnumeratorValue)
+            if (WriteOutput && Entry.Enum.OutEnumeratorValue)
                 *Entry.Enum.OutEnumeratorValue = Value;
-            if (Entry.Enum.OutEnum)
+            if (WriteOutput && Entry.Enum.OutEnum)
                 *Entry.Enum.OutEnum = const_cast<UEnum*>(ObjEnum);
 
             return true;
@@ -41,7 +51,8 @@ namespace SDK
             if (!Function)
                 break;
 
-            *Entry.Function.OutFunction = Function;
+            if (WriteOutput)
+                *Entry.Function.OutFunction = Function;
 
             return true;
         }
@@ -54,7 +65,8 @@ namespace SDK
             if (!Info.Found)
                 break;
 
-            *Entry.Property.OutPropInfo = Info;
+            if (WriteOutput)
+                *Entry.Property.OutPropInfo = Info;
 
             return true;
         }
@@ -66,6 +78,11 @@ namespace SDK
         return false;
     }
 
+    bool ProcessSearchEntry(const UObject* Obj, const FSEntry& Entry)
+    {
+        return MatchSearchEntry(Obj, Entry, true);
+    }
+
     bool FastSearch(std::vector<FSEntry>& SearchList)
     {
         // We require all of these functionalities.
@@ -91,4 +108,89 @@ namespace SDK
 
         return SearchList.empty();
     }
+
+    bool FastSearchParallel(std::vector<FSEntry>& SearchList, uint32_t NumThreads)
+    {
+        if (!State::SetupFMemory || !State::SetupGObjects || !State::SetupAppendString)
+            return false;
+
+        if (SearchList.empty())
+            return true;
+
+        const int32_t NumObjects = GObjects->Num();
+        if (NumThreads == 0)
+            NumThreads = std::max(1u, std::thread::hardware_concurrency());
+        NumThreads = std::min<uint32_t>(NumThreads, std::max(1, NumObjects / kMinObjectsPerThread));
+
+        if (NumThreads <= 1)
+            return FastSearch(SearchList);
+
+        // Lowest matching GObjects index of every entry, the same object the serial search would pick.
+        const size_t NumEntries = SearchList.size();
+        std::vector<std::atomic<int32_t>> FirstMatch(NumEntries);
+        for (std::atomic<int32_t>& Index : FirstMatch)
+            Index.store(INT32_MAX, std::memory_order_relaxed);
+
+        auto AllMatchedBefore = [&](int32_t Index) {
+            return std::all_of(FirstMatch.begin(), FirstMatch.end(), [Index](const std::atomic<int32_t>& Match) { return Match.load(std::memory_order_relaxed) < Index; });
+        };
+
+        auto ScanRange = [&](int32_t Begin, int32_t End) {
+            for (int32_t i = Begin; i < End; i++) {
+                // Stop once every entry has a match no later slice can beat.
+                if ((i & 0xFFF) == 0 && AllMatchedBefore(i))
+                    return;
+
+                UObject* Obj = GObjects->GetByIndex(i);
+                if (!Obj)
+                    continue;
+
+                for (size_t e = 0; e < NumEntries; e++) {
+                    int32_t Current = FirstMatch[e].load(std::memory_order_relaxed);
+                    if (Current < i || !MatchSearchEntry(Obj, SearchList[e], false))
+                        continue;
+
+                    while (i < Current && !FirstMatch[e].compare_exchange_weak(Current, i, std::memory_order_relaxed)) { }
+                }
+            }
+        };
+
+        const int32_t SliceSize = (NumObjects + static_cast<int32_t>(NumThreads) - 1) / static_cast<int32_t>(NumThreads);
+        std::vector<std::exception_ptr> Errors(NumThreads);
+        std::vector<std::thread> Workers;
+        Workers.reserve(NumThreads - 1);
+
+        auto RunSlice = [&](uint32_t Slice) {
+            try {
+                const int32_t Begin = static_cast<int32_t>(Slice) * SliceSize;
+                ScanRange(Begin, std::min(NumObjects, Begin + SliceSize));
+            }
+            catch (...) {
+                Errors[Slice] = std::current_exception();
+            }
+        };
+
+        for (uint32_t Slice = 1; Slice < NumThreads; Slice++)
+            Workers.emplace_back(RunSlice, Slice);
+        RunSlice(0);
+
+        for (std::thread& Worker : Workers)
+            Worker.join();
+
+        for (const std::exception_ptr& Error : Errors) {
+            if (Error)
+                std::rethrow_exception(Error);
+        }
+
+        // Outputs are written here, on the calling thread, so entries sharing an output can't race.
+        std::vector<FSEntry> Unfound;
+        for (size_t e = 0; e < NumEntries; e++) {
+            const int32_t Index = FirstMatch[e].load(std::memory_order_relaxed);
+            if (Index == INT32_MAX || !MatchSearchEntry(GObjects->GetByIndex(Index), SearchList[e], true))
+                Unfound.push_back(SearchList[e]);
+        }
+
+        SearchList = std::move(Unfound);
+        return SearchList.empty();
+    }
 }
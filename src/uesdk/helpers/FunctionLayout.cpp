@@ -0,0 +1,138 @@
+#include <uesdk/State.hpp>
+#include <uesdk/core/ObjectArray.hpp>
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/FunctionLayout.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace SDK
+{
+    static std::shared_mutex g_LayoutsMutex;
+    static std::unordered_map<const UFunction*, std::unique_ptr<const FFunctionLayout>> g_Layouts;
+    // Layouts replaced after their function was garbage collected, kept so handed out references stay valid.
+    static std::vector<std::unique_ptr<const FFunctionLayout>> g_RetiredLayouts;
+
+    static const FUObjectItem* GetObjectItem(const UFunction* Function)
+    {
+        if (!GObjects)
+            return nullptr;
+
+        const FUObjectItem* Item = GObjects->GetItemByIndex(Function->Index);
+        return Item && Item->Object == Function ? Item : nullptr;
+    }
+
+    static bool IsLayoutCurrent(const FFunctionLayout& Layout, const UFunction* Function)
+    {
+        return FFunctionLayoutCache::IsCurrent(Function, Layout.ObjectIndex, Layout.SerialNumber);
+    }
+
+    static void AddParam(FFunctionLayout& Layout, const FParamLayout& Param)
+    {
+        Layout.HasOutParms |= Param.IsOutParm();
+        Layout.NeedsDestructor |= Param.NeedsDestructor();
+
+        if (Param.Flags & CPF_ReturnParm) {
+            Layout.HasReturnValue = true;
+            Layout.ReturnValue = Param;
+        }
+        else {
+            Layout.Params.push_back(Param);
+        }
+    }
+
+    static std::unique_ptr<FFunctionLayout> BuildLayout(const UFunction* Function)
+    {
+        auto Layout = std::make_unique<FFunctionLayout>();
+        Layout->Function = Function;
+        Layout->ObjectIndex = Function->Index;
+        Layout->ParmsSize = Function->ParmsSize;
+
+        if (const FUObjectItem* Item = GetObjectItem(Function))
+            Layout->SerialNumber = Item->SerialNumber;
+
+        if (State::UsesFProperty) {
+            for (FField* Field = Function->ChildProperties; Field; Field = Field->Next) {
+                if (!Field->HasTypeFlag(CASTCLASS_FProperty))
+                    continue;
+
+                FProperty* Property = static_cast<FProperty*>(Field);
+                if (!Property->HasPropertyFlag(CPF_Parm))
+                    continue;
+
+                AddParam(*Layout, { Property->Name, Property->Offset, Property->ElementSize, static_cast<EPropertyFlags>(Property->PropertyFlags), Property->ClassPrivate->CastFlags });
+            }
+        }
+        else {
+            for (UField* Child = Function->Children; Child; Child = Child->Next) {
+                if (!Child->HasTypeFlag(CASTCLASS_FProperty))
+                    continue;
+
+                UProperty* Property = static_cast<UProperty*>(Child);
+                if (!Property->HasPropertyFlag(CPF_Parm))
+                    continue;
+
+                AddParam(*Layout, { Property->Name, Property->Offset, Property->ElementSize, Property->PropertyFlags, static_cast<uint64_t>(Property->Class->ClassCastFlags) });
+            }
+        }
+
+        // Some engines don't flag the return property consistently, fall back to the parameter at the function's own offset.
+        const uint16_t ReturnValueOffset = Function->ReturnValueOffset;
+        if (!Layout->HasReturnValue && ReturnValueOffset != UINT16_MAX) {
+            auto It = std::find_if(Layout->Params.begin(), Layout->Params.end(), [ReturnValueOffset](const FParamLayout& Param) {
+                return Param.Offset == ReturnValueOffset;
+            });
+
+            if (It != Layout->Params.end()) {
+                Layout->HasReturnValue = true;
+                Layout->ReturnValue = *It;
+                Layout->Params.erase(It);
+            }
+        }
+
+        return Layout;
+    }
+
+    bool FFunctionLayoutCache::IsCurrent(const UFunction* Function, int32_t ObjectIndex, int32_t SerialNumber)
+    {
+        if (ObjectIndex != Function->Index)
+            return false;
+
+        const FUObjectItem* Item = GetObjectItem(Function);
+        return Item ? Item->SerialNumber == SerialNumber : SerialNumber == 0;
+    }
+
+    const FFunctionLayout& FFunctionLayoutCache::Get(const UFunction* Function)
+    {
+        if (!Function)
+            throw std::invalid_argument("FFunctionLayoutCache::Get: Function is nullptr");
+
+        // Most threads call the same few functions back to back.
+        thread_local static const FFunctionLayout* LastLayout = nullptr;
+        if (LastLayout && LastLayout->Function == Function && IsLayoutCurrent(*LastLayout, Function))
+            return *LastLayout;
+
+        {
+            std::shared_lock Lock(g_LayoutsMutex);
+            if (auto It = g_Layouts.find(Function); It != g_Layouts.end() && IsLayoutCurrent(*It->second, Function))
+                return *(LastLayout = It->second.get());
+        }
+
+        // Built outside the lock, a racing thread may build the same layout, the first one inserted wins.
+        std::unique_ptr<FFunctionLayout> Layout = BuildLayout(Function);
+
+        std::unique_lock Lock(g_LayoutsMutex);
+        auto [It, Inserted] = g_Layouts.try_emplace(Function, std::move(Layout));
+        if (!Inserted && !IsLayoutCurrent(*It->second, Function)) {
+            g_RetiredLayouts.push_back(std::move(It->second));
+            It->second = std::move(Layout);
+        }
+
+        return *(LastLayout = It->second.get());
+    }
+}
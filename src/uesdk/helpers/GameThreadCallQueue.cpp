@@ -0,0 +1,189 @@
+#include <uesdk/helpers/GameThreadCallQueue.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+namespace SDK
+{
+    // Node pool, shared by every queue.
+    //
+    // Nodes are released onto a global lock-free stack. Threads take the whole stack at once into a thread local cache,
+    // so the global stack is only ever pushed to or emptied, which avoids the ABA problem of popping single nodes.
+
+    static constexpr size_t kNodeChunkSize = 64;
+
+    static std::atomic<FQueuedCall*> g_FreeNodes = nullptr;
+
+    static void PushFreeNodes(FQueuedCall* First, FQueuedCall* Last)
+    {
+        FQueuedCall* Head = g_FreeNodes.load(std::memory_order_relaxed);
+        do {
+            Last->Next.store(Head, std::memory_order_relaxed);
+        } while (!g_FreeNodes.compare_exchange_weak(Head, First, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    struct FLocalNodeCache
+    {
+        FQueuedCall* Head = nullptr;
+
+        // Hand cached nodes back when the thread exits.
+        ~FLocalNodeCache()
+        {
+            if (!Head)
+                return;
+
+            FQueuedCall* Last = Head;
+            while (FQueuedCall* Next = Last->Next.load(std::memory_order_relaxed))
+                Last = Next;
+
+            PushFreeNodes(Head, Last);
+        }
+    };
+
+    thread_local static FLocalNodeCache g_LocalNodes;
+
+    FGameThreadCallQueue::FPooledCall* FGameThreadCallQueue::AcquireNode()
+    {
+        if (!g_LocalNodes.Head)
+            g_LocalNodes.Head = g_FreeNodes.exchange(nullptr, std::memory_order_acquire);
+
+        if (!g_LocalNodes.Head) {
+            FPooledCall* Chunk = new FPooledCall[kNodeChunkSize];
+            for (size_t i = 0; i < kNodeChunkSize; i++)
+                Chunk[i].Next.store(i + 1 < kNodeChunkSize ? &Chunk[i + 1] : nullptr, std::memory_order_relaxed);
+
+            g_LocalNodes.Head = Chunk;
+        }
+
+        FQueuedCall* Node = g_LocalNodes.Head;
+        g_LocalNodes.Head = Node->Next.load(std::memory_order_relaxed);
+        return static_cast<FPooledCall*>(Node);
+    }
+
+    void FGameThreadCallQueue::ReleaseNode(FPooledCall* Node)
+    {
+        PushFreeNodes(Node, Node);
+    }
+
+    uint64_t FGameThreadCallQueue::GetTimeNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // Queue.
+    //
+
+    FGameThreadCallQueue::FGameThreadCallQueue()
+        : m_Head(&m_Stub)
+        , m_Tail(&m_Stub)
+    {
+    }
+
+    FGameThreadCallQueue::~FGameThreadCallQueue()
+    {
+        while (FQueuedCall* Call = Pop())
+            Call->Execute(Call, false);
+    }
+
+    FGameThreadCallQueue& FGameThreadCallQueue::Get()
+    {
+        static FGameThreadCallQueue Queue;
+        return Queue;
+    }
+
+    void FGameThreadCallQueue::Enqueue(FQueuedCall* Call)
+    {
+        Call->EnqueueTime = GetTimeNs();
+        Call->Next.store(nullptr, std::memory_order_relaxed);
+
+        const uint64_t Enqueued = m_Enqueued.fetch_add(1, std::memory_order_relaxed) + 1;
+        const uint64_t Depth = Enqueued - m_Executed.load(std::memory_order_relaxed);
+
+        uint64_t MaxDepth = m_MaxDepth.load(std::memory_order_relaxed);
+        while (Depth > MaxDepth && !m_MaxDepth.compare_exchange_weak(MaxDepth, Depth, std::memory_order_relaxed)) { }
+
+        FQueuedCall* Prev = m_Head.exchange(Call, std::memory_order_acq_rel);
+        Prev->Next.store(Call, std::memory_order_release);
+    }
+
+    FQueuedCall* FGameThreadCallQueue::Pop()
+    {
+        FQueuedCall* Tail = m_Tail;
+        FQueuedCall* Next = Tail->Next.load(std::memory_order_acquire);
+
+        if (Tail == &m_Stub) {
+            if (!Next)
+                return nullptr;
+
+            m_Tail = Next;
+            Tail = Next;
+            Next = Next->Next.load(std::memory_order_acquire);
+        }
+
+        if (Next) {
+            m_Tail = Next;
+            return Tail;
+        }
+
+        // Tail is the last node, unless a producer is between its exchange and linking the node.
+        if (Tail != m_Head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // Put the stub back behind Tail so Tail can be handed out.
+        m_Stub.Next.store(nullptr, std::memory_order_relaxed);
+        FQueuedCall* Prev = m_Head.exchange(&m_Stub, std::memory_order_acq_rel);
+        Prev->Next.store(&m_Stub, std::memory_order_release);
+
+        Next = Tail->Next.load(std::memory_order_acquire);
+        if (Next) {
+            m_Tail = Next;
+            return Tail;
+        }
+
+        return nullptr;
+    }
+
+    size_t FGameThreadCallQueue::Drain(size_t MaxCalls)
+    {
+        size_t NumRun = 0;
+        uint64_t MaxLatency = m_MaxLatencyNs.load(std::memory_order_relaxed);
+
+        while (NumRun < MaxCalls) {
+            FQueuedCall* Call = Pop();
+            if (!Call)
+                break;
+
+            const uint64_t Latency = GetTimeNs() - Call->EnqueueTime;
+            m_TotalLatencyNs.fetch_add(Latency, std::memory_order_relaxed);
+            MaxLatency = std::max(MaxLatency, Latency);
+
+            // Execute may release the node, nothing can touch Call after it.
+            Call->Execute(Call, true);
+
+            m_Executed.fetch_add(1, std::memory_order_relaxed);
+            NumRun++;
+        }
+
+        m_MaxLatencyNs.store(MaxLatency, std::memory_order_relaxed);
+        return NumRun;
+    }
+
+    FGameThreadCallQueueStats FGameThreadCallQueue::GetStats() const
+    {
+        FGameThreadCallQueueStats Stats;
+        Stats.Executed = m_Executed.load(std::memory_order_relaxed);
+        Stats.Enqueued = m_Enqueued.load(std::memory_order_relaxed);
+        Stats.Depth = Stats.Enqueued > Stats.Executed ? Stats.Enqueued - Stats.Executed : 0;
+        Stats.MaxDepth = m_MaxDepth.load(std::memory_order_relaxed);
+        Stats.TotalLatencyNs = m_TotalLatencyNs.load(std::memory_order_relaxed);
+        Stats.MaxLatencyNs = m_MaxLatencyNs.load(std::memory_order_relaxed);
+        return Stats;
+    }
+
+    void FGameThreadCallQueue::ResetStats()
+    {
+        m_MaxDepth.store(0, std::memory_order_relaxed);
+        m_TotalLatencyNs.store(0, std::memory_order_relaxed);
+        m_MaxLatencyNs.store(0, std::memory_order_relaxed);
+    }
+}
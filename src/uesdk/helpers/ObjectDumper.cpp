@@ -0,0 +1,367 @@
+#include <uesdk/Offsets.hpp>
+#include <uesdk/State.hpp>
+#include <uesdk/core/ObjectArray.hpp>
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/core/UnrealTypes.hpp>
+#include <uesdk/helpers/ObjectDumper.hpp>
+#include <uesdk/helpers/StreamingWriter.hpp>
+
+#include <private/PropertyView.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace SDK
+{
+    // Memory layout of TArray and FString.
+    struct FRawArray
+    {
+        uint8_t* Data;
+        int32_t Num;
+        int32_t Max;
+    };
+
+    struct FDumpContext
+    {
+        FStreamingWriter& Writer;
+        const FDumpOptions& Options;
+        uint64_t Properties = 0;
+    };
+
+    static void WriteValue(FDumpContext& Context, const Properties::FPropertyView& Property, const uint8_t* Address, int32_t Depth);
+
+    template <typename T>
+    static T Read(const uint8_t* Address)
+    {
+        T Value;
+        std::memcpy(&Value, Address, sizeof(T));
+        return Value;
+    }
+
+    static void WriteCodePoint(FStreamingWriter& Writer, uint32_t CodePoint)
+    {
+        if (CodePoint < 0x80) {
+            Writer.Write(static_cast<char>(CodePoint));
+        }
+        else if (CodePoint < 0x800) {
+            Writer.Write(static_cast<char>(0xC0 | (CodePoint >> 6)));
+            Writer.Write(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        }
+        else if (CodePoint < 0x10000) {
+            Writer.Write(static_cast<char>(0xE0 | (CodePoint >> 12)));
+            Writer.Write(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Writer.Write(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        }
+        else {
+            Writer.Write(static_cast<char>(0xF0 | (CodePoint >> 18)));
+            Writer.Write(static_cast<char>(0x80 | ((CodePoint >> 12) & 0x3F)));
+            Writer.Write(static_cast<char>(0x80 | ((CodePoint >> 6) & 0x3F)));
+            Writer.Write(static_cast<char>(0x80 | (CodePoint & 0x3F)));
+        }
+    }
+
+    // Writes an FString quoted and escaped, converting it to UTF-8 without an intermediate std::string.
+    static void WriteString(FStreamingWriter& Writer, const FRawArray& String)
+    {
+        const wchar_t* Chars = reinterpret_cast<const wchar_t*>(String.Data);
+        const int32_t Num = String.Data ? String.Num : 0;
+
+        Writer.Write('"');
+
+        for (int32_t i = 0; i < Num && Chars[i]; i++) {
+            uint32_t CodePoint = static_cast<uint32_t>(Chars[i]);
+
+            // UTF-16 surrogate pair, only possible where wchar_t is 16 bits.
+            if (CodePoint >= 0xD800 && CodePoint < 0xDC00 && i + 1 < Num) {
+                const uint32_t Low = static_cast<uint32_t>(Chars[i + 1]);
+                if (Low >= 0xDC00 && Low < 0xE000) {
+                    CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (Low - 0xDC00);
+                    i++;
+                }
+            }
+
+            switch (CodePoint) {
+            case '"':
+            case '\\':
+                Writer.Write('\\');
+                Writer.Write(static_cast<char>(CodePoint));
+                break;
+            case '\n':
+                Writer.Write("\\n");
+                break;
+            case '\r':
+                Writer.Write("\\r");
+                break;
+            case '\t':
+                Writer.Write("\\t");
+                break;
+            default:
+                WriteCodePoint(Writer, CodePoint);
+                break;
+            }
+        }
+
+        Writer.Write('"');
+    }
+
+    static void WriteObject(FStreamingWriter& Writer, const UObject* Object)
+    {
+        if (Object)
+            Writer.Write(Object->GetName());
+        else
+            Writer.Write("None");
+    }
+
+    // Signed and unsigned integers of any size, including enums, which are stored as their underlying type.
+    static bool IsSignedInteger(const Properties::FPropertyView& Property)
+    {
+        // Enums take the signedness of their underlying property, and are unsigned like most engine enums if it wasn't found.
+        if (Property.HasTypeFlag(CASTCLASS_FEnumProperty)) {
+            const void* Underlying = Property.GetMember<const void>(Offsets::UEnumProperty::UnderlyingProp);
+            return Underlying && IsSignedInteger(Properties::MakeView(Underlying));
+        }
+
+        return Property.HasTypeFlag(CASTCLASS_FInt8Property) || Property.HasTypeFlag(CASTCLASS_FInt16Property) ||
+               Property.HasTypeFlag(CASTCLASS_FIntProperty) || Property.HasTypeFlag(CASTCLASS_FInt64Property);
+    }
+
+    static void WriteInteger(FStreamingWriter& Writer, const Properties::FPropertyView& Property, const uint8_t* Address)
+    {
+        const bool IsSigned = IsSignedInteger(Property);
+
+        int64_t Signed = 0;
+        uint64_t Unsigned = 0;
+
+        switch (Property.ElementSize) {
+        case 1:
+            Signed = Read<int8_t>(Address);
+            Unsigned = Read<uint8_t>(Address);
+            break;
+        case 2:
+            Signed = Read<int16_t>(Address);
+            Unsigned = Read<uint16_t>(Address);
+            break;
+        case 4:
+            Signed = Read<int32_t>(Address);
+            Unsigned = Read<uint32_t>(Address);
+            break;
+        case 8:
+            Signed = Read<int64_t>(Address);
+            Unsigned = Read<uint64_t>(Address);
+            break;
+        default:
+            Writer.Write('<');
+            Writer.Write(Property.GetTypeName());
+            Writer.Write('>');
+            return;
+        }
+
+        if (IsSigned)
+            Writer.WriteInt(Signed);
+        else
+            Writer.WriteUInt(Unsigned);
+    }
+
+    // Calls Visit with the properties of Struct and its supers, supers first.
+    template <typename VisitorType>
+    static void ForEachPropertyWithSupers(const UStruct* Struct, VisitorType&& Visit)
+    {
+        if (const UStruct* Super = Struct->SuperStruct)
+            ForEachPropertyWithSupers(Super, Visit);
+
+        Properties::ForEachProperty(Struct, Visit);
+    }
+
+    static void WriteStruct(FDumpContext& Context, const Properties::FPropertyView& Property, const uint8_t* Address, int32_t Depth)
+    {
+        FStreamingWriter& Writer = Context.Writer;
+        const UStruct* Struct = Property.GetMember<UStruct>(Offsets::UStructProperty::Struct);
+
+        if (!Struct) {
+            Writer.Write("{...}");
+            return;
+        }
+
+        if (Depth >= Context.Options.MaxStructDepth) {
+            Writer.Write('{');
+            Writer.Write(Struct->GetName());
+            Writer.Write('}');
+            return;
+        }
+
+        bool First = true;
+        Writer.Write('{');
+
+        ForEachPropertyWithSupers(Struct, [&](const Properties::FPropertyView& Member) {
+            if (!First)
+                Writer.Write(", ");
+            First = false;
+
+            Writer.Write(Member.GetName());
+            Writer.Write(" = ");
+            WriteValue(Context, Member, Address + Member.Offset, Depth + 1);
+        });
+
+        Writer.Write('}');
+    }
+
+    // Writes up to MaxArrayElements elements with WriteElement(Index), then the number of remaining ones.
+    template <typename WriteElementType>
+    static void WriteElements(FDumpContext& Context, int32_t Num, WriteElementType&& WriteElement)
+    {
+        FStreamingWriter& Writer = Context.Writer;
+        const int32_t Written = Num < Context.Options.MaxArrayElements ? Num : Context.Options.MaxArrayElements;
+
+        Writer.Write('[');
+
+        for (int32_t i = 0; i < Written; i++) {
+            if (i)
+                Writer.Write(", ");
+            WriteElement(i);
+        }
+
+        if (Written < Num) {
+            Writer.Write(Written ? ", ... " : "... ");
+            Writer.WriteInt(Num - Written);
+            Writer.Write(" more");
+        }
+
+        Writer.Write(']');
+    }
+
+    static void WriteArray(FDumpContext& Context, const Properties::FPropertyView& Property, const uint8_t* Address, int32_t Depth)
+    {
+        FStreamingWriter& Writer = Context.Writer;
+        const FRawArray& Array = *reinterpret_cast<const FRawArray*>(Address);
+        const int32_t Num = Array.Data ? Array.Num : 0;
+
+        const void* InnerProperty = Property.GetMember<const void>(Offsets::UArrayProperty::Inner);
+        if (!InnerProperty) {
+            Writer.Write("<ArrayProperty Num = ");
+            Writer.WriteInt(Num);
+            Writer.Write('>');
+            return;
+        }
+
+        Properties::FPropertyView Inner = Properties::MakeView(InnerProperty);
+        // Inner properties describe one element at offset 0.
+        Inner.Offset = 0;
+        Inner.ArrayDim = 1;
+
+        WriteElements(Context, Num, [&](int32_t i) { WriteValue(Context, Inner, Array.Data + static_cast<size_t>(i) * Inner.ElementSize, Depth + 1); });
+    }
+
+    // Writes one element of Property, Address points to the element rather than to the owning object.
+    static void WriteElement(FDumpContext& Context, const Properties::FPropertyView& Property, const uint8_t* Address, int32_t Depth)
+    {
+        FStreamingWriter& Writer = Context.Writer;
+
+        if (Property.HasTypeFlag(CASTCLASS_FBoolProperty)) {
+            const bool Value = Property.ByteMask ? (*Address & Property.ByteMask) != 0 : *Address != 0;
+            Writer.Write(Value ? "true" : "false");
+        }
+        else if (Property.HasTypeFlag(CASTCLASS_FFloatProperty)) {
+            Writer.WriteFloat(Read<float>(Address));
+        }
+        else if (Property.HasTypeFlag(CASTCLASS_FDoubleProperty)) {
+            Writer.WriteFloat(Read<double>(Address));
+        }
+        else if (Property.HasTypeFlag(CASTCLASS_FNumericProperty) || Property.HasTypeFlag(CASTCLASS_FEnumProperty)) {
+            WriteInteger(Writer, Property, Address);
+        }
+        else if (Property.HasTypeFlag(CASTCLASS_FNameProperty)) {
+            Writer.Write(reinterpret_cast<const FName*>(Address)->ToString());
+        }
+        else if (Property.HasTypeFlag(CASTCLASS_FStrProperty)) {
+            WriteString(Writer, *reinterpret_cast<const FRawArray*>(Address));
+        }
+        else if (Property.HasTypeFlag(CASTCLASS_FObjectProperty) || Property.HasTypeFlag(CASTCLASS_FInterfaceProperty)) {
+            // Soft, weak and lazy object properties don't hold a UObject*, they're caught by the fallback below.
+            // FScriptInterface starts with the object pointer, so interfaces are written the same way.
+            if (Property.HasTypeFlag(CASTCLASS_FWeakObjectProperty) || Property.HasTypeFlag(CASTCLASS_FLazyObjectProperty) ||
+                Property.HasTypeFlag(CASTCLASS_FSoftObjectProperty)) {
+                Writer.Write('<');
+                Writer.Write(Property.GetTypeName());
+                Writer.Write('>');
+            }
+            else {
+                WriteObject(Writer, Read<const UObject*>(Address));
+            }
+        }
+        else if (Property.HasTypeFlag(CASTCLASS_FStructProperty)) {
+            WriteStruct(Context, Property, Address, Depth);
+        }
+        else if (Property.HasTypeFlag(CASTCLASS_FArrayProperty)) {
+            WriteArray(Context, Property, Address, Depth);
+        }
+        else {
+            Writer.Write('<');
+            Writer.Write(Property.GetTypeName());
+            Writer.Write('>');
+        }
+    }
+
+    static void WriteValue(FDumpContext& Context, const Properties::FPropertyView& Property, const uint8_t* Address, int32_t Depth)
+    {
+        if (Property.ArrayDim <= 1) {
+            WriteElement(Context, Property, Address, Depth);
+            return;
+        }
+
+        WriteElements(Context, Property.ArrayDim,
+                      [&](int32_t i) { WriteElement(Context, Property, Address + static_cast<size_t>(i) * Property.ElementSize, Depth); });
+    }
+
+    static void WriteObjectProperties(FDumpContext& Context, const UObject* Object)
+    {
+        FStreamingWriter& Writer = Context.Writer;
+        const uint8_t* Base = reinterpret_cast<const uint8_t*>(Object);
+
+        // Already "Class Outer.Name".
+        Writer.Write(Object->GetFullName());
+        Writer.Write('\n');
+
+        ForEachPropertyWithSupers(Object->Class, [&](const Properties::FPropertyView& Property) {
+            Writer.Write('\t');
+            Writer.Write(Property.GetName());
+            Writer.Write(" = ");
+            WriteValue(Context, Property, Base + Property.Offset, 0);
+            Writer.Write('\n');
+
+            Context.Properties++;
+        });
+    }
+
+    FDumpStats DumpObjects(const std::string& Path, const FDumpOptions& Options)
+    {
+        if (!State::Setup)
+            throw std::logic_error("DumpObjects: SDK isn't initialized");
+
+        FStreamingWriter Writer(Path, Options.BufferSize);
+        FDumpContext Context{ Writer, Options };
+        FDumpStats Stats;
+
+        for (int32_t i = 0; i < GObjects->Num(); i++) {
+            const UObject* Object = GObjects->GetByIndex(i);
+            if (!Object || !Object->Class)
+                continue;
+
+            if (!Options.IncludeDefaultObjects && Object->IsDefaultObject())
+                continue;
+
+            if (Options.Filter && !Object->IsA(Options.Filter))
+                continue;
+
+            WriteObjectProperties(Context, Object);
+            Stats.Objects++;
+        }
+
+        Writer.Close();
+
+        Stats.Properties = Context.Properties;
+        Stats.Bytes = Writer.GetBytesWritten();
+        Stats.Seconds = Writer.GetSeconds();
+        Stats.MBPerSecond = Writer.GetMBPerSecond();
+        return Stats;
+    }
+}
@@ -0,0 +1,105 @@
+#include <uesdk/State.hpp>
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/PropertyGather.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace SDK::Gather
+{
+    static bool HasTypeFlag(const PropertyInfo& Property, EClassCastFlags TypeFlag)
+    {
+        if (State::UsesFProperty)
+            return Property.FProp && Property.FProp->HasTypeFlag(TypeFlag);
+
+        return Property.Prop && Property.Prop->HasTypeFlag(TypeFlag);
+    }
+
+    FCompiledPath CompilePath(std::span<const PropertyInfo> Path)
+    {
+        if (Path.empty())
+            throw std::invalid_argument("Property path is empty!");
+
+        FCompiledPath Compiled;
+        int32_t Pending = 0;
+
+        for (size_t i = 0; i + 1 < Path.size(); i++) {
+            const PropertyInfo& Property = Path[i];
+            if (!Property.Found)
+                throw std::invalid_argument("Property path contains a property that wasn't found!");
+
+            if (HasTypeFlag(Property, CASTCLASS_FStructProperty)) {
+                Pending += Property.Offset;
+            }
+            else if (HasTypeFlag(Property, CASTCLASS_FObjectProperty)) {
+                // Only hard references hold a raw UObject*.
+                if (HasTypeFlag(Property, CASTCLASS_FWeakObjectProperty) || HasTypeFlag(Property, CASTCLASS_FLazyObjectProperty) ||
+                    HasTypeFlag(Property, CASTCLASS_FSoftObjectProperty))
+                    throw std::invalid_argument("Property path can't pass through weak, lazy or soft object properties!");
+
+                Compiled.Steps.push_back({ Pending + Property.Offset, true });
+                Pending = 0;
+            }
+            else {
+                throw std::invalid_argument("Property path can only pass through object and struct properties!");
+            }
+        }
+
+        const PropertyInfo& Last = Path.back();
+        Compiled.FinalOffset = Pending + Last.Offset;
+        Compiled.ElementSize = Last.ElementSize;
+        Compiled.ByteMask = Last.ByteMask;
+        return Compiled;
+    }
+
+    void CheckGather(const PropertyInfo& Property, size_t ValueSize, bool IsFlag, size_t NumObjects, size_t NumOut)
+    {
+        if (!Property.Found)
+            throw std::invalid_argument("Gathered property wasn't found!");
+
+        if (Property.ByteMask) {
+            if (!IsFlag)
+                throw std::invalid_argument("Bit-field properties can only be gathered into bool or uint8_t!");
+        }
+        else if (ValueSize != static_cast<size_t>(Property.ElementSize)) {
+            throw std::invalid_argument("Gathered type size doesn't match the property size!");
+        }
+
+        if (NumOut < NumObjects)
+            throw std::invalid_argument("Gather output is smaller than the object list!");
+    }
+
+    static int64_t NowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    FStatsRecorder::FStatsRecorder(FGatherStats* Stats)
+        : m_Stats(Stats)
+    {
+        if (m_Stats)
+            *m_Stats = {};
+    }
+
+    void FStatsRecorder::BeginBatch()
+    {
+        if (m_Stats)
+            m_BatchStart = NowNs();
+    }
+
+    void FStatsRecorder::EndBatch(size_t Objects, size_t Skipped)
+    {
+        if (!m_Stats)
+            return;
+
+        const double BatchNs = static_cast<double>(NowNs() - m_BatchStart);
+
+        m_Stats->MinBatchNs = m_Stats->Batches ? std::min(m_Stats->MinBatchNs, BatchNs) : BatchNs;
+        m_Stats->MaxBatchNs = std::max(m_Stats->MaxBatchNs, BatchNs);
+        m_Stats->TotalNs += BatchNs;
+        m_Stats->Batches++;
+        m_Stats->Objects += Objects;
+        m_Stats->Skipped += Skipped;
+    }
+}
@@ -0,0 +1,238 @@
+#include <uesdk/core/ObjectArray.hpp>
+#include <uesdk/helpers/PropertySnapshot.hpp>
+#include <private/PropertyView.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <emmintrin.h>
+#include <unordered_map>
+
+namespace SDK
+{
+    // How many rows ahead of the current one are prefetched while copying.
+    static constexpr int32_t kPrefetchDistance = 4;
+
+    int32_t FPropertySnapshot::Watch(UClass* Class, const std::vector<std::string>& Properties)
+    {
+        if (!Class)
+            throw std::invalid_argument("Invalid UClass!");
+
+        FSet Set;
+        Set.Class = Class;
+        Set.Columns.reserve(Properties.size());
+
+        for (const std::string& PropertyName : Properties) {
+            FName Name(PropertyName);
+
+            PropertyInfo Info = {};
+            for (const UStruct* Struct = Class; Struct && !Info.Found; Struct = Struct->SuperStruct)
+                Info = Struct->FindProperty(Name);
+
+            if (!Info.Found)
+                throw std::invalid_argument("Failed to find property '" + PropertyName + "' in '" + Class->GetName() + "'");
+
+            FColumn Column;
+            Column.Name = Name;
+            Column.Offset = Info.Offset;
+            Column.ByteMask = Info.ByteMask;
+            Column.ElementSize = Info.ByteMask ? 1 : Info.ElementSize * std::max(Properties::MakeView(Info.Prop).ArrayDim, 1);
+            Set.Columns.push_back(std::move(Column));
+        }
+
+        m_Sets.push_back(std::move(Set));
+        return static_cast<int32_t>(m_Sets.size() - 1);
+    }
+
+    void FPropertySnapshot::RefreshObjects()
+    {
+        std::vector<std::vector<UObject*>> Found(m_Sets.size());
+
+        for (int32_t i = 0; i < GObjects->Num(); i++) {
+            UObject* Obj = GObjects->GetByIndex(i);
+            if (!Obj || Obj->IsDefaultObject())
+                continue;
+
+            for (size_t SetIndex = 0; SetIndex < m_Sets.size(); SetIndex++) {
+                if (Obj->IsA(m_Sets[SetIndex].Class))
+                    Found[SetIndex].push_back(Obj);
+            }
+        }
+
+        for (size_t SetIndex = 0; SetIndex < m_Sets.size(); SetIndex++) {
+            FSet& Set = m_Sets[SetIndex];
+            std::vector<UObject*>& Objects = Found[SetIndex];
+
+            // Old rows by GObjects index. Only rows with a known serial number can be told apart from a new object in the same
+            // slot and memory, rows with serial 0 are read again as new ones.
+            std::unordered_map<int32_t, int32_t> OldRows;
+            OldRows.reserve(Set.Objects.size());
+            for (size_t Row = 0; Row < Set.Objects.size(); Row++) {
+                if (Set.SerialNumbers[Row] != 0)
+                    OldRows.emplace(Set.ObjectIndices[Row], static_cast<int32_t>(Row));
+            }
+
+            std::vector<int32_t> SerialNumbers(Objects.size());
+            for (size_t Row = 0; Row < Objects.size(); Row++) {
+                const FUObjectItem* Item = GObjects->GetItemByIndex(Objects[Row]->Index);
+                SerialNumbers[Row] = Item ? Item->SerialNumber : 0;
+            }
+
+            // Maps new rows to old ones, -1 for objects that weren't watched before.
+            std::vector<int32_t> Remap(Objects.size(), -1);
+            Set.NewRows.clear();
+            for (size_t Row = 0; Row < Objects.size(); Row++) {
+                auto It = OldRows.find(Objects[Row]->Index);
+                if (It != OldRows.end() && Set.Objects[It->second] == Objects[Row] && Set.SerialNumbers[It->second] == SerialNumbers[Row])
+                    Remap[Row] = It->second;
+                else
+                    Set.NewRows.push_back(static_cast<int32_t>(Row));
+            }
+
+            for (FColumn& Column : Set.Columns) {
+                const size_t ElementSize = Column.ElementSize;
+
+                for (std::vector<uint8_t>& Data : Column.Data) {
+                    std::vector<uint8_t> Remapped(Objects.size() * ElementSize);
+                    for (size_t Row = 0; Row < Objects.size(); Row++) {
+                        if (Remap[Row] >= 0)
+                            std::memcpy(Remapped.data() + Row * ElementSize, Data.data() + Remap[Row] * ElementSize, ElementSize);
+                    }
+                    Data = std::move(Remapped);
+                }
+            }
+
+            Set.ObjectIndices.resize(Objects.size());
+            for (size_t Row = 0; Row < Objects.size(); Row++)
+                Set.ObjectIndices[Row] = Objects[Row]->Index;
+
+            Set.SerialNumbers = std::move(SerialNumbers);
+            Set.Objects = std::move(Objects);
+        }
+    }
+
+    const std::vector<FPropertySnapshot::FChange>& FPropertySnapshot::Capture()
+    {
+        m_Frame ^= 1;
+        m_Changes.clear();
+
+        for (size_t SetIndex = 0; SetIndex < m_Sets.size(); SetIndex++)
+            CaptureSet(static_cast<int32_t>(SetIndex), m_Sets[SetIndex]);
+
+        return m_Changes;
+    }
+
+    // Appends the rows that differ between two columns of ElementSize sized elements, in ascending order.
+    static void DiffColumn(const uint8_t* Current, const uint8_t* Previous, size_t Size, size_t ElementSize, int32_t SetIndex, int32_t ColumnIndex,
+        std::vector<FPropertySnapshot::FChange>& Changes)
+    {
+        int64_t LastRow = -1;
+        auto Emit = [&](size_t ByteIndex) {
+            const int64_t Row = static_cast<int64_t>(ByteIndex / ElementSize);
+            if (Row != LastRow) {
+                Changes.push_back({ SetIndex, ColumnIndex, static_cast<int32_t>(Row) });
+                LastRow = Row;
+            }
+        };
+
+        size_t i = 0;
+        for (; i + 16 <= Size; i += 16) {
+            const __m128i A = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Current + i));
+            const __m128i B = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Previous + i));
+            uint32_t Mask = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(A, B))) & 0xFFFF;
+
+            while (Mask) {
+                const size_t ByteIndex = i + std::countr_zero(Mask);
+                Emit(ByteIndex);
+
+                // Skip the rest of this row's bytes within the block.
+                const size_t RowEnd = (ByteIndex / ElementSize + 1) * ElementSize - i;
+                Mask = RowEnd >= 16 ? 0 : Mask & ~((1u << RowEnd) - 1);
+            }
+        }
+
+        for (; i < Size; i++) {
+            if (Current[i] != Previous[i])
+                Emit(i);
+        }
+    }
+
+    void FPropertySnapshot::CaptureSet(int32_t SetIndex, FSet& Set)
+    {
+        const size_t NumRows = Set.Objects.size();
+        const uint32_t Write = m_Frame;
+        const uint32_t Read = m_Frame ^ 1;
+
+        for (size_t Row = 0; Row < NumRows; Row++) {
+            if (Row + kPrefetchDistance < NumRows && !Set.Columns.empty())
+                _mm_prefetch(reinterpret_cast<const char*>(Set.Objects[Row + kPrefetchDistance]) + Set.Columns[0].Offset, _MM_HINT_T0);
+
+            const uint8_t* Obj = reinterpret_cast<const uint8_t*>(Set.Objects[Row]);
+            // Serial 0 is unknown, the engine only numbers objects once something holds a weak pointer to them. Such rows are
+            // read as long as their slot holds the same pointer, and adopt the serial once one is assigned.
+            const FUObjectItem* Item = GObjects->GetItemByIndex(Set.ObjectIndices[Row]);
+            const bool Alive = Item && Item->Object == Set.Objects[Row] && (Set.SerialNumbers[Row] == 0 || Item->SerialNumber == Set.SerialNumbers[Row]);
+            if (Alive && Set.SerialNumbers[Row] == 0)
+                Set.SerialNumbers[Row] = Item->SerialNumber;
+
+            for (FColumn& Column : Set.Columns) {
+                uint8_t* Dest = Column.Data[Write].data() + Row * Column.ElementSize;
+
+                if (!Alive)
+                    std::memcpy(Dest, Column.Data[Read].data() + Row * Column.ElementSize, Column.ElementSize);
+                else if (Column.ByteMask)
+                    *Dest = (Obj[Column.Offset] & Column.ByteMask) ? 1 : 0;
+                else
+                    std::memcpy(Dest, Obj + Column.Offset, Column.ElementSize);
+            }
+        }
+
+        // New rows have no previous value. Inverting it makes every byte differ, so they're reported in order with the rest.
+        for (int32_t Row : Set.NewRows) {
+            for (FColumn& Column : Set.Columns) {
+                const size_t Begin = Row * Column.ElementSize;
+                for (size_t i = Begin; i < Begin + Column.ElementSize; i++)
+                    Column.Data[Read][i] = static_cast<uint8_t>(~Column.Data[Write][i]);
+            }
+        }
+        Set.NewRows.clear();
+
+        for (size_t ColumnIndex = 0; ColumnIndex < Set.Columns.size(); ColumnIndex++) {
+            const FColumn& Column = Set.Columns[ColumnIndex];
+            DiffColumn(Column.Data[Write].data(), Column.Data[Read].data(), NumRows * Column.ElementSize, Column.ElementSize, SetIndex,
+                static_cast<int32_t>(ColumnIndex), m_Changes);
+        }
+    }
+
+    const std::vector<UObject*>& FPropertySnapshot::GetObjects(int32_t Set) const
+    {
+        if (Set < 0 || Set >= NumSets())
+            throw std::out_of_range("Set index was out of range!");
+
+        return m_Sets[Set].Objects;
+    }
+
+    int32_t FPropertySnapshot::FindColumn(int32_t Set, const FName& Name) const
+    {
+        if (Set < 0 || Set >= NumSets())
+            return -1;
+
+        const std::vector<FColumn>& Columns = m_Sets[Set].Columns;
+        for (size_t i = 0; i < Columns.size(); i++) {
+            if (Columns[i].Name == Name)
+                return static_cast<int32_t>(i);
+        }
+
+        return -1;
+    }
+
+    const FPropertySnapshot::FColumn& FPropertySnapshot::GetColumnChecked(int32_t Set, int32_t Column) const
+    {
+        if (Set < 0 || Set >= NumSets())
+            throw std::out_of_range("Set index was out of range!");
+        if (Column < 0 || Column >= static_cast<int32_t>(m_Sets[Set].Columns.size()))
+            throw std::out_of_range("Column index was out of range!");
+
+        return m_Sets[Set].Columns[Column];
+    }
+}
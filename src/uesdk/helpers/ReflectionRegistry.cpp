@@ -0,0 +1,226 @@
+#include <uesdk/core/ObjectArray.hpp>
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/FastSearch.hpp>
+#include <uesdk/helpers/ReflectionRegistry.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace SDK::Reflection
+{
+    struct FRegistry
+    {
+        // Also serializes resolving, so ResolveAllReflected and lazy resolves never write the same descriptor at once.
+        std::mutex Mutex;
+
+        std::vector<FReflectedClass*> Classes;
+        std::vector<FReflectedProperty*> Properties;
+
+        bool ResolveAll();
+        bool Seal();
+    };
+
+    // Bumped by every ResolveAllReflected. A lazy resolve that missed remembers the generation it missed in, and doesn't search
+    // GObjects again until the next ResolveAllReflected, otherwise every access would scan GObjects under the registry mutex.
+    static std::atomic<uint32_t> g_ResolveGeneration = 1;
+
+    // Descriptors register during static initialization, so the registry must be constructed on first use.
+    static FRegistry& GetRegistry()
+    {
+        static FRegistry Registry;
+        return Registry;
+    }
+
+    static uint32_t RegisterProperty(FReflectedProperty* Property)
+    {
+        FRegistry& Registry = GetRegistry();
+        std::lock_guard Lock(Registry.Mutex);
+
+        if (Registry.Properties.size() >= kMaxReflectedProperties)
+            throw std::length_error("Too many reflected properties, raise UESDK_MAX_REFLECTED_PROPERTIES");
+
+        Registry.Properties.push_back(Property);
+        return static_cast<uint32_t>(Registry.Properties.size() - 1);
+    }
+
+    FReflectedClass::FReflectedClass(const char* ClassName)
+        : ClassName(ClassName)
+    {
+        {
+            FRegistry& Registry = GetRegistry();
+            std::lock_guard Lock(Registry.Mutex);
+            Registry.Classes.push_back(this);
+        }
+
+        // Sealed accessors never resolve, so late descriptors resolve now.
+        if (g_Sealed)
+            Resolve();
+    }
+
+    void FReflectedClass::Resolve()
+    {
+        if (m_MissGeneration.load(std::memory_order_relaxed) == g_ResolveGeneration.load(std::memory_order_relaxed))
+            return;
+
+        std::lock_guard Lock(GetRegistry().Mutex);
+        if (m_Resolved.load(std::memory_order_relaxed))
+            return;
+
+        const uint32_t Generation = g_ResolveGeneration.load(std::memory_order_relaxed);
+        if (m_MissGeneration.load(std::memory_order_relaxed) == Generation)
+            return;
+
+        m_Class = GObjects->FindObjectFast<UClass>(ClassName, CASTCLASS_UClass);
+        if (m_Class)
+            m_Resolved.store(true, std::memory_order_release);
+        else
+            m_MissGeneration.store(Generation, std::memory_order_relaxed);
+    }
+
+    FReflectedProperty::FReflectedProperty(const char* OwnerName, const char* PropertyName)
+        : OwnerName(OwnerName)
+        , PropertyName(PropertyName)
+        , Slot(RegisterProperty(this))
+    {
+        if (g_Sealed)
+            Resolve();
+    }
+
+    void FReflectedProperty::Resolve()
+    {
+        if (m_MissGeneration.load(std::memory_order_relaxed) == g_ResolveGeneration.load(std::memory_order_relaxed))
+            return;
+
+        std::lock_guard Lock(GetRegistry().Mutex);
+        if (m_Resolved.load(std::memory_order_relaxed))
+            return;
+
+        const uint32_t Generation = g_ResolveGeneration.load(std::memory_order_relaxed);
+        if (m_MissGeneration.load(std::memory_order_relaxed) == Generation)
+            return;
+
+        // Like classes, a missing owner is searched again after the next ResolveAllReflected, it may not be loaded yet.
+        const UStruct* Owner = GObjects->FindObjectFast<UStruct>(OwnerName, CASTCLASS_UStruct);
+        if (Owner)
+            Publish(Owner->FindProperty(FName(PropertyName)));
+        else
+            m_MissGeneration.store(Generation, std::memory_order_relaxed);
+    }
+
+    // Called with the registry locked. The table entry is written before the release store, so acquiring readers see it.
+    void FReflectedProperty::Publish(const PropertyInfo& Info)
+    {
+        m_Info = Info;
+        g_PropertyOffsets[Slot] = { Info.Offset, Info.ByteMask, Info.Found };
+        m_Resolved.store(true, std::memory_order_release);
+    }
+
+    void ThrowPropertyNotFound(const FReflectedProperty& Property)
+    {
+        throw std::runtime_error("Failed to get property! (" + std::string(Property.OwnerName) + ", " + Property.PropertyName + ")");
+    }
+
+    // Called with the registry locked.
+    bool FRegistry::ResolveAll()
+    {
+        // One search entry per distinct class or struct, however many descriptors share it.
+        std::unordered_map<std::string_view, UClass*> ClassesByName;
+        std::unordered_map<std::string_view, UStruct*> OwnersByName;
+
+        for (FReflectedClass* Class : Classes) {
+            if (!Class->m_Resolved.load(std::memory_order_relaxed))
+                ClassesByName.try_emplace(Class->ClassName, nullptr);
+        }
+        for (FReflectedProperty* Property : Properties) {
+            if (!Property->m_Resolved.load(std::memory_order_relaxed))
+                OwnersByName.try_emplace(Property->OwnerName, nullptr);
+        }
+
+        std::vector<FSEntry> Search;
+        Search.reserve(ClassesByName.size() + OwnersByName.size());
+        for (auto& [Name, Class] : ClassesByName)
+            Search.push_back(FSUObject(Name, CASTCLASS_UClass, &Class));
+        for (auto& [Name, Owner] : OwnersByName)
+            Search.push_back(FSUObject(Name, CASTCLASS_UStruct, &Owner));
+
+        if (!Search.empty())
+            FastSearchParallel(Search);
+
+        bool AllFound = true;
+
+        for (FReflectedClass* Class : Classes) {
+            if (Class->m_Resolved.load(std::memory_order_relaxed))
+                continue;
+
+            Class->m_Class = ClassesByName[Class->ClassName];
+            if (!Class->m_Class) {
+                AllFound = false;
+                continue;
+            }
+
+            Class->m_Resolved.store(true, std::memory_order_release);
+        }
+
+        for (FReflectedProperty* Property : Properties) {
+            if (Property->m_Resolved.load(std::memory_order_relaxed)) {
+                AllFound &= Property->m_Info.Found;
+                continue;
+            }
+
+            const UStruct* Owner = OwnersByName[Property->OwnerName];
+            if (!Owner) {
+                AllFound = false;
+                continue;
+            }
+
+            Property->Publish(Owner->FindProperty(FName(Property->PropertyName)));
+            AllFound &= Property->m_Info.Found;
+        }
+
+        return AllFound;
+    }
+
+    bool FRegistry::Seal()
+    {
+        std::lock_guard Lock(Mutex);
+
+        if (g_Sealed)
+            return false;
+
+        const bool AllFound = ResolveAll();
+
+        // Whatever is still unresolved stays unfound, the table entries already say so.
+        for (FReflectedClass* Class : Classes)
+            Class->m_Resolved.store(true, std::memory_order_relaxed);
+        for (FReflectedProperty* Property : Properties)
+            Property->m_Resolved.store(true, std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_release);
+        g_Sealed = true;
+
+        return AllFound;
+    }
+}
+
+namespace SDK
+{
+    bool ResolveAllReflected()
+    {
+        Reflection::FRegistry& Registry = Reflection::GetRegistry();
+        std::lock_guard Lock(Registry.Mutex);
+
+        // Whatever this pass doesn't find may be searched for lazily once more.
+        Reflection::g_ResolveGeneration.fetch_add(1, std::memory_order_relaxed);
+        return Registry.ResolveAll();
+    }
+
+    bool Seal()
+    {
+        return Reflection::GetRegistry().Seal();
+    }
+}
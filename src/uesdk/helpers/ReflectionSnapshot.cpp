@@ -0,0 +1,100 @@
+#include <uesdk/State.hpp>
+#include <uesdk/core/ObjectArray.hpp>
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/ReflectionSnapshot.hpp>
+
+#include <private/PropertyView.hpp>
+
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+
+namespace SDK
+{
+    static std::string GetPackageName(const UObject* Obj)
+    {
+        const UObject* Package = Obj;
+        while (Package->Outer)
+            Package = Package->Outer;
+
+        return Package == Obj ? "-" : Package->GetName();
+    }
+
+    static void WriteProperty(std::ostream& Stream, const char* Tag, const Properties::FPropertyView& Property)
+    {
+        Stream << Tag << '\t' << Property.GetName() << '\t' << Property.GetTypeName() << '\t' << std::hex << Property.CastFlags << std::dec << '\t' << Property.Offset << '\t'
+               << Property.ElementSize << '\t' << Property.ArrayDim << '\t' << static_cast<uint32_t>(Property.ByteMask) << '\t' << std::hex << Property.Flags << std::dec
+               << '\n';
+    }
+
+    static void WriteStruct(std::ostream& Stream, const UStruct* Struct, bool IsClass)
+    {
+        const UStruct* Super = Struct->SuperStruct;
+
+        Stream << (IsClass ? "CLASS" : "STRUCT") << '\t' << GetPackageName(Struct) << '\t' << Struct->GetName() << '\t' << (Super ? Super->GetName() : "-") << '\t'
+               << Struct->PropertiesSize << '\t' << Struct->MinAlignment << '\n';
+
+        Properties::ForEachProperty(Struct, [&](const Properties::FPropertyView& Property) { WriteProperty(Stream, "PROP", Property); });
+
+        if (!IsClass)
+            return;
+
+        for (UField* Child = Struct->Children; Child; Child = Child->Next) {
+            if (!Child->HasTypeFlag(CASTCLASS_UFunction))
+                continue;
+
+            const UFunction* Function = static_cast<const UFunction*>(Child);
+            Stream << "FUNC\t" << Function->GetName() << '\t' << std::hex << static_cast<uint32_t>(Function->FunctionFlags) << std::dec << '\t' << Function->ParmsSize
+                   << '\t' << Function->ReturnValueOffset << '\n';
+
+            Properties::ForEachProperty(Function, [&](const Properties::FPropertyView& Property) {
+                if (Property.Flags & CPF_Parm)
+                    WriteProperty(Stream, "PARM", Property);
+            });
+        }
+    }
+
+    static void WriteEnum(std::ostream& Stream, const UEnum* Enum)
+    {
+        Stream << "ENUM\t" << GetPackageName(Enum) << '\t' << Enum->GetName() << '\n';
+
+        const TArray<TPair<FName, int64_t>>& Names = Enum->Names;
+        if (!Names.IsValid())
+            return;
+
+        for (int32_t i = 0; i < Names.Num(); i++)
+            Stream << "VALUE\t" << Names[i].Key().ToString() << '\t' << Names[i].Value() << '\n';
+    }
+
+    void WriteReflectionSnapshot(std::ostream& Stream)
+    {
+        if (!State::Setup)
+            throw std::logic_error("WriteReflectionSnapshot: SDK isn't initialized");
+
+        Stream << "UESDK_SNAPSHOT\t" << kReflectionSnapshotVersion << '\t' << (State::UsesFProperty ? "FProperty" : "UProperty") << '\n';
+
+        for (int32_t i = 0; i < GObjects->Num(); i++) {
+            const UObject* Obj = GObjects->GetByIndex(i);
+            if (!Obj || Obj->IsDefaultObject())
+                continue;
+
+            if (Obj->HasTypeFlag(CASTCLASS_UClass))
+                WriteStruct(Stream, static_cast<const UStruct*>(Obj), true);
+            else if (Obj->HasTypeFlag(CASTCLASS_UScriptStruct))
+                WriteStruct(Stream, static_cast<const UStruct*>(Obj), false);
+            else if (Obj->HasTypeFlag(CASTCLASS_UEnum))
+                WriteEnum(Stream, static_cast<const UEnum*>(Obj));
+        }
+    }
+
+    bool SaveReflectionSnapshot(const std::string& Path)
+    {
+        std::ofstream File(Path, std::ios::out | std::ios::trunc);
+        if (!File)
+            return false;
+
+        WriteReflectionSnapshot(File);
+        File.flush();
+        return static_cast<bool>(File);
+    }
+}
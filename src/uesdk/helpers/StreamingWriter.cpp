@@ -0,0 +1,166 @@
+#include <uesdk/helpers/StreamingWriter.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace SDK
+{
+    static int64_t NowNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    FStreamingWriter::FStreamingWriter(const std::string& Path, size_t BufferSize)
+        : m_BufferSize(BufferSize)
+    {
+        if (BufferSize == 0)
+            throw std::invalid_argument("FStreamingWriter: BufferSize must not be 0");
+
+        m_File = std::fopen(Path.c_str(), "wb");
+        if (!m_File)
+            throw std::runtime_error("FStreamingWriter: Failed to open " + Path);
+
+        m_Buffers[0] = std::make_unique<char[]>(BufferSize);
+        m_Buffers[1] = std::make_unique<char[]>(BufferSize);
+
+        m_StartNs = NowNs();
+        m_Thread = std::thread(&FStreamingWriter::WriterThread, this);
+    }
+
+    FStreamingWriter::~FStreamingWriter()
+    {
+        try {
+            Close();
+        }
+        catch (...) {
+        }
+    }
+
+    void FStreamingWriter::WriterThread()
+    {
+        std::unique_lock Lock(m_Mutex);
+
+        while (true) {
+            m_Condition.wait(Lock, [this] { return m_Pending || m_Stop; });
+            if (!m_Pending)
+                return;
+
+            // The producer never touches the inactive buffer while m_Pending is set, so it's written without the lock.
+            const char* Data = m_Buffers[m_Active ^ 1].get();
+            const size_t Size = m_PendingSize;
+
+            Lock.unlock();
+            const bool Written = std::fwrite(Data, 1, Size, m_File) == Size;
+            Lock.lock();
+
+            m_Failed |= !Written;
+            m_Pending = false;
+            m_Condition.notify_all();
+        }
+    }
+
+    void FStreamingWriter::Submit()
+    {
+        if (m_Closed) {
+            m_Used = 0;
+            return;
+        }
+
+        std::unique_lock Lock(m_Mutex);
+        m_Condition.wait(Lock, [this] { return !m_Pending; });
+
+        m_Pending = true;
+        m_PendingSize = m_Used;
+        m_Active ^= 1;
+        m_Condition.notify_all();
+
+        m_Submitted += m_Used;
+        m_Used = 0;
+    }
+
+    void FStreamingWriter::Write(const void* Data, size_t Size)
+    {
+        const char* Source = static_cast<const char*>(Data);
+
+        while (Size) {
+            if (m_Used == m_BufferSize)
+                Submit();
+
+            const size_t Chunk = std::min(Size, m_BufferSize - m_Used);
+            std::memcpy(m_Buffers[m_Active].get() + m_Used, Source, Chunk);
+
+            m_Used += Chunk;
+            Source += Chunk;
+            Size -= Chunk;
+        }
+    }
+
+    // Enough for any 64-bit integer or the shortest round-trip form of a double.
+    static constexpr size_t kMaxNumberChars = 32;
+
+    template <typename T, typename... ArgTypes>
+    static void WriteNumber(FStreamingWriter& Writer, T Value, ArgTypes... Args)
+    {
+        char Buffer[kMaxNumberChars];
+        const auto Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value, Args...);
+        Writer.Write(Buffer, static_cast<size_t>(Result.ptr - Buffer));
+    }
+
+    void FStreamingWriter::WriteInt(int64_t Value)
+    {
+        WriteNumber(*this, Value);
+    }
+
+    void FStreamingWriter::WriteUInt(uint64_t Value)
+    {
+        WriteNumber(*this, Value);
+    }
+
+    void FStreamingWriter::WriteHex(uint64_t Value)
+    {
+        Write("0x");
+        WriteNumber(*this, Value, 16);
+    }
+
+    void FStreamingWriter::WriteFloat(double Value)
+    {
+        WriteNumber(*this, Value);
+    }
+
+    void FStreamingWriter::Close()
+    {
+        if (m_Closed)
+            return;
+
+        Submit();
+        m_Closed = true;
+
+        {
+            std::lock_guard Lock(m_Mutex);
+            m_Stop = true;
+        }
+        m_Condition.notify_all();
+        m_Thread.join();
+
+        const bool Flushed = std::fclose(m_File) == 0;
+        m_File = nullptr;
+        m_EndNs = NowNs();
+
+        if (m_Failed || !Flushed)
+            throw std::runtime_error("FStreamingWriter: Failed to write to the file");
+    }
+
+    double FStreamingWriter::GetSeconds() const
+    {
+        return static_cast<double>((m_Closed ? m_EndNs : NowNs()) - m_StartNs) / 1e9;
+    }
+
+    double FStreamingWriter::GetMBPerSecond() const
+    {
+        const double Seconds = GetSeconds();
+        return Seconds > 0.0 ? static_cast<double>(GetBytesWritten()) / 1e6 / Seconds : 0.0;
+    }
+}
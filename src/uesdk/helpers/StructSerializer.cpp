@@ -0,0 +1,560 @@
+#include <uesdk/State.hpp>
+#include <uesdk/core/FMemory.hpp>
+#include <uesdk/core/UnrealObjects.hpp>
+#include <uesdk/helpers/StructSerializer.hpp>
+
+#include <private/PropertyView.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace SDK
+{
+    using FOp = FStructSerializer::FOp;
+    using FPlan = FStructSerializer::FPlan;
+    using EOpType = FStructSerializer::EOpType;
+    using Properties::FPropertyView;
+
+    static constexpr uint32_t kStreamMagic = 0x53534555; // "UESS"
+
+    struct FStreamHeader
+    {
+        uint32_t Magic;
+        uint16_t Version;
+        uint16_t Reserved;
+        uint32_t LayoutHash;
+        int32_t Count;
+    };
+
+    // Memory layout of TArray and FString, they're resized in place.
+    struct FRawArray
+    {
+        uint8_t* Data;
+        int32_t Num;
+        int32_t Max;
+    };
+
+    static constexpr uint64_t kUnsupportedTypes = CASTCLASS_FMapProperty | CASTCLASS_FSetProperty | CASTCLASS_FTextProperty | CASTCLASS_FDelegateProperty
+        | CASTCLASS_FMulticastDelegateProperty | CASTCLASS_FMulticastInlineDelegateProperty | CASTCLASS_FMulticastSparseDelegateProperty | CASTCLASS_FSoftObjectProperty
+        | CASTCLASS_FSoftClassProperty | CASTCLASS_FFieldPathProperty;
+
+    static constexpr uint64_t kCopiedTypes = CASTCLASS_FNumericProperty | CASTCLASS_FEnumProperty | CASTCLASS_FBoolProperty | CASTCLASS_FObjectPropertyBase
+        | CASTCLASS_FInterfaceProperty;
+
+    // Compilation
+
+    struct FPlanCompiler
+    {
+        FStructSerializer& Serializer;
+        std::unordered_map<const UStruct*, int32_t> StructPlans;
+        // A skipped property lies after the last copy, copying across it would overwrite it when deserializing.
+        bool SkippedSinceCopy = false;
+
+        int32_t AddPlan()
+        {
+            Serializer.m_Plans.emplace_back();
+            return static_cast<int32_t>(Serializer.m_Plans.size() - 1);
+        }
+
+        void Skip(const std::string& OwnerName, const FPropertyView& Property)
+        {
+            Serializer.m_Skipped.push_back(OwnerName + "." + Property.GetName());
+            SkippedSinceCopy = true;
+        }
+
+        // Bytes between End and Offset are alignment padding if Offset is the first boundary of its own alignment after End.
+        static bool IsPadding(int32_t End, int32_t Offset, int32_t MaxAlignment = 16)
+        {
+            const int32_t Alignment = Offset ? std::min(Offset & -Offset, MaxAlignment) : 1;
+            return End <= Offset && (End + Alignment - 1) / Alignment * Alignment == Offset;
+        }
+
+        // Extends the last copy over the padding before Offset, so structs of plain members like FTransform become a single copy.
+        void AddCopy(FPlan& Plan, int32_t Offset, int32_t Size)
+        {
+            if (!Plan.Ops.empty() && !SkippedSinceCopy) {
+                FOp& Last = Plan.Ops.back();
+                if (Last.Type == EOpType::Copy && IsPadding(Last.Offset + Last.Size, Offset)) {
+                    Last.Size = Offset + Size - Last.Offset;
+                    return;
+                }
+            }
+
+            Plan.Ops.push_back({ .Type = EOpType::Copy, .Offset = Offset, .Size = Size });
+            SkippedSinceCopy = false;
+        }
+
+        // Plans are compiled into locals and moved into m_Plans afterwards, nested compiles may reallocate it.
+        int32_t CompileStruct(const UStruct* Struct)
+        {
+            if (auto It = StructPlans.find(Struct); It != StructPlans.end())
+                return It->second;
+
+            // Registered before compiling, so arrays of the struct inside itself refer back to it.
+            const int32_t Index = AddPlan();
+            StructPlans.emplace(Struct, Index);
+
+            // Compiled while an array op of the outer plan is being added, its skips are its own.
+            const bool OuterSkipped = std::exchange(SkippedSinceCopy, false);
+
+            FPlan Plan;
+            Plan.Size = Struct->PropertiesSize;
+            Plan.Alignment = std::max(static_cast<int32_t>(Struct->MinAlignment), 1);
+            AppendStruct(Plan, Struct, 0);
+
+            // Trailing padding too, arrays of the struct are then copied with one memcpy.
+            if (!Plan.Ops.empty() && !SkippedSinceCopy) {
+                FOp& Last = Plan.Ops.back();
+                if (Last.Type == EOpType::Copy && IsPadding(Last.Offset + Last.Size, Plan.Size, Plan.Alignment))
+                    Last.Size = Plan.Size - Last.Offset;
+            }
+
+            SkippedSinceCopy = OuterSkipped;
+            Serializer.m_Plans[Index] = std::move(Plan);
+            return Index;
+        }
+
+        // Element plan of an array's inner property, or -1 if the inner type isn't supported.
+        int32_t CompileElement(const FPropertyView& Inner, const std::string& OwnerName)
+        {
+            if (Inner.HasTypeFlag(CASTCLASS_FStructProperty) && !(Inner.Flags & CPF_IsPlainOldData)) {
+                const UStruct* Struct = Inner.GetMember<const UStruct>(Offsets::UStructProperty::Struct);
+                if (!Struct) {
+                    Skip(OwnerName, Inner);
+                    return -1;
+                }
+
+                return CompileStruct(Struct);
+            }
+
+            FPlan Plan;
+            Plan.Size = Inner.ElementSize;
+            // Largest power of two dividing the size, the engine doesn't align elements any further.
+            Plan.Alignment = std::clamp(Inner.ElementSize & -Inner.ElementSize, 1, 16);
+
+            const bool OuterSkipped = std::exchange(SkippedSinceCopy, false);
+            AppendProperty(Plan, Inner, -Inner.Offset, OwnerName);
+            SkippedSinceCopy = OuterSkipped;
+
+            if (Plan.Ops.empty())
+                return -1;
+
+            const int32_t Index = AddPlan();
+            Serializer.m_Plans[Index] = std::move(Plan);
+            return Index;
+        }
+
+        void AppendStruct(FPlan& Plan, const UStruct* Struct, int32_t BaseOffset)
+        {
+            std::vector<FPropertyView> All;
+            for (const UStruct* Current = Struct; Current; Current = Current->SuperStruct)
+                Properties::ForEachProperty(Current, [&](const FPropertyView& Property) { All.push_back(Property); });
+
+            // Bit-fields share an offset, a stable sort keeps them in declaration order.
+            std::stable_sort(All.begin(), All.end(), [](const FPropertyView& A, const FPropertyView& B) { return A.Offset < B.Offset; });
+
+            const std::string OwnerName = Struct->GetName();
+            for (const FPropertyView& Property : All)
+                AppendProperty(Plan, Property, BaseOffset, OwnerName);
+        }
+
+        void AppendProperty(FPlan& Plan, const FPropertyView& Property, int32_t BaseOffset, const std::string& OwnerName)
+        {
+            const int32_t Offset = BaseOffset + Property.Offset;
+            const int32_t Count = std::max(Property.ArrayDim, 1);
+
+            if (Property.HasTypeFlag(CASTCLASS_FBoolProperty) && Property.ByteMask) {
+                Plan.Ops.push_back({ .Type = EOpType::Bool, .ByteMask = Property.ByteMask, .Offset = Offset, .Size = 1 });
+            }
+            else if (Property.HasTypeFlag(CASTCLASS_FNameProperty)) {
+                Plan.Ops.push_back({ .Type = EOpType::Name, .Offset = Offset, .Size = Property.ElementSize, .Count = Count });
+            }
+            else if (Property.HasTypeFlag(CASTCLASS_FStrProperty)) {
+                Plan.Ops.push_back({ .Type = EOpType::String, .Offset = Offset, .Size = Property.ElementSize, .Count = Count });
+            }
+            else if (Property.HasTypeFlag(CASTCLASS_FArrayProperty)) {
+                const void* Inner = Property.GetMember<const void>(Offsets::UArrayProperty::Inner);
+                if (!Inner) {
+                    Skip(OwnerName, Property);
+                    return;
+                }
+
+                const FPropertyView InnerView = Properties::MakeView(Inner);
+                const int32_t ElementPlan = CompileElement(InnerView, OwnerName);
+                if (ElementPlan < 0) {
+                    SkippedSinceCopy = true;
+                    return;
+                }
+
+                Plan.Ops.push_back({ .Type = EOpType::Array, .Offset = Offset, .Size = InnerView.ElementSize, .Count = Count, .Plan = ElementPlan });
+            }
+            else if (Property.HasTypeFlag(CASTCLASS_FStructProperty)) {
+                if (Property.Flags & CPF_IsPlainOldData) {
+                    AddCopy(Plan, Offset, Property.ElementSize * Count);
+                    return;
+                }
+
+                const UStruct* Struct = Property.GetMember<const UStruct>(Offsets::UStructProperty::Struct);
+                if (!Struct) {
+                    Skip(OwnerName, Property);
+                    return;
+                }
+
+                // Flattened, so its trivially copyable members merge with the surrounding ones.
+                for (int32_t i = 0; i < Count; i++)
+                    AppendStruct(Plan, Struct, Offset + i * Property.ElementSize);
+            }
+            else if (!(Property.CastFlags & kUnsupportedTypes) && ((Property.CastFlags & kCopiedTypes) || (Property.Flags & CPF_IsPlainOldData))) {
+                AddCopy(Plan, Offset, Property.ElementSize * Count);
+            }
+            else {
+                Skip(OwnerName, Property);
+            }
+        }
+    };
+
+    static uint32_t HashPlans(const std::vector<FPlan>& Plans)
+    {
+        uint32_t Hash = 2166136261u;
+        auto Mix = [&Hash](int64_t Value) {
+            for (int i = 0; i < 8; i++) {
+                Hash ^= static_cast<uint8_t>(Value >> (i * 8));
+                Hash *= 16777619u;
+            }
+        };
+
+        Mix(kStructSerializerVersion);
+        for (const FPlan& Plan : Plans) {
+            Mix(Plan.Size);
+            Mix(static_cast<int64_t>(Plan.Ops.size()));
+            for (const FOp& Op : Plan.Ops) {
+                Mix(static_cast<int64_t>(Op.Type) | (static_cast<int64_t>(Op.ByteMask) << 8));
+                Mix(Op.Offset);
+                Mix(Op.Size);
+                Mix(Op.Count);
+                Mix(Op.Plan);
+            }
+        }
+
+        return Hash;
+    }
+
+    FStructSerializer::FStructSerializer(const UStruct* Struct)
+    {
+        if (!State::Setup)
+            throw std::logic_error("FStructSerializer: SDK isn't initialized");
+        if (!Struct)
+            throw std::invalid_argument("Invalid UStruct!");
+
+        FPlanCompiler Compiler { *this };
+        Compiler.CompileStruct(Struct);
+
+        m_LayoutHash = HashPlans(m_Plans);
+    }
+
+    // Serializing
+
+    // Grows Out geometrically and writes behind a cursor, resizing per write would zero every byte before copying it.
+    class FStreamWriter
+    {
+    public:
+        explicit FStreamWriter(std::vector<uint8_t>& Out)
+            : m_Out(Out)
+            , m_Position(Out.size())
+        {
+        }
+
+        // Drops the unwritten tail, also when serializing threw part way.
+        ~FStreamWriter()
+        {
+            m_Out.resize(m_Position);
+        }
+
+        FStreamWriter(const FStreamWriter&) = delete;
+        FStreamWriter& operator=(const FStreamWriter&) = delete;
+
+        inline void Write(const void* Data, size_t Size)
+        {
+            if (m_Out.size() - m_Position < Size) [[unlikely]]
+                m_Out.resize(std::max({ m_Position + Size, m_Out.capacity(), m_Out.size() * 2 }));
+
+            if (Size)
+                std::memcpy(m_Out.data() + m_Position, Data, Size);
+            m_Position += Size;
+        }
+
+        template <typename T>
+        inline void Put(T Value)
+        {
+            Write(&Value, sizeof(T));
+        }
+
+    private:
+        std::vector<uint8_t>& m_Out;
+        size_t m_Position;
+    };
+
+    static void WriteElement(const std::vector<FPlan>& Plans, int32_t PlanIndex, const uint8_t* Base, FStreamWriter& Writer)
+    {
+        for (const FOp& Op : Plans[PlanIndex].Ops) {
+            const uint8_t* Address = Base + Op.Offset;
+
+            switch (Op.Type) {
+            case EOpType::Copy:
+                Writer.Write(Address, Op.Size);
+                break;
+
+            case EOpType::Bool:
+                Writer.Put<uint8_t>((*Address & Op.ByteMask) ? 1 : 0);
+                break;
+
+            case EOpType::Name:
+                for (int32_t i = 0; i < Op.Count; i++) {
+                    const std::string Name = reinterpret_cast<const FName*>(Address + i * Op.Size)->ToString();
+                    Writer.Put<uint32_t>(static_cast<uint32_t>(Name.size()));
+                    Writer.Write(Name.data(), Name.size());
+                }
+                break;
+
+            case EOpType::String:
+                for (int32_t i = 0; i < Op.Count; i++) {
+                    const FRawArray& String = *reinterpret_cast<const FRawArray*>(Address + i * Op.Size);
+                    const int32_t Num = String.Data ? String.Num : 0;
+                    Writer.Put<int32_t>(Num);
+                    Writer.Write(String.Data, Num * sizeof(wchar_t));
+                }
+                break;
+
+            case EOpType::Array:
+                for (int32_t i = 0; i < Op.Count; i++) {
+                    const FRawArray& Array = *reinterpret_cast<const FRawArray*>(Address + i * sizeof(FRawArray));
+                    const int32_t Num = Array.Data ? Array.Num : 0;
+                    Writer.Put<int32_t>(Num);
+
+                    if (Plans[Op.Plan].IsTrivial()) {
+                        Writer.Write(Array.Data, static_cast<size_t>(Num) * Op.Size);
+                        continue;
+                    }
+
+                    for (int32_t j = 0; j < Num; j++)
+                        WriteElement(Plans, Op.Plan, Array.Data + static_cast<size_t>(j) * Op.Size, Writer);
+                }
+                break;
+            }
+        }
+    }
+
+    void FStructSerializer::SerializeMany(const void* Instances, int32_t Count, std::vector<uint8_t>& Out) const
+    {
+        if (Count < 0)
+            throw std::invalid_argument("Negative instance count!");
+
+        Out.reserve(Out.size() + sizeof(FStreamHeader) + static_cast<size_t>(Count) * GetSize());
+
+        FStreamWriter Writer(Out);
+        Writer.Put(FStreamHeader { kStreamMagic, kStructSerializerVersion, 0, m_LayoutHash, Count });
+
+        const uint8_t* Base = static_cast<const uint8_t*>(Instances);
+        if (m_Plans[0].IsTrivial()) {
+            Writer.Write(Base, static_cast<size_t>(Count) * GetSize());
+            return;
+        }
+
+        for (int32_t i = 0; i < Count; i++)
+            WriteElement(m_Plans, 0, Base + static_cast<size_t>(i) * GetSize(), Writer);
+    }
+
+    // Deserializing
+
+    class FStreamReader
+    {
+    public:
+        explicit FStreamReader(std::span<const uint8_t> In)
+            : m_Begin(In.data())
+            , m_Current(In.data())
+            , m_End(In.data() + In.size())
+        {
+        }
+
+        inline const uint8_t* Take(size_t Size)
+        {
+            if (Remaining() < Size)
+                throw std::runtime_error("Truncated struct stream!");
+
+            const uint8_t* Result = m_Current;
+            m_Current += Size;
+            return Result;
+        }
+
+        inline void Read(void* Dest, size_t Size)
+        {
+            const uint8_t* Source = Take(Size);
+            if (Size)
+                std::memcpy(Dest, Source, Size);
+        }
+
+        template <typename T>
+        inline T Get()
+        {
+            T Value;
+            Read(&Value, sizeof(T));
+            return Value;
+        }
+
+        inline size_t Remaining() const { return static_cast<size_t>(m_End - m_Current); }
+        inline size_t Consumed() const { return static_cast<size_t>(m_Current - m_Begin); }
+
+    private:
+        const uint8_t* m_Begin;
+        const uint8_t* m_Current;
+        const uint8_t* m_End;
+    };
+
+    // Frees the FStrings and TArrays owned by an element that's being removed from an array.
+    static void DestroyElement(const std::vector<FPlan>& Plans, int32_t PlanIndex, uint8_t* Base)
+    {
+        for (const FOp& Op : Plans[PlanIndex].Ops) {
+            if (Op.Type != EOpType::String && Op.Type != EOpType::Array)
+                continue;
+
+            for (int32_t i = 0; i < Op.Count; i++) {
+                FRawArray& Array = *reinterpret_cast<FRawArray*>(Base + Op.Offset + i * sizeof(FRawArray));
+                if (!Array.Data)
+                    continue;
+
+                if (Op.Type == EOpType::Array && !Plans[Op.Plan].IsTrivial()) {
+                    for (int32_t j = 0; j < Array.Num; j++)
+                        DestroyElement(Plans, Op.Plan, Array.Data + static_cast<size_t>(j) * Op.Size);
+                }
+
+                FMemory::Free(Array.Data, FMemory::EAllocSite::StructDeserializeFree);
+                Array = {};
+            }
+        }
+    }
+
+    // Resizes an array in place. Removed elements are destroyed, added ones zeroed, which is a valid empty FName, FString and TArray.
+    static void ResizeArray(const std::vector<FPlan>& Plans, int32_t PlanIndex, FRawArray& Array, int32_t Num, size_t ElementSize, uint32_t Alignment)
+    {
+        const int32_t OldNum = Array.Data ? Array.Num : 0;
+
+        if (PlanIndex >= 0 && !Plans[PlanIndex].IsTrivial()) {
+            for (int32_t i = Num; i < OldNum; i++)
+                DestroyElement(Plans, PlanIndex, Array.Data + i * ElementSize);
+        }
+
+        if (Num > Array.Max || (!Array.Data && Num > 0)) {
+            const uint64_t Bytes = static_cast<uint64_t>(Num) * ElementSize;
+            if (Bytes > INT32_MAX)
+                throw std::runtime_error("Struct stream array is too large!");
+
+            Array.Data = static_cast<uint8_t*>(FMemory::Realloc(Array.Data, static_cast<uint32_t>(Bytes), Alignment, FMemory::EAllocSite::StructDeserialize));
+            Array.Max = Num;
+        }
+
+        if (Num > OldNum)
+            std::memset(Array.Data + OldNum * ElementSize, 0, (Num - OldNum) * ElementSize);
+
+        Array.Num = Num;
+    }
+
+    static int32_t ReadCount(FStreamReader& Reader, size_t MinElementBytes)
+    {
+        const int32_t Num = Reader.Get<int32_t>();
+
+        // Every element takes at least one byte, so this also rejects huge counts before anything is allocated.
+        if (Num < 0 || static_cast<uint64_t>(Num) * MinElementBytes > Reader.Remaining())
+            throw std::runtime_error("Invalid element count in struct stream!");
+
+        return Num;
+    }
+
+    static void ReadElement(const std::vector<FPlan>& Plans, int32_t PlanIndex, uint8_t* Base, FStreamReader& Reader)
+    {
+        for (const FOp& Op : Plans[PlanIndex].Ops) {
+            uint8_t* Address = Base + Op.Offset;
+
+            switch (Op.Type) {
+            case EOpType::Copy:
+                Reader.Read(Address, Op.Size);
+                break;
+
+            case EOpType::Bool:
+                if (Reader.Get<uint8_t>())
+                    *Address |= Op.ByteMask;
+                else
+                    *Address &= ~Op.ByteMask;
+                break;
+
+            case EOpType::Name:
+                for (int32_t i = 0; i < Op.Count; i++) {
+                    const uint32_t Length = Reader.Get<uint32_t>();
+                    const std::string Name(reinterpret_cast<const char*>(Reader.Take(Length)), Length);
+                    *reinterpret_cast<FName*>(Address + i * Op.Size) = FName(Name);
+                }
+                break;
+
+            case EOpType::String:
+                for (int32_t i = 0; i < Op.Count; i++) {
+                    FRawArray& String = *reinterpret_cast<FRawArray*>(Address + i * Op.Size);
+                    const int32_t Num = ReadCount(Reader, sizeof(wchar_t));
+
+                    ResizeArray(Plans, -1, String, Num, sizeof(wchar_t), alignof(wchar_t));
+                    Reader.Read(String.Data, Num * sizeof(wchar_t));
+
+                    if (Num > 0 && reinterpret_cast<wchar_t*>(String.Data)[Num - 1] != L'\0')
+                        throw std::runtime_error("Unterminated FString in struct stream!");
+                }
+                break;
+
+            case EOpType::Array:
+                for (int32_t i = 0; i < Op.Count; i++) {
+                    FRawArray& Array = *reinterpret_cast<FRawArray*>(Address + i * sizeof(FRawArray));
+                    const FPlan& Element = Plans[Op.Plan];
+                    const bool Trivial = Element.IsTrivial();
+                    const int32_t Num = ReadCount(Reader, Trivial ? Op.Size : 1);
+
+                    ResizeArray(Plans, Op.Plan, Array, Num, Op.Size, Element.Alignment);
+
+                    if (Trivial) {
+                        Reader.Read(Array.Data, static_cast<size_t>(Num) * Op.Size);
+                        continue;
+                    }
+
+                    for (int32_t j = 0; j < Num; j++)
+                        ReadElement(Plans, Op.Plan, Array.Data + static_cast<size_t>(j) * Op.Size, Reader);
+                }
+                break;
+            }
+        }
+    }
+
+    size_t FStructSerializer::DeserializeMany(void* Instances, int32_t Count, std::span<const uint8_t> In) const
+    {
+        FStreamReader Reader(In);
+
+        const FStreamHeader Header = Reader.Get<FStreamHeader>();
+        if (Header.Magic != kStreamMagic)
+            throw std::runtime_error("Not a struct stream!");
+        if (Header.Version != kStructSerializerVersion)
+            throw std::runtime_error("Unsupported struct stream version " + std::to_string(Header.Version));
+        if (Header.LayoutHash != m_LayoutHash)
+            throw std::runtime_error("Struct stream was written for a different struct layout!");
+        if (Header.Count != Count)
+            throw std::runtime_error("Struct stream holds " + std::to_string(Header.Count) + " instances, expected " + std::to_string(Count));
+
+        uint8_t* Base = static_cast<uint8_t*>(Instances);
+        if (m_Plans[0].IsTrivial()) {
+            Reader.Read(Base, static_cast<size_t>(Count) * GetSize());
+            return Reader.Consumed();
+        }
+
+        for (int32_t i = 0; i < Count; i++)
+            ReadElement(m_Plans, 0, Base + static_cast<size_t>(i) * GetSize(), Reader);
+
+        return Reader.Consumed();
+    }
+}
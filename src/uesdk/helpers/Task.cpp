@@ -0,0 +1,72 @@
+#include <uesdk/helpers/Task.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <new>
+
+namespace SDK::FCoroutineFramePool
+{
+    // Size classes 128, 256, ..., 4096. Bigger frames go straight to operator new.
+    static constexpr size_t kMinClassShift = 7;
+    static constexpr size_t kNumClasses = 6;
+    static constexpr size_t kMaxCachedPerClass = 64;
+
+    struct FFreeFrame
+    {
+        FFreeFrame* Next;
+    };
+
+    struct FThreadFramePool
+    {
+        FFreeFrame* Free[kNumClasses] = {};
+        size_t NumFree[kNumClasses] = {};
+
+        ~FThreadFramePool()
+        {
+            for (FFreeFrame* Head : Free) {
+                while (Head) {
+                    FFreeFrame* Next = Head->Next;
+                    ::operator delete(Head);
+                    Head = Next;
+                }
+            }
+        }
+    };
+
+    thread_local static FThreadFramePool g_Pool;
+
+    static inline size_t GetClassIndex(size_t Size)
+    {
+        const size_t Rounded = std::bit_ceil(std::max<size_t>(Size, size_t(1) << kMinClassShift));
+        return std::countr_zero(Rounded) - kMinClassShift;
+    }
+
+    void* Allocate(size_t Size)
+    {
+        const size_t Index = GetClassIndex(Size);
+        if (Index >= kNumClasses)
+            return ::operator new(Size);
+
+        if (FFreeFrame* Frame = g_Pool.Free[Index]) {
+            g_Pool.Free[Index] = Frame->Next;
+            g_Pool.NumFree[Index]--;
+            return Frame;
+        }
+
+        return ::operator new(size_t(1) << (Index + kMinClassShift));
+    }
+
+    void Free(void* Frame, size_t Size) noexcept
+    {
+        const size_t Index = GetClassIndex(Size);
+        if (Index >= kNumClasses || g_Pool.NumFree[Index] >= kMaxCachedPerClass) {
+            ::operator delete(Frame);
+            return;
+        }
+
+        FFreeFrame* Node = static_cast<FFreeFrame*>(Frame);
+        Node->Next = g_Pool.Free[Index];
+        g_Pool.Free[Index] = Node;
+        g_Pool.NumFree[Index]++;
+    }
+}
@@ -1,99 +1,158 @@
 #include <uesdk/helpers/TlsArgBuffer.hpp>
 
-#include <cstdalign>
-#include <stdexcept>
+#include <atomic>
+#include <cstring>
+#include <new>
 
 namespace SDK
 {
-    TlsArgBuffer::TlsArgBuffer(size_t RequiredSize)
+    struct FArenaChunk
     {
-        if (RequiredSize <= kBufferSize && g_BufferIndex < kMaxDepth) {
-            AllocAsTLS(RequiredSize);
-            return;
-        }
+        FArenaChunk* Next;
+        size_t Size;
+        size_t Used;
+    };
 
-        if (RequiredSize <= kMaxStackAllocSize) {
-            AllocAsStack(RequiredSize);
-            return;
-        }
+    // Chunk data starts on a 64 byte boundary, which covers any buffer alignment.
+    static constexpr size_t kChunkAlignment = 64;
+    static constexpr size_t kChunkHeaderSize = (sizeof(FArenaChunk) + kChunkAlignment - 1) & ~(kChunkAlignment - 1);
 
-        AllocAsHeap(RequiredSize);
+    static std::atomic<size_t> g_InitialChunkSize = 16 * 1024;
+    static std::atomic<double> g_GrowthFactor = 2.0;
+
+    static inline uint8_t* GetChunkData(FArenaChunk* Chunk)
+    {
+        return reinterpret_cast<uint8_t*>(Chunk) + kChunkHeaderSize;
     }
 
-    TlsArgBuffer::~TlsArgBuffer()
+    class FThreadArgArena
     {
-        if (!m_Valid)
-            return;
+    public:
+        ~FThreadArgArena()
+        {
+            FreeChunks(m_First);
+        }
 
-        switch (m_Type) {
-        case TLSBufAllocType::TLS:
-            g_BufferIndex--;
-            break;
+    public:
+        FArenaChunk* GetCurrent() const { return m_Current; }
+
+        uint8_t* Allocate(size_t Size, size_t Alignment)
+        {
+            const size_t Needed = (Size + Alignment - 1) & ~(Alignment - 1);
+
+            if (!m_Current) {
+                // Nothing is in use, start over from the first chunk.
+                if (!m_First || m_First->Size < Needed) {
+                    // Allocated before freeing, so a failed allocation leaves the arena as it was.
+                    FArenaChunk* First = NewChunk(std::max(g_InitialChunkSize.load(std::memory_order_relaxed), Needed));
+                    FreeChunks(m_First);
+                    m_First = First;
+                }
+
+                m_First->Used = 0;
+                m_Current = m_First;
+            }
+            else if (m_Current->Used + Needed > m_Current->Size) {
+                // Chunks after the current one hold nothing, releases are LIFO. Reuse the next one if it fits, otherwise replace it.
+                FArenaChunk* Next = m_Current->Next;
+                if (!Next || Next->Size < Needed) {
+                    const double Growth = std::max(g_GrowthFactor.load(std::memory_order_relaxed), 1.0);
+                    FArenaChunk* Grown = NewChunk(std::max(static_cast<size_t>(static_cast<double>(m_Current->Size) * Growth), Needed));
+
+                    FreeChunks(Next);
+                    m_Current->Next = Next = Grown;
+                }
+
+                Next->Used = 0;
+                m_Current = Next;
+            }
+
+            uint8_t* Result = GetChunkData(m_Current) + m_Current->Used;
+            m_Current->Used += Needed;
+
+            m_Stats.BytesInUse += Needed;
+            m_Stats.HighWaterBytes = std::max(m_Stats.HighWaterBytes, m_Stats.BytesInUse);
+            return Result;
+        }
 
-        case TLSBufAllocType::Stack:
-            _freea(m_Raw);
-            break;
+        void Release(FArenaChunk* PrevChunk, size_t PrevUsed, size_t Size, size_t Alignment)
+        {
+            m_Stats.BytesInUse -= (Size + Alignment - 1) & ~(Alignment - 1);
 
-        case TLSBufAllocType::Heap:
-            delete[] m_Raw;
-            break;
+            m_Current = PrevChunk;
+            if (m_Current)
+                m_Current->Used = PrevUsed;
         }
-    }
 
-    uint8_t* TlsArgBuffer::GetData()
-    {
-        return m_Data;
-    }
+        const FArgArenaStats& GetStats() const { return m_Stats; }
 
-    void TlsArgBuffer::AllocAsTLS(size_t RequiredSize)
-    {
-        m_Type = TLSBufAllocType::TLS;
-        m_Raw = g_BufferStack[g_BufferIndex];
+    private:
+        FArenaChunk* NewChunk(size_t DataSize)
+        {
+            void* Memory = ::operator new(kChunkHeaderSize + DataSize, std::align_val_t(kChunkAlignment));
 
-        size_t TotalSize = RequiredSize + kAlignment;
+            FArenaChunk* Chunk = static_cast<FArenaChunk*>(Memory);
+            Chunk->Next = nullptr;
+            Chunk->Size = DataSize;
+            Chunk->Used = 0;
 
-        void* Aligned = m_Raw;
-        if (!std::align(kAlignment, RequiredSize, Aligned, TotalSize))
-            throw std::bad_alloc();
+            m_Stats.ReservedBytes += DataSize;
+            m_Stats.NumChunks++;
+            m_Stats.NumChunkAllocations++;
+            return Chunk;
+        }
 
-        m_Data = static_cast<uint8_t*>(Aligned);
-        m_Size = RequiredSize;
+        void FreeChunks(FArenaChunk* Chunk)
+        {
+            while (Chunk) {
+                FArenaChunk* Next = Chunk->Next;
 
-        std::memset(m_Data, 0, m_Size);
-        m_Valid = true;
+                m_Stats.ReservedBytes -= Chunk->Size;
+                m_Stats.NumChunks--;
+                ::operator delete(Chunk, std::align_val_t(kChunkAlignment));
 
-        // Delay incrementing to avoid incrementing on failure
-        g_BufferIndex++;
-    }
+                Chunk = Next;
+            }
+        }
 
-    void TlsArgBuffer::AllocAsStack(size_t RequiredSize)
-    {
-        m_Type = TLSBufAllocType::Stack;
+    private:
+        FArenaChunk* m_First = nullptr;
+        FArenaChunk* m_Current = nullptr;
+        FArgArenaStats m_Stats;
+    };
 
-        size_t TotalSize = RequiredSize + kAlignment;
-        m_Raw = static_cast<uint8_t*>(_malloca(TotalSize));
-        if (!m_Raw)
-            throw std::bad_alloc();
+    thread_local static FThreadArgArena g_ArgArena;
 
-        void* Aligned = m_Raw;
-        if (!std::align(kAlignment, RequiredSize, Aligned, TotalSize))
-            throw std::bad_alloc();
+    TlsArgBuffer::TlsArgBuffer(size_t RequiredSize, bool ZeroFill)
+    {
+        m_PrevChunk = g_ArgArena.GetCurrent();
+        m_PrevUsed = m_PrevChunk ? m_PrevChunk->Used : 0;
 
-        m_Data = static_cast<uint8_t*>(Aligned);
+        m_Data = g_ArgArena.Allocate(RequiredSize, kAlignment);
         m_Size = RequiredSize;
 
-        std::memset(m_Data, 0, m_Size);
-        m_Valid = true;
+        if (ZeroFill)
+            std::memset(m_Data, 0, m_Size);
     }
 
-    void TlsArgBuffer::AllocAsHeap(size_t RequiredSize)
+    TlsArgBuffer::~TlsArgBuffer()
     {
-        m_Type = TLSBufAllocType::Heap;
-        m_Data = new uint8_t[RequiredSize];
-        m_Raw = m_Data;
-        m_Size = RequiredSize;
+        g_ArgArena.Release(m_PrevChunk, m_PrevUsed, m_Size, kAlignment);
+    }
 
-        std::memset(m_Data, 0, m_Size);
-        m_Valid = true;
+    uint8_t* TlsArgBuffer::GetData()
+    {
+        return m_Data;
+    }
+
+    void TlsArgBuffer::SetChunkGrowth(size_t InitialChunkSize, double GrowthFactor)
+    {
+        g_InitialChunkSize.store(std::max<size_t>(InitialChunkSize, kAlignment), std::memory_order_relaxed);
+        g_GrowthFactor.store(std::max(GrowthFactor, 1.0), std::memory_order_relaxed);
+    }
+
+    FArgArenaStats TlsArgBuffer::GetThreadStats()
+    {
+        return g_ArgArena.GetStats();
     }
 }
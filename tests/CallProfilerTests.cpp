@@ -0,0 +1,68 @@
+#include <Check.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/helpers/CallProfiler.hpp>
+#include <uesdk/helpers/PECallWrapper.hpp>
+
+#include <string>
+
+using namespace SDK;
+
+static UFunction* g_Inner = nullptr;
+
+// The outer function calls the inner one straight through ProcessEvent, like a hooked engine function would.
+static void OuterProcessEvent(UObject* Object, UFunction* Function, void* Parms)
+{
+    if (Function != g_Inner)
+        Object->ProcessEvent(g_Inner, nullptr);
+}
+
+static const Profiler::FFunctionProfile* FindProfile(const std::vector<Profiler::FFunctionProfile>& Profiles, UFunction* Function)
+{
+    for (const Profiler::FFunctionProfile& Profile : Profiles) {
+        if (Profile.Function == Function)
+            return &Profile;
+    }
+    return nullptr;
+}
+
+// Direct ProcessEvent calls are recorded, and the wrapper's own call isn't recorded twice.
+// The names are read when exporting, so the functions are checked in the same scope.
+static void TestProcessEventCalls()
+{
+    Fake::FFakeFunction Outer(0);
+    Fake::FFakeFunction Inner(0);
+    Outer.Get()->Class = Inner.Get()->Class = Fake::GetMetaClass("Function");
+    Outer.Get()->Name = FName("Outer");
+    Inner.Get()->Name = FName("Say \"hi\", \\ok");
+    g_Inner = Inner.Get();
+
+    Fake::FFakeObject Object(OuterProcessEvent);
+
+    static PECallWrapper<"Fake", "Outer", void()> CallOuter;
+    CallOuter.Call(Object.Get(), Outer.Get());
+    Object.Get()->ProcessEvent(Outer.Get(), nullptr);
+
+    const std::vector<Profiler::FFunctionProfile> Profiles = Profiler::Collect();
+    const Profiler::FFunctionProfile* OuterProfile = FindProfile(Profiles, Outer.Get());
+    const Profiler::FFunctionProfile* InnerProfile = FindProfile(Profiles, Inner.Get());
+    UESDK_CHECK(OuterProfile && OuterProfile->Calls == 2);
+    UESDK_CHECK(InnerProfile && InnerProfile->Calls == 2);
+
+    // Names with quotes, commas and backslashes stay one field in the CSV and one string in the trace.
+    const std::string CSV = Profiler::ExportCSV();
+    UESDK_CHECK(CSV.find("\"Function Say \"\"hi\"\", \\ok\",2,") != std::string::npos);
+
+    const std::string Trace = Profiler::ExportChromeTrace();
+    UESDK_CHECK(Trace.find("{\"name\":\"Say \\\"hi\\\", \\\\ok\",") != std::string::npos);
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+    Fake::SetupNames();
+
+    UESDK_CHECK(Profiler::IsEnabled());
+    TestProcessEventCalls();
+    return 0;
+}
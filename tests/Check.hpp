@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+
+/* @brief Fails the test with the condition and its location if Condition is false. */
+#define UESDK_CHECK(Condition)                                                                \
+    do {                                                                                      \
+        if (!(Condition)) {                                                                   \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition); \
+            std::exit(1);                                                                     \
+        }                                                                                     \
+    } while (false)
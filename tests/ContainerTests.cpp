@@ -0,0 +1,88 @@
+#include <Check.hpp>
+
+#include <uesdk/core/UnrealContainers.hpp>
+
+#include <cstdint>
+
+using namespace SDK;
+
+struct alignas(64) FAligned
+{
+    uint8_t Bytes[64];
+};
+
+static void TestHostRealloc()
+{
+    void* Memory = FMemory::Malloc(100, 64);
+    UESDK_CHECK(reinterpret_cast<uintptr_t>(Memory) % 64 == 0);
+
+    std::memset(Memory, 0xAB, 100);
+    Memory = FMemory::Realloc(Memory, 5000, 64);
+    UESDK_CHECK(reinterpret_cast<uintptr_t>(Memory) % 64 == 0);
+    UESDK_CHECK(static_cast<uint8_t*>(Memory)[99] == 0xAB);
+
+    UESDK_CHECK(FMemory::Realloc(Memory, 0, 64) == nullptr);
+}
+
+static void TestArrayGrowth()
+{
+    TArray<int32_t> Array;
+    for (int32_t i = 0; i < 10000; i++)
+        Array.Add(i);
+
+    UESDK_CHECK(Array.Num() == 10000);
+    UESDK_CHECK(Array.Max() >= Array.Num());
+
+    int64_t Sum = 0;
+    for (int32_t Value : Array)
+        Sum += Value;
+    UESDK_CHECK(Sum == 9999ll * 10000 / 2);
+
+    TArray<FAligned> Aligned;
+    for (int32_t i = 0; i < 100; i++) {
+        Aligned.Add({});
+        UESDK_CHECK(reinterpret_cast<uintptr_t>(Aligned.GetData()) % alignof(FAligned) == 0);
+    }
+}
+
+static void TestArrayCopy()
+{
+    TArray<int32_t> Source;
+    Source.Reserve(100);
+    for (int32_t i = 0; i < 100; i++)
+        Source.Add(i * 3);
+
+    TArray<int32_t> Copy = Source;
+    UESDK_CHECK(Copy.Num() == Source.Num());
+    UESDK_CHECK(Copy.GetData() != Source.GetData());
+    for (int32_t i = 0; i < Copy.Num(); i++)
+        UESDK_CHECK(Copy[i] == i * 3);
+
+    TArray<int32_t> Moved = std::move(Copy);
+    UESDK_CHECK(Moved.Num() == 100 && Copy.Num() == 0 && !Copy.GetData());
+
+    Moved.Remove(0);
+    UESDK_CHECK(Moved.Num() == 99 && Moved[0] == 3);
+}
+
+static void TestString()
+{
+    const FString String(L"Hello World");
+    UESDK_CHECK(String.ToString() == "Hello World");
+    UESDK_CHECK(String.Num() == 12);
+
+    FString Copy = String;
+    UESDK_CHECK(Copy == String);
+    UESDK_CHECK(Copy.CStr() != String.CStr());
+}
+
+int main()
+{
+    FMemory::SetBackend(FMemory::HostRealloc);
+
+    TestHostRealloc();
+    TestArrayGrowth();
+    TestArrayCopy();
+    TestString();
+    return 0;
+}
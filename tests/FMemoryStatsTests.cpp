@@ -0,0 +1,77 @@
+#include <Check.hpp>
+
+#include <uesdk/core/FMemory.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace SDK;
+
+static const FMemory::FAllocSiteStats& GetSite(const std::vector<FMemory::FAllocSiteStats>& Stats, FMemory::EAllocSite Site)
+{
+    return Stats[static_cast<size_t>(Site)];
+}
+
+// A chain started on one thread and freed on another is still attributed to the site that started it.
+static void TestChainAcrossThreads()
+{
+    FMemory::ResetStats();
+
+    void* Memory = FMemory::Malloc(16, 8, FMemory::EAllocSite::TArrayConstruct);
+    for (uint32_t Size : { 64u, 256u, 1024u })
+        Memory = FMemory::Realloc(Memory, Size, 8, FMemory::EAllocSite::TArrayReserve);
+
+    std::thread([Memory]() { FMemory::Free(Memory, FMemory::EAllocSite::TArrayFree); }).join();
+
+    const std::vector<FMemory::FAllocSiteStats> Stats = FMemory::GetStats();
+    const FMemory::FAllocSiteStats& Construct = GetSite(Stats, FMemory::EAllocSite::TArrayConstruct);
+
+    UESDK_CHECK(Construct.Mallocs == 1);
+    UESDK_CHECK(Construct.MaxChainLength == 3);
+    // Bucket 3 holds chains of 3 and 4 reallocs.
+    UESDK_CHECK(Construct.ChainLengths[3] == 1);
+    UESDK_CHECK(GetSite(Stats, FMemory::EAllocSite::TArrayReserve).Reallocs == 3);
+    UESDK_CHECK(GetSite(Stats, FMemory::EAllocSite::TArrayFree).Frees == 1);
+}
+
+// Threads allocating at the same time, the per-thread counters add up in GetStats.
+static void TestConcurrentThreads()
+{
+    static constexpr int32_t kNumThreads = 8;
+    static constexpr int32_t kNumAllocations = 20000;
+
+    FMemory::ResetStats();
+
+    std::vector<std::thread> Threads;
+    for (int32_t i = 0; i < kNumThreads; i++) {
+        Threads.emplace_back([]() {
+            for (int32_t j = 0; j < kNumAllocations; j++) {
+                void* Memory = FMemory::Malloc(32, 8, FMemory::EAllocSite::TArrayConstruct);
+                Memory = FMemory::Realloc(Memory, 128, 8, FMemory::EAllocSite::TArrayReserve);
+                FMemory::Free(Memory, FMemory::EAllocSite::TArrayFree);
+            }
+        });
+    }
+
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    const std::vector<FMemory::FAllocSiteStats> Stats = FMemory::GetStats();
+    const FMemory::FAllocSiteStats& Construct = GetSite(Stats, FMemory::EAllocSite::TArrayConstruct);
+
+    UESDK_CHECK(Construct.Mallocs == kNumThreads * kNumAllocations);
+    UESDK_CHECK(Construct.ChainLengths[1] == kNumThreads * kNumAllocations);
+    UESDK_CHECK(Construct.MaxChainLength == 1);
+    UESDK_CHECK(GetSite(Stats, FMemory::EAllocSite::TArrayReserve).Reallocs == kNumThreads * kNumAllocations);
+    UESDK_CHECK(GetSite(Stats, FMemory::EAllocSite::TArrayFree).Frees == kNumThreads * kNumAllocations);
+}
+
+int main()
+{
+    FMemory::SetBackend(FMemory::HostRealloc);
+    UESDK_CHECK(FMemory::AreStatsEnabled());
+
+    TestChainAcrossThreads();
+    TestConcurrentThreads();
+    return 0;
+}
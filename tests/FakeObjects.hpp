@@ -0,0 +1,315 @@
+#pragma once
+#include <uesdk/Offsets.hpp>
+#include <uesdk/State.hpp>
+#include <uesdk/core/FMemory.hpp>
+#include <uesdk/core/ObjectArray.hpp>
+#include <uesdk/core/UnrealObjects.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Synthetic UObjects for the tests and benchmarks that exercise the object model without a game.
+// Members are written through the same offset accessors the library reads them with.
+
+namespace Fake
+{
+    // Every fake object and property is at least this big, the offsets below fit inside it.
+    static constexpr size_t kObjectSize = 0x100;
+
+    /** @brief Sets a FProperty based member layout for the fake objects, with ProcessEvent in VFT slot 0. */
+    inline void SetupOffsets()
+    {
+        SDK::State::UsesFProperty = true;
+
+        SDK::Offsets::UObject::ProcessEventIdx = 0;
+        SDK::Offsets::UField::Next = 0x28;
+        SDK::Offsets::UStruct::SuperStruct = 0x40;
+        SDK::Offsets::UStruct::Children = 0x48;
+        SDK::Offsets::UStruct::ChildProperties = 0x50;
+        SDK::Offsets::UStruct::PropertiesSize = 0x58;
+        SDK::Offsets::UStruct::MinAlignment = 0x5C;
+        SDK::Offsets::UFunction::FunctionFlags = 0xB0;
+        SDK::Offsets::UFunction::NumParms = 0xB4;
+        SDK::Offsets::UFunction::ParmsSize = 0xB6;
+        SDK::Offsets::UFunction::ReturnValueOffset = 0xB8;
+        SDK::Offsets::UFunction::Func = 0xC0;
+        SDK::Offsets::UClass::ClassCastFlags = 0xD0;
+        SDK::Offsets::UClass::ClassDefaultObject = 0xD8;
+
+        // Right after FProperty, where the engine keeps them.
+        SDK::Offsets::UStructProperty::Struct = sizeof(SDK::FProperty);
+        SDK::Offsets::UArrayProperty::Inner = sizeof(SDK::FProperty);
+        SDK::Offsets::UEnumProperty::UnderlyingProp = sizeof(SDK::FProperty);
+    }
+
+    // Stand-ins for the engine's FName functions, a name is its index in one table.
+    struct FNameTable
+    {
+        std::vector<std::string> Names = { "None" };
+        std::unordered_map<std::string, uint32_t> Indices = { { "None", 0 } };
+    };
+
+    inline FNameTable& GetNameTable()
+    {
+        static FNameTable Table;
+        return Table;
+    }
+
+    inline void ConstructName(const SDK::FName* Name, const char* String, bool)
+    {
+        FNameTable& Table = GetNameTable();
+
+        auto [It, Inserted] = Table.Indices.try_emplace(String, static_cast<uint32_t>(Table.Names.size()));
+        if (Inserted)
+            Table.Names.push_back(String);
+
+        const_cast<SDK::FName*>(Name)->ComparisonIndex = It->second;
+    }
+
+    inline void ConstructNameWide(const SDK::FName* Name, const wchar_t* String, bool)
+    {
+        const std::wstring Wide = String;
+        ConstructName(Name, std::string(Wide.begin(), Wide.end()).c_str(), true);
+    }
+
+    inline void AppendName(const SDK::FName* Name, SDK::FString* Out)
+    {
+        const std::string& String = GetNameTable().Names.at(Name->ComparisonIndex);
+        *Out = SDK::FString(std::wstring(String.begin(), String.end()).c_str());
+    }
+
+    /** @brief Routes FName through the fake name table and FMemory through the host allocator. */
+    inline void SetupNames()
+    {
+        SDK::FMemory::SetBackend(SDK::FMemory::HostRealloc);
+
+        SDK::Offsets::FName::ConstructorNarrow = reinterpret_cast<uintptr_t>(&ConstructName);
+        SDK::Offsets::FName::ConstructorWide = reinterpret_cast<uintptr_t>(&ConstructNameWide);
+        SDK::Offsets::FName::AppendString = reinterpret_cast<uintptr_t>(&AppendName);
+
+        SDK::State::SetupFMemory = true;
+        SDK::State::SetupAppendString = true;
+        SDK::State::SetupFNameConstructorNarrow = true;
+        SDK::State::SetupFNameConstructorWide = true;
+    }
+
+    /** @brief Zeroed memory for one fake object of type T. */
+    template <typename T>
+    class TFakeObject
+    {
+    public:
+        TFakeObject()
+            : m_Memory(std::max(sizeof(T), kObjectSize) / sizeof(uint64_t) + 1)
+        {
+        }
+
+    public:
+        T* Get() { return reinterpret_cast<T*>(m_Memory.data()); }
+        T* operator->() { return Get(); }
+
+    private:
+        std::vector<uint64_t> m_Memory;
+    };
+
+    /** @brief The class of fake UClasses, or with another Name and CastFlags, e.g. "ScriptStruct", the class of other fake UStructs. */
+    inline SDK::UClass* GetMetaClass(const char* Name = "Class", uint64_t CastFlags = SDK::CASTCLASS_UField | SDK::CASTCLASS_UStruct | SDK::CASTCLASS_UClass)
+    {
+        static std::deque<std::pair<std::string, TFakeObject<SDK::UClass>>> MetaClasses;
+
+        for (auto& [MetaName, MetaClass] : MetaClasses) {
+            if (MetaName == Name)
+                return MetaClass.Get();
+        }
+
+        TFakeObject<SDK::UClass>& MetaClass = MetaClasses.emplace_back(Name, TFakeObject<SDK::UClass>()).second;
+        MetaClass->Class = GetMetaClass();
+        MetaClass->Name = SDK::FName(Name);
+        MetaClass->ClassCastFlags = static_cast<SDK::EClassCastFlags>(CastFlags);
+        return MetaClass.Get();
+    }
+
+    /** @brief Writes a member the SDK reads at an offset, e.g. SetMember(Property, Offsets::UStructProperty::Struct, Struct). */
+    template <typename T>
+    inline void SetMember(void* Object, int32_t Offset, T Value)
+    {
+        *reinterpret_cast<T*>(static_cast<uint8_t*>(Object) + Offset) = Value;
+    }
+
+    /** @brief A UStruct with FProperty members, in the order they are added. */
+    template <typename T>
+    class TFakeStruct
+    {
+    public:
+        /**
+         * @brief Adds a property, named if Name isn't nullptr. Bool properties are native bools unless their FieldMask is changed.
+         * @brief Properties are zeroed kObjectSize blocks, so type specific members like FStructProperty::Struct can be written at their offset.
+         */
+        SDK::FProperty& AddProperty(const char* Name, int32_t Offset, int32_t Size, uint64_t Flags, uint64_t CastFlags)
+        {
+            SDK::FProperty& Property = MakeProperty(Offset, Size, Flags, CastFlags);
+
+            if (Name)
+                Property.Name = SDK::FName(Name);
+
+            if (!m_LastProperty)
+                m_Struct->ChildProperties = &Property;
+            else
+                m_LastProperty->Next = &Property;
+
+            m_LastProperty = &Property;
+            return Property;
+        }
+
+        /** @brief Creates a property that lives as long as the struct but isn't one of its members, e.g. the Inner of an array property. */
+        SDK::FProperty& MakeProperty(int32_t Offset, int32_t Size, uint64_t Flags, uint64_t CastFlags)
+        {
+            SDK::FFieldClass& Class = m_Classes.emplace_back();
+            Class.CastFlags = CastFlags | SDK::CASTCLASS_FProperty;
+
+            SDK::FProperty& Property = *m_Properties.emplace_back().Get();
+            Property.ClassPrivate = &Class;
+            Property.ArrayDim = 1;
+            Property.ElementSize = Size;
+            Property.PropertyFlags = Flags;
+            Property.Offset = Offset;
+
+            if (CastFlags & SDK::CASTCLASS_FBoolProperty)
+                static_cast<SDK::FBoolProperty&>(Property).FieldMask = 0xFF;
+
+            return Property;
+        }
+
+        T* Get() { return m_Struct.Get(); }
+
+    protected:
+        TFakeObject<T> m_Struct;
+        std::deque<TFakeObject<SDK::FProperty>> m_Properties;
+        std::deque<SDK::FFieldClass> m_Classes;
+        SDK::FProperty* m_LastProperty = nullptr;
+    };
+
+    /** @brief A UFunction with FProperty parameters, in the order they are added. */
+    class FFakeFunction : public TFakeStruct<SDK::UFunction>
+    {
+    public:
+        explicit FFakeFunction(uint16_t ParmsSize)
+        {
+            m_Struct->ParmsSize = ParmsSize;
+            m_Struct->ReturnValueOffset = UINT16_MAX;
+        }
+
+    public:
+        /** @brief Adds a parameter, CPF_Parm is always set. The return value needs CPF_ReturnParm in Flags. */
+        SDK::FProperty& AddParam(int32_t Offset, int32_t Size, uint64_t Flags, uint64_t CastFlags)
+        {
+            if (Flags & SDK::CPF_ReturnParm)
+                m_Struct->ReturnValueOffset = static_cast<uint16_t>(Offset);
+
+            return AddProperty(nullptr, Offset, Size, Flags | SDK::CPF_Parm, CastFlags);
+        }
+    };
+
+    /** @brief A named UClass with FProperty members. With another MetaClass, see GetMetaClass, any other named UStruct. */
+    class FFakeClass : public TFakeStruct<SDK::UClass>
+    {
+    public:
+        explicit FFakeClass(const char* Name, SDK::UStruct* Super = nullptr, SDK::UClass* MetaClass = GetMetaClass())
+        {
+            m_Struct->Class = MetaClass;
+            m_Struct->Name = SDK::FName(Name);
+            m_Struct->SuperStruct = Super;
+        }
+    };
+
+    /** @brief A UObject whose ProcessEvent is ProcessEvent. */
+    class FFakeObject
+    {
+    public:
+        using ProcessEvent_t = void (*)(SDK::UObject* Object, SDK::UFunction* Function, void* Parms);
+
+        explicit FFakeObject(ProcessEvent_t ProcessEvent = nullptr)
+            : m_VFT { reinterpret_cast<void*>(ProcessEvent) }
+        {
+            m_Object->VFT = m_VFT;
+        }
+
+        FFakeObject(const FFakeObject&) = delete;
+        FFakeObject& operator=(const FFakeObject&) = delete;
+
+    public:
+        SDK::UObject* Get() { return m_Object.Get(); }
+
+    private:
+        void* m_VFT[1];
+        TFakeObject<SDK::UObject> m_Object;
+    };
+
+    /** @brief A fixed GObjects of fake objects, installed as SDK::GObjects while alive. */
+    class FFakeObjectArray
+    {
+    private:
+        // Same layout as Fixed_TUObjectArray.
+        struct FFixedArray
+        {
+            SDK::FUObjectItem* Objects;
+            int32_t MaxElements;
+            int32_t NumElements;
+        };
+
+    public:
+        explicit FFakeObjectArray(int32_t Capacity)
+            : m_Items(Capacity + 1) // Fixed_TUObjectArray::GetByIndex also reads the item at Num.
+            , m_Array { m_Items.data(), Capacity, 0 }
+        {
+            SDK::GObjects = std::make_unique<SDK::TUObjectArray>(false, &m_Array);
+            SDK::State::UsesChunkedGObjects = false;
+            SDK::State::SetupGObjects = true;
+        }
+
+        ~FFakeObjectArray()
+        {
+            SDK::GObjects.reset();
+            SDK::State::SetupGObjects = false;
+        }
+
+        FFakeObjectArray(const FFakeObjectArray&) = delete;
+        FFakeObjectArray& operator=(const FFakeObjectArray&) = delete;
+
+    public:
+        /** @brief Adds Object and sets its Index. */
+        int32_t Add(SDK::UObject* Object)
+        {
+            if (m_Array.NumElements == m_Array.MaxElements)
+                throw std::length_error("FFakeObjectArray is full");
+
+            const int32_t Index = m_Array.NumElements++;
+            m_Items[Index] = { Object, 0, -1, m_Items[Index].SerialNumber + 1 };
+            Object->Index = Index;
+            return Index;
+        }
+
+        /** @brief Puts Object in the slot at Index under the next serial number, like a new object allocated where a collected one was. */
+        void Replace(int32_t Index, SDK::UObject* Object)
+        {
+            SDK::FUObjectItem& Item = m_Items.at(Index);
+            Item = { Object, 0, -1, Item.SerialNumber + 1 };
+            Object->Index = Index;
+        }
+
+        /** @brief Empties the slot at Index like garbage collection would. */
+        void Remove(int32_t Index)
+        {
+            m_Items.at(Index).Object = nullptr;
+        }
+
+    private:
+        std::vector<SDK::FUObjectItem> m_Items;
+        FFixedArray m_Array;
+    };
+}
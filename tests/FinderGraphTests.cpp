@@ -0,0 +1,236 @@
+#include <Check.hpp>
+
+#include <private/FinderGraph.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SDK;
+using namespace SDK::OffsetFinder;
+
+static FFinderNode MakeNode(const char* Name, std::vector<std::string> Inputs, std::vector<std::string> Outputs, std::function<ESDKStatus()> Run)
+{
+    return { Name, std::move(Inputs), std::move(Outputs), std::move(Run), {} };
+}
+
+static void Sleep(int32_t Ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(Ms));
+}
+
+// Waits up to a second for Flag, so a missing overlap fails the check instead of hanging.
+static bool WaitFor(const std::atomic<bool>& Flag)
+{
+    for (int32_t i = 0; i < 1000 && !Flag.load(); i++)
+        Sleep(1);
+    return Flag.load();
+}
+
+// A -> B, C -> D. B and C only depend on A, so they overlap, and D waits for both.
+static void TestDiamond(uint32_t NumThreads)
+{
+    std::mutex Mutex;
+    std::vector<std::string> Order;
+    auto Record = [&](const char* Name) {
+        std::lock_guard Lock(Mutex);
+        Order.push_back(Name);
+    };
+
+    std::atomic<bool> BStarted = false;
+    std::atomic<bool> CStarted = false;
+    std::atomic<bool> Overlapped = false;
+
+    FFinderGraph Graph;
+    Graph.Add(MakeNode("A", {}, { "A" }, [&]() {
+        Record("A");
+        return ESDKStatus::Success;
+    }));
+    Graph.Add(MakeNode("B", { "A" }, { "B" }, [&]() {
+        BStarted = true;
+        if (NumThreads > 1)
+            Overlapped = WaitFor(CStarted);
+        Sleep(20);
+        Record("B");
+        return ESDKStatus::Success;
+    }));
+    Graph.Add(MakeNode("C", { "A" }, { "C" }, [&]() {
+        CStarted = true;
+        if (NumThreads > 1)
+            WaitFor(BStarted);
+        Record("C");
+        return ESDKStatus::Success;
+    }));
+    Graph.Add(MakeNode("D", { "B", "C" }, { "D" }, [&]() {
+        Record("D");
+        return ESDKStatus::Success;
+    }));
+
+    size_t LastProgress = 0;
+    FSetupReport Report;
+    UESDK_CHECK(Graph.Run(NumThreads, Report, [&](size_t Finished, size_t Total) {
+        std::lock_guard Lock(Mutex);
+        LastProgress = std::max(LastProgress, Finished);
+        UESDK_CHECK(Total == 4);
+    }) == ESDKStatus::Success);
+
+    UESDK_CHECK(Order.size() == 4);
+    UESDK_CHECK(Order.front() == "A");
+    UESDK_CHECK(Order.back() == "D");
+    UESDK_CHECK(LastProgress == 4);
+
+    if (NumThreads == 1)
+        UESDK_CHECK(Order[1] == "B" && Order[2] == "C");
+    else
+        UESDK_CHECK(Overlapped);
+
+    UESDK_CHECK(Report.Threads == NumThreads);
+    UESDK_CHECK(Report.Steps.size() == 4);
+    UESDK_CHECK(Report.Steps[3].Inputs == std::vector<std::string>({ "B", "C" }));
+    for (const FSetupStep& Step : Report.Steps)
+        UESDK_CHECK(Step.Ran && Step.Status == ESDKStatus::Success);
+
+    // B takes the longest, so it's on the critical path rather than C.
+    UESDK_CHECK(Report.CriticalPath == std::vector<size_t>({ 0, 1, 3 }));
+    UESDK_CHECK(Report.CriticalPathMs >= Report.Steps[1].DurationMs);
+}
+
+// The result is the status of the first failed node in the order they were added, whichever failed first in time.
+static void TestFailureOrder()
+{
+    std::atomic<bool> FastRan = false;
+    std::atomic<bool> LaterRan = false;
+    std::atomic<bool> DependentRan = false;
+
+    FFinderGraph Graph;
+    Graph.Add(MakeNode("Slow", {}, { "Slow" }, [&]() {
+        WaitFor(FastRan);
+        Sleep(20);
+        return ESDKStatus::Failed_UField_Next;
+    }));
+    Graph.Add(MakeNode("Fast", {}, { "Fast" }, [&]() {
+        FastRan = true;
+        return ESDKStatus::Failed_UStruct_Children;
+    }));
+    Graph.Add(MakeNode("Later", {}, { "Later" }, [&]() {
+        LaterRan = true;
+        return ESDKStatus::Success;
+    }));
+    Graph.Add(MakeNode("Dependent", { "Fast" }, { "Dependent" }, [&]() {
+        DependentRan = true;
+        return ESDKStatus::Success;
+    }));
+
+    FSetupReport Report;
+    UESDK_CHECK(Graph.Run(2, Report) == ESDKStatus::Failed_UField_Next);
+
+    UESDK_CHECK(Report.Steps[0].Ran && Report.Steps[0].Status == ESDKStatus::Failed_UField_Next);
+    UESDK_CHECK(Report.Steps[1].Ran && Report.Steps[1].Status == ESDKStatus::Failed_UStruct_Children);
+
+    // Nodes added after a failed one aren't started, and neither are consumers of a failed node.
+    UESDK_CHECK(!LaterRan && !Report.Steps[2].Ran);
+    UESDK_CHECK(!DependentRan && !Report.Steps[3].Ran);
+}
+
+// A node whose condition is false is skipped, its consumers still run.
+static void TestCondition()
+{
+    std::atomic<bool> SkippedRan = false;
+    std::atomic<bool> ConsumerRan = false;
+
+    FFinderGraph Graph;
+    FFinderNode Skipped = MakeNode("Skipped", {}, { "Skipped" }, [&]() {
+        SkippedRan = true;
+        return ESDKStatus::Failed_UField_Next;
+    });
+    Skipped.Condition = []() { return false; };
+    Graph.Add(std::move(Skipped));
+    Graph.Add(MakeNode("Consumer", { "Skipped" }, { "Consumer" }, [&]() {
+        ConsumerRan = true;
+        return ESDKStatus::Success;
+    }));
+
+    FSetupReport Report;
+    UESDK_CHECK(Graph.Run(2, Report) == ESDKStatus::Success);
+    UESDK_CHECK(!SkippedRan && !Report.Steps[0].Ran);
+    UESDK_CHECK(ConsumerRan && Report.Steps[1].Ran);
+    UESDK_CHECK(Report.CriticalPath == std::vector<size_t>({ 1 }));
+}
+
+// An exception is rethrown once the running nodes finished, without starting later ones.
+static void TestException()
+{
+    std::atomic<bool> OtherStarted = false;
+    std::atomic<bool> OtherFinished = false;
+    std::atomic<bool> LaterRan = false;
+
+    FFinderGraph Graph;
+    Graph.Add(MakeNode("Throws", {}, { "Throws" }, [&]() -> ESDKStatus {
+        WaitFor(OtherStarted);
+        throw std::runtime_error("finder failed");
+    }));
+    Graph.Add(MakeNode("Other", {}, { "Other" }, [&]() {
+        OtherStarted = true;
+        Sleep(20);
+        OtherFinished = true;
+        return ESDKStatus::Success;
+    }));
+    Graph.Add(MakeNode("Later", { "Throws" }, { "Later" }, [&]() {
+        LaterRan = true;
+        return ESDKStatus::Success;
+    }));
+
+    FSetupReport Report;
+    bool Threw = false;
+    try {
+        Graph.Run(2, Report);
+    }
+    catch (const std::runtime_error&) {
+        Threw = true;
+    }
+
+    UESDK_CHECK(Threw);
+    UESDK_CHECK(OtherFinished);
+    UESDK_CHECK(!LaterRan);
+}
+
+static void TestInvalidGraph()
+{
+    FFinderGraph Graph;
+    Graph.Add(MakeNode("A", {}, { "A" }, []() { return ESDKStatus::Success; }));
+
+    bool Threw = false;
+    try {
+        Graph.Add(MakeNode("Unknown", { "Missing" }, {}, []() { return ESDKStatus::Success; }));
+    }
+    catch (const std::logic_error&) {
+        Threw = true;
+    }
+    UESDK_CHECK(Threw);
+
+    Threw = false;
+    try {
+        Graph.Add(MakeNode("Duplicate", {}, { "A" }, []() { return ESDKStatus::Success; }));
+    }
+    catch (const std::logic_error&) {
+        Threw = true;
+    }
+    UESDK_CHECK(Threw);
+}
+
+int main()
+{
+    TestDiamond(1);
+    TestDiamond(4);
+    TestFailureOrder();
+    TestCondition();
+    TestException();
+    TestInvalidGraph();
+    return 0;
+}
@@ -0,0 +1,255 @@
+#include <Check.hpp>
+
+#include <uesdk/Init.hpp>
+#include <uesdk/State.hpp>
+#include <private/OffsetFinder.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace SDK;
+
+// Stands in for one OffsetFinder function, counting its calls. A gated finder blocks until released, so tests can act while it runs.
+struct FStubFinder
+{
+    std::atomic<int32_t> Calls = 0;
+    std::atomic<bool> Succeeds = true;
+    std::atomic<bool> Throws = false;
+    std::atomic<bool> Gated = false;
+    std::atomic<bool> Entered = false;
+    std::atomic<bool> Released = false;
+    std::atomic<std::thread::id> Thread;
+
+    bool Run()
+    {
+        Calls++;
+        Thread = std::this_thread::get_id();
+        Entered = true;
+
+        while (Gated && !Released)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        if (Throws)
+            throw std::runtime_error("finder failed");
+
+        return Succeeds;
+    }
+
+    void Gate()
+    {
+        Gated = true;
+        Entered = false;
+        Released = false;
+    }
+
+    void Release()
+    {
+        Released = true;
+        Gated = false;
+    }
+};
+
+static FStubFinder s_FMemory;
+static FStubFinder s_GObjects;
+static FStubFinder s_FNameNarrow;
+static FStubFinder s_FNameWide;
+static FStubFinder s_AppendString;
+static FStubFinder s_MemberOffsets;
+static FStubFinder s_ProcessEvent;
+
+static constexpr size_t kNumSteps = 4;
+
+namespace SDK::OffsetFinder
+{
+    bool FindFMemoryRealloc() { return s_FMemory.Run(); }
+    bool FindGObjects() { return s_GObjects.Run(); }
+    bool FindFNameConstructorNarrow() { return s_FNameNarrow.Run(); }
+    bool FindFNameConstructorWide() { return s_FNameWide.Run(); }
+    bool FindAppendString() { return s_AppendString.Run(); }
+    bool FindProcessEventIdx() { return s_ProcessEvent.Run(); }
+
+    // A failing run gets halfway through the steps.
+    ESDKStatus SetupMemberOffsets(const std::function<void(size_t, size_t)>& OnProgress)
+    {
+        const bool Succeeds = s_MemberOffsets.Run();
+
+        for (size_t i = 1; i <= (Succeeds ? kNumSteps : kNumSteps / 2); i++)
+            OnProgress(i, kNumSteps);
+        return Succeeds ? ESDKStatus::Success : ESDKStatus::Failed_UField_Next;
+    }
+}
+
+// Waits up to a second for Flag, so a finder that never starts fails the check instead of hanging.
+static bool WaitFor(const std::atomic<bool>& Flag)
+{
+    for (int32_t i = 0; i < 1000 && !Flag.load(); i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return Flag.load();
+}
+
+// A throwing finder leaves its component to be tried again.
+static void TestException()
+{
+    s_FMemory.Throws = true;
+
+    bool Threw = false;
+    try {
+        EnsureInitialized(ESDKComponent::FMemory);
+    }
+    catch (const std::runtime_error&) {
+        Threw = true;
+    }
+
+    UESDK_CHECK(Threw);
+    UESDK_CHECK(GetInitProgress().ComponentsDone == 0);
+    s_FMemory.Throws = false;
+}
+
+// A failed requirement fails the component without running it, and is tried again by the next call.
+static void TestFailedRequirement()
+{
+    s_FMemory.Succeeds = false;
+    const int32_t Calls = s_FMemory.Calls;
+
+    UESDK_CHECK(EnsureInitialized(ESDKComponent::FName) == ESDKStatus::Failed_FMemoryRealloc);
+    UESDK_CHECK(s_FNameNarrow.Calls == 0);
+    UESDK_CHECK(Init() == ESDKStatus::Failed_FMemoryRealloc);
+    UESDK_CHECK(s_FMemory.Calls == Calls + 2);
+    UESDK_CHECK(s_GObjects.Calls == 0);
+
+    s_FMemory.Succeeds = true;
+}
+
+// Without continuing in the background, only the demanded component is set up, and only once.
+static void TestLazy()
+{
+    const int32_t Calls = s_FMemory.Calls;
+
+    UESDK_CHECK(EnsureInitialized(ESDKComponent::FMemory, false) == ESDKStatus::Success);
+    UESDK_CHECK(EnsureInitialized(ESDKComponent::FMemory, false) == ESDKStatus::Success);
+    UESDK_CHECK(s_FMemory.Calls == Calls + 1);
+    UESDK_CHECK(s_GObjects.Calls == 0);
+
+    const FInitProgress Progress = GetInitProgress();
+    UESDK_CHECK(Progress.ComponentsDone == 1 && Progress.Components == static_cast<uint32_t>(ESDKComponent::Count));
+    UESDK_CHECK(!State::Setup);
+}
+
+// A thread demanding a component another thread is setting up waits for it, and gets its failure instead of scanning again.
+static void TestWaitersShareFailure()
+{
+    s_GObjects.Succeeds = false;
+    s_GObjects.Gate();
+
+    ESDKStatus First = ESDKStatus::Success;
+    ESDKStatus Second = ESDKStatus::Success;
+
+    std::thread Running([&]() { First = EnsureInitialized(ESDKComponent::GObjects); });
+    UESDK_CHECK(WaitFor(s_GObjects.Entered));
+
+    std::thread Waiting([&]() { Second = EnsureInitialized(ESDKComponent::GObjects); });
+    // Nothing to wait on from outside, give the second thread time to block on the first one.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    s_GObjects.Release();
+    Running.join();
+    Waiting.join();
+
+    UESDK_CHECK(First == ESDKStatus::Failed_GObjects);
+    UESDK_CHECK(Second == ESDKStatus::Failed_GObjects);
+    UESDK_CHECK(s_GObjects.Calls == 1);
+}
+
+// A component that is set up starts the rest on the background thread of InitAsync, and doesn't wait for it.
+static void TestContinueInBackground()
+{
+    s_GObjects.Gate();
+
+    UESDK_CHECK(EnsureInitialized(ESDKComponent::FMemory) == ESDKStatus::Success);
+    UESDK_CHECK(WaitFor(s_GObjects.Entered));
+    UESDK_CHECK(s_GObjects.Thread.load() != std::this_thread::get_id());
+
+    // GObjects still fails, so the background run stops there and the next InitAsync starts over.
+    s_GObjects.Release();
+    UESDK_CHECK(InitAsync().get() == ESDKStatus::Failed_GObjects);
+    UESDK_CHECK(s_FNameNarrow.Calls == 0);
+}
+
+static void TestInitAsync()
+{
+    // A run that failed is started over by the next call.
+    std::shared_future<ESDKStatus> Failed = InitAsync();
+    UESDK_CHECK(Failed.get() == ESDKStatus::Failed_GObjects);
+    UESDK_CHECK(s_FNameNarrow.Calls == 0);
+
+    s_GObjects.Succeeds = true;
+    s_GObjects.Gate();
+    s_MemberOffsets.Succeeds = false;
+
+    std::shared_future<ESDKStatus> Running = InitAsync();
+    UESDK_CHECK(WaitFor(s_GObjects.Entered));
+    UESDK_CHECK(Running.wait_for(std::chrono::seconds(0)) == std::future_status::timeout);
+    UESDK_CHECK(s_GObjects.Thread.load() != std::this_thread::get_id());
+
+    // FName doesn't need GObjects, so it's set up here while the background thread is still busy with GObjects.
+    UESDK_CHECK(EnsureInitialized(ESDKComponent::FName) == ESDKStatus::Success);
+    UESDK_CHECK(s_FNameNarrow.Thread.load() == std::this_thread::get_id());
+    UESDK_CHECK(Running.wait_for(std::chrono::seconds(0)) == std::future_status::timeout);
+
+    s_GObjects.Release();
+    UESDK_CHECK(Running.get() == ESDKStatus::Failed_UField_Next);
+    UESDK_CHECK(GetInitProgress().StepsDone == kNumSteps / 2);
+
+    // The retry starts the member offset steps over.
+    s_MemberOffsets.Succeeds = true;
+    s_MemberOffsets.Gate();
+    Running = InitAsync();
+    UESDK_CHECK(WaitFor(s_MemberOffsets.Entered));
+    UESDK_CHECK(GetInitProgress().StepsDone == 0 && GetInitProgress().Steps == 0);
+
+    s_MemberOffsets.Release();
+    UESDK_CHECK(Running.get() == ESDKStatus::Success);
+
+    // The background thread didn't set FName up a second time.
+    UESDK_CHECK(s_FNameNarrow.Calls == 1 && s_FNameWide.Calls == 1 && s_AppendString.Calls == 1);
+    UESDK_CHECK(s_MemberOffsets.Calls == 2 && s_ProcessEvent.Calls == 1);
+    UESDK_CHECK(State::Setup);
+
+    const FInitProgress Progress = GetInitProgress();
+    UESDK_CHECK(Progress.ComponentsDone == Progress.Components);
+    UESDK_CHECK(Progress.StepsDone == kNumSteps && Progress.Steps == kNumSteps);
+}
+
+static void TestAfterSetup()
+{
+    const int32_t Calls = s_GObjects.Calls;
+
+    UESDK_CHECK(InitAsync().get() == ESDKStatus::Success);
+    UESDK_CHECK(Init() == ESDKStatus::Failed_AlreadySetup);
+    UESDK_CHECK(EnsureInitialized(ESDKComponent::ProcessEvent) == ESDKStatus::Success);
+    UESDK_CHECK(s_GObjects.Calls == Calls && s_ProcessEvent.Calls == 1);
+
+    bool Threw = false;
+    try {
+        EnsureInitialized(ESDKComponent::Count);
+    }
+    catch (const std::invalid_argument&) {
+        Threw = true;
+    }
+    UESDK_CHECK(Threw);
+}
+
+// The SDK's setup state is global, so the tests run in this order on one process.
+int main()
+{
+    TestException();
+    TestFailedRequirement();
+    TestLazy();
+    TestWaitersShareFailure();
+    TestContinueInBackground();
+    TestInitAsync();
+    TestAfterSetup();
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <Check.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/State.hpp>
+#include <uesdk/helpers/ObjectDumper.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace SDK;
+
+static constexpr int32_t kSignedOffset = 0x30;
+static constexpr int32_t kUnsignedOffset = 0x31;
+static constexpr int32_t kUnknownOffset = 0x32;
+
+static std::string ReadFile(const std::string& Path)
+{
+    std::ifstream File(Path, std::ios::binary);
+    std::stringstream Stream;
+    Stream << File.rdbuf();
+    return Stream.str();
+}
+
+// Enum values are written with the signedness of their underlying property, 0xFF is -1 for an int8 enum and 255 for a uint8 one.
+static void TestEnumSignedness()
+{
+    Fake::FFakeObjectArray ObjectArray(8);
+
+    Fake::FFakeClass Holder("EnumHolder");
+    FProperty& Signed = Holder.AddProperty("Signed", kSignedOffset, 1, CPF_IsPlainOldData, CASTCLASS_FEnumProperty);
+    Fake::SetMember(&Signed, Offsets::UEnumProperty::UnderlyingProp,
+                    &Holder.MakeProperty(0, 1, CPF_IsPlainOldData, CASTCLASS_FInt8Property | CASTCLASS_FNumericProperty));
+    FProperty& Unsigned = Holder.AddProperty("Unsigned", kUnsignedOffset, 1, CPF_IsPlainOldData, CASTCLASS_FEnumProperty);
+    Fake::SetMember(&Unsigned, Offsets::UEnumProperty::UnderlyingProp,
+                    &Holder.MakeProperty(0, 1, CPF_IsPlainOldData, CASTCLASS_FByteProperty | CASTCLASS_FNumericProperty));
+    // No underlying property, written as unsigned.
+    Holder.AddProperty("Unknown", kUnknownOffset, 1, CPF_IsPlainOldData, CASTCLASS_FEnumProperty);
+    ObjectArray.Add(Holder.Get());
+
+    Fake::FFakeObject Object;
+    Object.Get()->Class = Holder.Get();
+    for (int32_t Offset : { kSignedOffset, kUnsignedOffset, kUnknownOffset })
+        Fake::SetMember<uint8_t>(Object.Get(), Offset, 0xFF);
+    ObjectArray.Add(Object.Get());
+
+    const std::string Path = (std::filesystem::temp_directory_path() / "uesdk_dumper_tests.txt").string();
+    FDumpOptions Options;
+    Options.Filter = Holder.Get();
+    UESDK_CHECK(DumpObjects(Path, Options).Objects == 1);
+
+    const std::string Dump = ReadFile(Path);
+    std::filesystem::remove(Path);
+
+    UESDK_CHECK(Dump.find("\tSigned = -1\n") != std::string::npos);
+    UESDK_CHECK(Dump.find("\tUnsigned = 255\n") != std::string::npos);
+    UESDK_CHECK(Dump.find("\tUnknown = 255\n") != std::string::npos);
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+    Fake::SetupNames();
+    State::Setup = true;
+
+    TestEnumSignedness();
+    return 0;
+}
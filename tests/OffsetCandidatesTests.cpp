@@ -0,0 +1,157 @@
+#include <Check.hpp>
+
+#include <private/OffsetCandidates.hpp>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace SDK;
+using namespace SDK::Memory;
+
+// What FindOffsetCandidates computes, one memcmp per sample and offset.
+static std::vector<FOffsetCandidate> FindOffsetCandidatesScalar(const std::vector<FOffsetSample>& Samples, size_t ValueSize, int32_t Alignment, int32_t MinOffset, int32_t MaxOffset)
+{
+    std::vector<FOffsetCandidate> All;
+    std::vector<FOffsetCandidate> Partial;
+    const int32_t NumSamples = static_cast<int32_t>(Samples.size());
+    int32_t Best = 0;
+
+    for (int32_t Offset = MinOffset; Offset < MaxOffset; Offset += Alignment) {
+        int32_t Matches = 0;
+        for (const FOffsetSample& Sample : Samples) {
+            if (Sample.Object && std::memcmp(static_cast<const uint8_t*>(Sample.Object) + Offset, Sample.Value, ValueSize) == 0)
+                Matches++;
+        }
+
+        if (Matches == NumSamples)
+            All.push_back({ Offset, Matches, 0.0 });
+
+        if (Matches > Best) {
+            Best = Matches;
+            Partial.clear();
+        }
+        if (Matches && Matches == Best)
+            Partial.push_back({ Offset, Matches, 0.0 });
+    }
+
+    std::vector<FOffsetCandidate>& Candidates = All.empty() ? Partial : All;
+    for (FOffsetCandidate& Candidate : Candidates)
+        Candidate.Confidence = static_cast<double>(Candidate.Matches) / NumSamples / static_cast<double>(Candidates.size());
+
+    return Candidates;
+}
+
+static bool SameCandidates(const std::vector<FOffsetCandidate>& A, const std::vector<FOffsetCandidate>& B)
+{
+    if (A.size() != B.size())
+        return false;
+
+    for (size_t i = 0; i < A.size(); i++) {
+        if (A[i].Offset != B[i].Offset || A[i].Matches != B[i].Matches || A[i].Confidence != B[i].Confidence)
+            return false;
+    }
+    return true;
+}
+
+// Random windows over a four letter alphabet, so values match at several offsets and samples often disagree.
+static void TestMatchesScalarReference()
+{
+    std::mt19937 Random(0x5EED);
+    auto Next = [&](int32_t Min, int32_t Max) { return std::uniform_int_distribution<int32_t>(Min, Max)(Random); };
+
+    static constexpr size_t kValueSizes[] = { 1, 2, 4, 8 };
+    static constexpr int32_t kAlignments[] = { 1, 2, 4, 8 };
+
+    for (int32_t Round = 0; Round < 20000; Round++) {
+        const size_t ValueSize = kValueSizes[Next(0, 3)];
+        const int32_t Alignment = kAlignments[Next(0, 3)];
+        const int32_t MinOffset = Next(0, 0x40);
+        const int32_t MaxOffset = MinOffset + Next(1, 0x200);
+        const int32_t NumSamples = Next(1, 8);
+
+        std::vector<std::vector<uint8_t>> Objects(NumSamples);
+        std::vector<std::vector<uint8_t>> Values(NumSamples);
+        std::vector<FOffsetSample> Samples;
+
+        for (int32_t i = 0; i < NumSamples; i++) {
+            // Big enough for a value at the last offset.
+            Objects[i].resize(MaxOffset + ValueSize);
+            for (uint8_t& Byte : Objects[i])
+                Byte = static_cast<uint8_t>(Next(0, 3));
+
+            Values[i].resize(ValueSize);
+            if (Next(0, 7) == 0) {
+                for (uint8_t& Byte : Values[i])
+                    Byte = static_cast<uint8_t>(Next(0, 255));
+            }
+            else {
+                const int32_t At = Next(MinOffset, MaxOffset - 1);
+                std::memcpy(Values[i].data(), Objects[i].data() + At, ValueSize);
+            }
+
+            const bool IsNull = Next(0, 31) == 0;
+            Samples.push_back({ IsNull ? nullptr : Objects[i].data(), Values[i].data() });
+        }
+
+        const std::vector<FOffsetCandidate> Expected = FindOffsetCandidatesScalar(Samples, ValueSize, Alignment, MinOffset, MaxOffset);
+        const std::vector<FOffsetCandidate> Actual = FindOffsetCandidates(Samples, ValueSize, Alignment, MinOffset, MaxOffset);
+        UESDK_CHECK(SameCandidates(Actual, Expected));
+    }
+}
+
+static void TestFindOffset()
+{
+    struct FObject
+    {
+        uint8_t Pad[0x48];
+        int32_t Value;
+        // Past the default window of FindOffset.
+        uint8_t Rest[0x160];
+    };
+
+    std::vector<FObject> Objects(4);
+    std::vector<std::pair<void*, int32_t>> Pairs;
+    for (int32_t i = 0; i < 4; i++) {
+        std::memset(&Objects[i], 0, sizeof(FObject));
+        Objects[i].Value = 1000 + i;
+        Pairs.push_back({ &Objects[i], 1000 + i });
+    }
+
+    UESDK_CHECK(FindOffset(Pairs) == 0x48);
+
+    // Recorded while a recorder is alive on this thread.
+    {
+        FOffsetCandidateRecorder Recorder;
+        FindOffset(Pairs);
+        UESDK_CHECK(Recorder.Candidates.size() == 1);
+        UESDK_CHECK(Recorder.Candidates[0].Offset == 0x48 && Recorder.Candidates[0].Confidence == 1.0);
+    }
+
+    // A sample matching nowhere fails the search, the others still show up as the best partial candidate.
+    Pairs.push_back({ &Objects[0], 12345 });
+    UESDK_CHECK(FindOffset(Pairs) == OFFSET_NOT_FOUND);
+
+    const std::vector<FOffsetCandidate> Candidates = FindOffsetCandidates(Pairs);
+    UESDK_CHECK(Candidates.size() == 1 && Candidates[0].Offset == 0x48 && Candidates[0].Matches == 4);
+}
+
+static void TestInvalidArguments()
+{
+    const uint8_t Object[16] = {};
+    const uint8_t Value = 0;
+    const FOffsetSample Sample = { Object, &Value };
+
+    UESDK_CHECK(FindOffsetCandidates({}, 1, 1, 0, 8).empty());
+    UESDK_CHECK(FindOffsetCandidates({ &Sample, 1 }, 0, 1, 0, 8).empty());
+    UESDK_CHECK(FindOffsetCandidates({ &Sample, 1 }, 1, 0, 0, 8).empty());
+    UESDK_CHECK(FindOffsetCandidates({ &Sample, 1 }, 1, 1, 8, 8).empty());
+}
+
+int main()
+{
+    TestMatchesScalarReference();
+    TestFindOffset();
+    TestInvalidArguments();
+    return 0;
+}
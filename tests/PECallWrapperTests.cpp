@@ -0,0 +1,95 @@
+#include <Check.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/helpers/PECallWrapper.hpp>
+
+#include <cstring>
+
+using namespace SDK;
+
+// Parameters struct of the fake UFunction: UObject* Target, int32 Value, UObject*& OutObject, bool ReturnValue.
+struct FRoundTripParms
+{
+    UObject* Target;
+    int32_t Value;
+    uint8_t Pad[4];
+    UObject* OutObject;
+    bool ReturnValue;
+};
+
+static FRoundTripParms g_Received = {};
+
+static void RoundTripProcessEvent(UObject*, UFunction*, void* Parms)
+{
+    std::memcpy(&g_Received, Parms, sizeof(FRoundTripParms));
+
+    FRoundTripParms* Params = static_cast<FRoundTripParms*>(Parms);
+    Params->OutObject = Params->Target;
+    Params->ReturnValue = Params->Target != nullptr;
+}
+
+static void TestObjectParamRoundTrip()
+{
+    Fake::FFakeFunction Function(sizeof(FRoundTripParms));
+    Function.AddParam(offsetof(FRoundTripParms, Target), sizeof(UObject*), CPF_IsPlainOldData, CASTCLASS_FObjectProperty);
+    Function.AddParam(offsetof(FRoundTripParms, Value), sizeof(int32_t), CPF_IsPlainOldData, CASTCLASS_FIntProperty);
+    Function.AddParam(offsetof(FRoundTripParms, OutObject), sizeof(UObject*), CPF_IsPlainOldData | CPF_OutParm, CASTCLASS_FObjectProperty);
+    Function.AddParam(offsetof(FRoundTripParms, ReturnValue), sizeof(bool), CPF_IsPlainOldData | CPF_ReturnParm, CASTCLASS_FBoolProperty);
+
+    Fake::FFakeObject Caller(RoundTripProcessEvent);
+    Fake::FFakeObject Target(RoundTripProcessEvent);
+
+    static PECallWrapper<"Fake", "RoundTrip", bool(UObject*, int32_t*, UObject**)> RoundTrip;
+
+    // The object parameter gets the pointer itself, the int parameter what its pointer points to.
+    int32_t Value = 42;
+    UObject* OutObject = nullptr;
+    UESDK_CHECK(RoundTrip.Call(Caller.Get(), Function.Get(), Target.Get(), &Value, &OutObject));
+    UESDK_CHECK(g_Received.Target == Target.Get());
+    UESDK_CHECK(g_Received.Value == 42);
+    UESDK_CHECK(OutObject == Target.Get());
+
+    // A null object is passed as null.
+    OutObject = Caller.Get();
+    UESDK_CHECK(!RoundTrip.Call(Caller.Get(), Function.Get(), static_cast<UObject*>(nullptr), &Value, &OutObject));
+    UESDK_CHECK(g_Received.Target == nullptr);
+    UESDK_CHECK(g_Received.OutObject == Caller.Get());
+    UESDK_CHECK(OutObject == nullptr);
+}
+
+static int32_t g_Slots[2] = {};
+
+static void RecordSlotsProcessEvent(UObject*, UFunction*, void* Parms)
+{
+    std::memcpy(g_Slots, Parms, sizeof(g_Slots));
+}
+
+// A UFunction collected and its address reused by another one gets a new plan, the old one would write to the old offsets.
+static void TestReusedFunctionAddress()
+{
+    Fake::FFakeObjectArray Objects(4);
+    Fake::FFakeFunction Function(sizeof(g_Slots));
+    FProperty& Param = Function.AddParam(0, sizeof(int32_t), CPF_IsPlainOldData, CASTCLASS_FIntProperty);
+    const int32_t Index = Objects.Add(Function.Get());
+
+    Fake::FFakeObject Caller(RecordSlotsProcessEvent);
+    static PECallWrapper<"Fake", "Reused", void(int32_t)> Reused;
+
+    Reused.Call(Caller.Get(), Function.Get(), 7);
+    UESDK_CHECK(g_Slots[0] == 7 && g_Slots[1] == 0);
+
+    Param.Offset = sizeof(int32_t);
+    Objects.Replace(Index, Function.Get());
+
+    Reused.Call(Caller.Get(), Function.Get(), 9);
+    UESDK_CHECK(g_Slots[0] == 0 && g_Slots[1] == 9);
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+
+    TestObjectParamRoundTrip();
+    TestReusedFunctionAddress();
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <Check.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/helpers/PropertyGather.hpp>
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace SDK;
+
+static PropertyInfo MakeInfo(FProperty& Property)
+{
+    PropertyInfo Info = {};
+    Info.Found = true;
+    Info.Offset = Property.Offset;
+    Info.ElementSize = Property.ElementSize;
+    Info.Flags = Property.PropertyFlags;
+    Info.FProp = &Property;
+    return Info;
+}
+
+// Object.Transform.Location.Z and Object.Transform.Flags, where Transform and Location are struct properties.
+// No object pointer is followed, so the values are at the summed offsets in the object itself.
+static void TestStructOnlyPath()
+{
+    static constexpr int32_t kTransformOffset = 0x20;
+    static constexpr int32_t kLocationOffset = 0x10;
+    static constexpr int32_t kZOffset = 0x8;
+    static constexpr int32_t kFlagsOffset = 0x1C;
+    static constexpr uint8_t kFlagMask = 0x4;
+
+    // Only owns the properties, gathering never looks at it.
+    Fake::TFakeStruct<UStruct> Owner;
+    FProperty& Transform = Owner.MakeProperty(kTransformOffset, 0x30, 0, CASTCLASS_FStructProperty);
+    FProperty& Location = Owner.MakeProperty(kLocationOffset, 0xC, 0, CASTCLASS_FStructProperty);
+    FProperty& Z = Owner.MakeProperty(kZOffset, sizeof(float), CPF_IsPlainOldData, CASTCLASS_FFloatProperty);
+    FProperty& Flags = Owner.MakeProperty(kFlagsOffset, 1, CPF_IsPlainOldData, CASTCLASS_FBoolProperty);
+
+    PropertyInfo FlagsInfo = MakeInfo(Flags);
+    FlagsInfo.ByteMask = kFlagMask;
+
+    std::vector<std::array<uint8_t, 0x80>> Storage(300);
+    std::vector<UObject*> Objects;
+    for (size_t i = 0; i < Storage.size(); i++) {
+        Storage[i].fill(0);
+
+        const float Value = static_cast<float>(i);
+        std::memcpy(Storage[i].data() + kTransformOffset + kLocationOffset + kZOffset, &Value, sizeof(Value));
+        Storage[i][kTransformOffset + kFlagsOffset] = i % 2 ? kFlagMask : 0;
+
+        // The value the old fallback read, Z's own offset in the object.
+        const float Wrong = -1.0f;
+        std::memcpy(Storage[i].data() + kZOffset, &Wrong, sizeof(Wrong));
+
+        Objects.push_back(reinterpret_cast<UObject*>(Storage[i].data()));
+    }
+    Objects[7] = nullptr;
+
+    const PropertyInfo ZPath[] = { MakeInfo(Transform), MakeInfo(Location), MakeInfo(Z) };
+    std::vector<float> Values(Objects.size());
+    GatherPropertyPath<float>(Objects, ZPath, Values, -2.0f);
+
+    for (size_t i = 0; i < Objects.size(); i++)
+        UESDK_CHECK(Values[i] == (i == 7 ? -2.0f : static_cast<float>(i)));
+
+    const PropertyInfo FlagsPath[] = { MakeInfo(Transform), FlagsInfo };
+    std::vector<uint8_t> Set(Objects.size());
+    GatherPropertyPath<uint8_t>(Objects, FlagsPath, Set);
+
+    for (size_t i = 0; i < Objects.size(); i++)
+        UESDK_CHECK(Set[i] == (i != 7 && i % 2));
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+
+    TestStructOnlyPath();
+    return 0;
+}
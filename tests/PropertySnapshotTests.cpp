@@ -0,0 +1,65 @@
+#include <Check.hpp>
+#include <FakeObjects.hpp>
+
+#include <uesdk/helpers/PropertySnapshot.hpp>
+
+#include <array>
+
+using namespace SDK;
+
+static constexpr int32_t kHealthOffset = 0x80;
+static constexpr int32_t kAmmoOffset = 0x88;
+
+// Health is a float, Ammo an int32 static array of two, watched as one 8 byte column.
+static void TestCapture()
+{
+    Fake::FFakeObjectArray ObjectArray(8);
+
+    Fake::FFakeClass PawnClass("Pawn");
+    PawnClass.AddProperty("Health", kHealthOffset, sizeof(float), CPF_IsPlainOldData, CASTCLASS_FFloatProperty);
+    PawnClass.AddProperty("Ammo", kAmmoOffset, sizeof(int32_t), CPF_IsPlainOldData, CASTCLASS_FIntProperty).ArrayDim = 2;
+    ObjectArray.Add(PawnClass.Get());
+
+    Fake::FFakeObject First;
+    Fake::FFakeObject Second;
+    First.Get()->Class = PawnClass.Get();
+    Second.Get()->Class = PawnClass.Get();
+    const int32_t FirstIndex = ObjectArray.Add(First.Get());
+    ObjectArray.Add(Second.Get());
+
+    FPropertySnapshot Snapshot;
+    Snapshot.Watch(PawnClass.Get(), { "Health", "Ammo" });
+    Snapshot.RefreshObjects();
+    UESDK_CHECK(Snapshot.GetObjects(0).size() == 2);
+
+    // Every column of new rows is reported once.
+    UESDK_CHECK(Snapshot.Capture().size() == 4);
+    UESDK_CHECK(Snapshot.Capture().empty());
+
+    // The second element of the array is part of the column.
+    Fake::SetMember<int32_t>(First.Get(), kAmmoOffset + sizeof(int32_t), 5);
+    const std::vector<FPropertySnapshot::FChange>& Changes = Snapshot.Capture();
+    UESDK_CHECK(Changes.size() == 1 && Changes[0].Column == 1);
+    const std::span<const std::array<int32_t, 2>> Ammo = Snapshot.GetColumn<std::array<int32_t, 2>>(0, 1);
+    UESDK_CHECK(Ammo[Changes[0].Row][1] == 5);
+
+    // Another object in the same slot and memory, Capture keeps the old values until RefreshObjects picks it up as a new row.
+    ObjectArray.Replace(FirstIndex, First.Get());
+    Fake::SetMember<float>(First.Get(), kHealthOffset, 3.0f);
+    UESDK_CHECK(Snapshot.Capture().empty());
+
+    Snapshot.RefreshObjects();
+    UESDK_CHECK(Snapshot.Capture().size() == 2);
+
+    Snapshot.RefreshObjects();
+    UESDK_CHECK(Snapshot.Capture().empty());
+}
+
+int main()
+{
+    Fake::SetupOffsets();
+    Fake::SetupNames();
+
+    TestCapture();
+    return 0;
+}
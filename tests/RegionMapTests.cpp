@@ -0,0 +1,176 @@
+#include <Check.hpp>
+
+#include <private/RegionMap.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace SDK::Memory;
+
+static const int32_t s_Global = 42;
+
+static size_t GetPageSize()
+{
+#ifdef _WIN32
+    SYSTEM_INFO Info;
+    GetSystemInfo(&Info);
+    return Info.dwPageSize;
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+static uint8_t* AllocatePages(size_t Size)
+{
+#ifdef _WIN32
+    return static_cast<uint8_t*>(VirtualAlloc(nullptr, Size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE));
+#else
+    void* Pages = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return Pages == MAP_FAILED ? nullptr : static_cast<uint8_t*>(Pages);
+#endif
+}
+
+static void ProtectPages(uint8_t* Pages, size_t Size, bool bReadable)
+{
+#ifdef _WIN32
+    DWORD OldProtect;
+    VirtualProtect(Pages, Size, bReadable ? PAGE_READONLY : PAGE_NOACCESS, &OldProtect);
+#else
+    mprotect(Pages, Size, bReadable ? PROT_READ : PROT_NONE);
+#endif
+}
+
+static void FreePages(uint8_t* Pages, size_t Size)
+{
+#ifdef _WIN32
+    VirtualFree(Pages, 0, MEM_RELEASE);
+#else
+    munmap(Pages, Size);
+#endif
+}
+
+static void TestKnownAddresses()
+{
+    FRegionMap& Map = FRegionMap::Get();
+
+    const int32_t Local = 1;
+    const std::vector<uint8_t> Heap(64);
+
+    UESDK_CHECK(Map.IsReadable(&Local, sizeof(Local)));
+    UESDK_CHECK(Map.IsReadable(Heap.data(), Heap.size()));
+    UESDK_CHECK(Map.IsReadable(&s_Global, sizeof(s_Global)));
+    UESDK_CHECK(Map.IsExecutable(reinterpret_cast<const void*>(&TestKnownAddresses)));
+    UESDK_CHECK(!Map.IsExecutable(Heap.data()));
+
+    UESDK_CHECK(!Map.IsReadable(nullptr));
+    UESDK_CHECK(!Map.IsReadable(&Local, SIZE_MAX));
+
+    UESDK_CHECK(Map.IsInMainModule(reinterpret_cast<uintptr_t>(&TestKnownAddresses)));
+    UESDK_CHECK(!Map.IsInMainModule(reinterpret_cast<uintptr_t>(Heap.data())));
+}
+
+static void TestSnapshot()
+{
+    const std::vector<FRegion> Regions = FRegionMap::Get().GetRegions();
+    UESDK_CHECK(!Regions.empty());
+
+    // Sorted, not overlapping, and touching regions only if their access differs.
+    for (size_t i = 0; i < Regions.size(); i++) {
+        UESDK_CHECK(Regions[i].Begin < Regions[i].End);
+        if (i > 0) {
+            UESDK_CHECK(Regions[i - 1].End <= Regions[i].Begin);
+            UESDK_CHECK(Regions[i - 1].End != Regions[i].Begin || Regions[i - 1].Access != Regions[i].Access);
+        }
+    }
+}
+
+// Three pages, the middle one's access changed, so the range spans three regions.
+static void TestRangeAcrossRegions()
+{
+    FRegionMap& Map = FRegionMap::Get();
+    const size_t PageSize = GetPageSize();
+
+    uint8_t* Pages = AllocatePages(PageSize * 3);
+    UESDK_CHECK(Pages);
+
+    ProtectPages(Pages + PageSize, PageSize, true);
+    Map.Refresh();
+    UESDK_CHECK(Map.IsReadable(Pages, PageSize * 3));
+
+    ProtectPages(Pages + PageSize, PageSize, false);
+    Map.Refresh();
+    UESDK_CHECK(Map.IsReadable(Pages, PageSize));
+    UESDK_CHECK(!Map.IsReadable(Pages + PageSize));
+    UESDK_CHECK(!Map.IsReadable(Pages, PageSize * 3));
+    UESDK_CHECK(Map.IsReadable(Pages + PageSize * 2, PageSize));
+
+    FreePages(Pages, PageSize * 3);
+    Map.Refresh();
+    UESDK_CHECK(!Map.IsReadable(Pages));
+}
+
+// Memory mapped after a snapshot is found once the snapshot is old enough, without calling Refresh.
+static void TestLazyRefresh()
+{
+    FRegionMap& Map = FRegionMap::Get();
+    const size_t PageSize = GetPageSize();
+
+    Map.Refresh();
+    uint8_t* Pages = AllocatePages(PageSize);
+    UESDK_CHECK(Pages);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(FRegionMap::kRefreshIntervalMs + 50));
+    UESDK_CHECK(Map.IsReadable(Pages, PageSize));
+
+    FreePages(Pages, PageSize);
+    Map.Refresh();
+}
+
+// Lookups from several threads while another one keeps refreshing.
+static void TestConcurrentRefresh()
+{
+    FRegionMap& Map = FRegionMap::Get();
+    const std::vector<uint8_t> Heap(64);
+
+    std::atomic<bool> Stop = false;
+    std::atomic<bool> Failed = false;
+    std::vector<std::thread> Threads;
+
+    for (int32_t i = 0; i < 4; i++) {
+        Threads.emplace_back([&]() {
+            while (!Stop) {
+                if (!Map.IsReadable(Heap.data(), Heap.size()) || !Map.IsExecutable(reinterpret_cast<const void*>(&TestConcurrentRefresh)))
+                    Failed = true;
+            }
+        });
+    }
+
+    for (int32_t i = 0; i < 50; i++)
+        Map.Refresh();
+
+    Stop = true;
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    UESDK_CHECK(!Failed);
+}
+
+int main()
+{
+    TestKnownAddresses();
+    TestSnapshot();
+    TestRangeAcrossRegions();
+    TestLazyRefresh();
+    TestConcurrentRefresh();
+    return 0;
+}
@@ -0,0 +1,629 @@
+// uesdk-sdkgen: generates static SDK headers from a reflection snapshot written by SDK::SaveReflectionSnapshot.
+// Runs offline and on any platform, it doesn't link against uesdk. The generated headers only need uesdk's headers.
+//
+// Usage: uesdk-sdkgen <snapshot.txt> <output directory> [package...]
+// Without packages every package in the snapshot is generated.
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    // Must match SDK::kReflectionSnapshotVersion.
+    constexpr uint32_t kSnapshotVersion = 1;
+
+    // EClassCastFlags, see uesdk/core/UnrealEnums.hpp.
+    constexpr uint64_t CASTCLASS_FInt8Property = 0x0000000000000002;
+    constexpr uint64_t CASTCLASS_FByteProperty = 0x0000000000000040;
+    constexpr uint64_t CASTCLASS_FIntProperty = 0x0000000000000080;
+    constexpr uint64_t CASTCLASS_FFloatProperty = 0x0000000000000100;
+    constexpr uint64_t CASTCLASS_FUInt64Property = 0x0000000000000200;
+    constexpr uint64_t CASTCLASS_FClassProperty = 0x0000000000000400;
+    constexpr uint64_t CASTCLASS_FUInt32Property = 0x0000000000000800;
+    constexpr uint64_t CASTCLASS_FNameProperty = 0x0000000000002000;
+    constexpr uint64_t CASTCLASS_FStrProperty = 0x0000000000004000;
+    constexpr uint64_t CASTCLASS_FObjectProperty = 0x0000000000010000;
+    constexpr uint64_t CASTCLASS_FBoolProperty = 0x0000000000020000;
+    constexpr uint64_t CASTCLASS_FUInt16Property = 0x0000000000040000;
+    constexpr uint64_t CASTCLASS_FInt64Property = 0x0000000000400000;
+    constexpr uint64_t CASTCLASS_FInt16Property = 0x0000000080000000;
+    constexpr uint64_t CASTCLASS_FDoubleProperty = 0x0000000100000000;
+
+    // EPropertyFlags
+    constexpr uint64_t CPF_OutParm = 0x0000000000000100;
+    constexpr uint64_t CPF_ReturnParm = 0x0000000000000400;
+    constexpr uint64_t CPF_ConstParm = 0x0000000000000002;
+
+    struct FProperty
+    {
+        std::string Name;
+        std::string TypeName;
+        uint64_t CastFlags = 0;
+        int32_t Offset = 0;
+        int32_t ElementSize = 0;
+        int32_t ArrayDim = 1;
+        uint8_t ByteMask = 0;
+        uint64_t Flags = 0;
+
+        int32_t TotalSize() const { return ElementSize * std::max(ArrayDim, 1); }
+    };
+
+    struct FFunction
+    {
+        std::string Name;
+        uint32_t Flags = 0;
+        int32_t ParmsSize = 0;
+        int32_t ReturnValueOffset = 0xFFFF;
+        std::vector<FProperty> Params;
+    };
+
+    struct FStruct
+    {
+        bool IsClass = false;
+        std::string Package;
+        std::string Name;
+        std::string Super;
+        int32_t Size = 0;
+        int32_t Alignment = 0;
+        std::vector<FProperty> Properties;
+        std::vector<FFunction> Functions;
+    };
+
+    struct FEnum
+    {
+        std::string Package;
+        std::string Name;
+        std::vector<std::pair<std::string, int64_t>> Values;
+    };
+
+    struct FSnapshot
+    {
+        bool UsesFProperty = false;
+        std::vector<FStruct> Structs;
+        std::vector<FEnum> Enums;
+    };
+
+    std::vector<std::string_view> SplitTabs(std::string_view Line)
+    {
+        std::vector<std::string_view> Fields;
+        size_t Start = 0;
+        while (true) {
+            const size_t End = Line.find('\t', Start);
+            Fields.push_back(Line.substr(Start, End == std::string_view::npos ? std::string_view::npos : End - Start));
+            if (End == std::string_view::npos)
+                return Fields;
+            Start = End + 1;
+        }
+    }
+
+    int64_t ParseInt(std::string_view Text)
+    {
+        size_t Parsed = 0;
+        const int64_t Value = std::stoll(std::string(Text), &Parsed, 10);
+        if (Parsed != Text.size())
+            throw std::runtime_error("invalid number '" + std::string(Text) + "'");
+        return Value;
+    }
+
+    uint64_t ParseHex(std::string_view Text)
+    {
+        size_t Parsed = 0;
+        const uint64_t Value = std::stoull(std::string(Text), &Parsed, 16);
+        if (Parsed != Text.size())
+            throw std::runtime_error("invalid hex number '" + std::string(Text) + "'");
+        return Value;
+    }
+
+    FProperty ParseProperty(const std::vector<std::string_view>& Fields)
+    {
+        if (Fields.size() < 9)
+            throw std::runtime_error("truncated property record");
+
+        FProperty Property;
+        Property.Name = Fields[1];
+        Property.TypeName = Fields[2];
+        Property.CastFlags = ParseHex(Fields[3]);
+        Property.Offset = static_cast<int32_t>(ParseInt(Fields[4]));
+        Property.ElementSize = static_cast<int32_t>(ParseInt(Fields[5]));
+        Property.ArrayDim = static_cast<int32_t>(ParseInt(Fields[6]));
+        Property.ByteMask = static_cast<uint8_t>(ParseInt(Fields[7]));
+        Property.Flags = ParseHex(Fields[8]);
+        return Property;
+    }
+
+    FSnapshot ReadSnapshot(std::istream& Stream)
+    {
+        FSnapshot Snapshot;
+        std::string Line;
+        size_t LineNumber = 0;
+
+        FStruct* CurrentStruct = nullptr;
+        FFunction* CurrentFunction = nullptr;
+        FEnum* CurrentEnum = nullptr;
+
+        try {
+            while (std::getline(Stream, Line)) {
+                LineNumber++;
+                if (!Line.empty() && Line.back() == '\r')
+                    Line.pop_back();
+                if (Line.empty())
+                    continue;
+
+                const std::vector<std::string_view> Fields = SplitTabs(Line);
+                const std::string_view Tag = Fields[0];
+
+                if (LineNumber == 1) {
+                    if (Tag != "UESDK_SNAPSHOT" || Fields.size() < 3)
+                        throw std::runtime_error("not a reflection snapshot");
+                    if (ParseInt(Fields[1]) != kSnapshotVersion)
+                        throw std::runtime_error("unsupported snapshot version " + std::string(Fields[1]));
+
+                    Snapshot.UsesFProperty = Fields[2] == "FProperty";
+                    continue;
+                }
+
+                if (Tag == "CLASS" || Tag == "STRUCT") {
+                    if (Fields.size() < 6)
+                        throw std::runtime_error("truncated struct record");
+
+                    FStruct& Struct = Snapshot.Structs.emplace_back();
+                    Struct.IsClass = Tag == "CLASS";
+                    Struct.Package = Fields[1];
+                    Struct.Name = Fields[2];
+                    Struct.Super = Fields[3] == "-" ? "" : std::string(Fields[3]);
+                    Struct.Size = static_cast<int32_t>(ParseInt(Fields[4]));
+                    Struct.Alignment = static_cast<int32_t>(ParseInt(Fields[5]));
+
+                    CurrentStruct = &Struct;
+                    CurrentFunction = nullptr;
+                    CurrentEnum = nullptr;
+                }
+                else if (Tag == "PROP") {
+                    if (!CurrentStruct)
+                        throw std::runtime_error("PROP outside of a struct");
+                    CurrentStruct->Properties.push_back(ParseProperty(Fields));
+                }
+                else if (Tag == "FUNC") {
+                    if (!CurrentStruct || Fields.size() < 5)
+                        throw std::runtime_error("invalid FUNC record");
+
+                    FFunction& Function = CurrentStruct->Functions.emplace_back();
+                    Function.Name = Fields[1];
+                    Function.Flags = static_cast<uint32_t>(ParseHex(Fields[2]));
+                    Function.ParmsSize = static_cast<int32_t>(ParseInt(Fields[3]));
+                    Function.ReturnValueOffset = static_cast<int32_t>(ParseInt(Fields[4]));
+                    CurrentFunction = &Function;
+                }
+                else if (Tag == "PARM") {
+                    if (!CurrentFunction)
+                        throw std::runtime_error("PARM outside of a function");
+                    CurrentFunction->Params.push_back(ParseProperty(Fields));
+                }
+                else if (Tag == "ENUM") {
+                    if (Fields.size() < 3)
+                        throw std::runtime_error("truncated ENUM record");
+
+                    FEnum& Enum = Snapshot.Enums.emplace_back();
+                    Enum.Package = Fields[1];
+                    Enum.Name = Fields[2];
+
+                    CurrentEnum = &Enum;
+                    CurrentStruct = nullptr;
+                    CurrentFunction = nullptr;
+                }
+                else if (Tag == "VALUE") {
+                    if (!CurrentEnum || Fields.size() < 3)
+                        throw std::runtime_error("invalid VALUE record");
+                    CurrentEnum->Values.emplace_back(std::string(Fields[1]), ParseInt(Fields[2]));
+                }
+                else {
+                    throw std::runtime_error("unknown record '" + std::string(Tag) + "'");
+                }
+            }
+        }
+        catch (const std::exception& Error) {
+            throw std::runtime_error("line " + std::to_string(LineNumber) + ": " + Error.what());
+        }
+
+        if (LineNumber == 0)
+            throw std::runtime_error("empty snapshot");
+
+        return Snapshot;
+    }
+
+    // Identifiers
+
+    bool IsKeyword(std::string_view Name)
+    {
+        static const std::unordered_set<std::string_view> Keywords = {
+            "alignas", "alignof", "and", "asm", "auto", "bool", "break", "case", "catch", "char", "class", "concept", "const", "consteval", "constexpr",
+            "constinit", "const_cast", "continue", "decltype", "default", "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export",
+            "extern", "false", "float", "for", "friend", "goto", "if", "import", "inline", "int", "long", "module", "mutable", "namespace", "new", "noexcept",
+            "not", "nullptr", "operator", "or", "private", "protected", "public", "register", "reinterpret_cast", "requires", "return", "short", "signed",
+            "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef",
+            "typeid", "typename", "union", "unsigned", "using", "virtual", "void", "volatile", "while", "xor",
+            // Names the generated code declares itself.
+            "Size", "Alignment", "Offsets", "Masks", "Params", "SDK",
+        };
+        return Keywords.contains(Name);
+    }
+
+    std::string MakeIdentifier(std::string_view Name)
+    {
+        std::string Result;
+        Result.reserve(Name.size() + 1);
+
+        for (char Char : Name) {
+            const bool Valid = (Char >= 'a' && Char <= 'z') || (Char >= 'A' && Char <= 'Z') || (Char >= '0' && Char <= '9') || Char == '_';
+            Result.push_back(Valid ? Char : '_');
+        }
+
+        if (Result.empty() || (Result[0] >= '0' && Result[0] <= '9'))
+            Result.insert(Result.begin(), '_');
+        if (IsKeyword(Result))
+            Result.push_back('_');
+
+        return Result;
+    }
+
+    // Hands out unique identifiers within one scope.
+    class FScope
+    {
+    public:
+        std::string Add(std::string_view Name)
+        {
+            std::string Base = MakeIdentifier(Name);
+            std::string Result = Base;
+            for (int32_t i = 1; !m_Used.insert(Result).second; i++)
+                Result = Base + "_" + std::to_string(i);
+            return Result;
+        }
+
+    private:
+        std::unordered_set<std::string> m_Used;
+    };
+
+    // "/Script/Engine" -> "Engine"
+    std::string GetPackageIdentifier(std::string_view Package)
+    {
+        const size_t Slash = Package.find_last_of('/');
+        return MakeIdentifier(Slash == std::string_view::npos ? Package : Package.substr(Slash + 1));
+    }
+
+    std::string Hex(int64_t Value)
+    {
+        std::ostringstream Stream;
+        if (Value < 0)
+            Stream << '-' << "0x" << std::hex << std::uppercase << static_cast<uint64_t>(-(Value + 1)) + 1;
+        else
+            Stream << "0x" << std::hex << std::uppercase << Value;
+        return Stream.str();
+    }
+
+    // Types
+
+    // C++ type of a property for parameter structs, or empty if it's copied as raw bytes.
+    std::string GetCppType(const FProperty& Property)
+    {
+        const uint64_t Flags = Property.CastFlags;
+        const int32_t Size = Property.ElementSize;
+
+        if (Flags & CASTCLASS_FBoolProperty)
+            return Property.ByteMask == 0 && Size == 1 ? "bool" : "";
+        if (Flags & CASTCLASS_FInt8Property)
+            return Size == 1 ? "int8_t" : "";
+        if (Flags & CASTCLASS_FInt16Property)
+            return Size == 2 ? "int16_t" : "";
+        if (Flags & CASTCLASS_FIntProperty)
+            return Size == 4 ? "int32_t" : "";
+        if (Flags & CASTCLASS_FInt64Property)
+            return Size == 8 ? "int64_t" : "";
+        if (Flags & CASTCLASS_FByteProperty)
+            return Size == 1 ? "uint8_t" : "";
+        if (Flags & CASTCLASS_FUInt16Property)
+            return Size == 2 ? "uint16_t" : "";
+        if (Flags & CASTCLASS_FUInt32Property)
+            return Size == 4 ? "uint32_t" : "";
+        if (Flags & CASTCLASS_FUInt64Property)
+            return Size == 8 ? "uint64_t" : "";
+        if (Flags & CASTCLASS_FFloatProperty)
+            return Size == 4 ? "float" : "";
+        if (Flags & CASTCLASS_FDoubleProperty)
+            return Size == 8 ? "double" : "";
+        if (Flags & CASTCLASS_FNameProperty)
+            return "SDK::FName";
+        if (Flags & CASTCLASS_FStrProperty)
+            return Size == 16 ? "SDK::FString" : "";
+        if (Flags & (CASTCLASS_FObjectProperty | CASTCLASS_FClassProperty))
+            return Size == 8 ? "SDK::UObject*" : "";
+
+        return "";
+    }
+
+    const char* GetEnumUnderlyingType(const FEnum& Enum)
+    {
+        int64_t Min = 0, Max = 0;
+        for (const auto& [Name, Value] : Enum.Values) {
+            Min = std::min(Min, Value);
+            Max = std::max(Max, Value);
+        }
+
+        if (Min >= 0 && Max <= UINT8_MAX)
+            return "uint8_t";
+        if (Min >= INT32_MIN && Max <= INT32_MAX)
+            return "int32_t";
+        return "int64_t";
+    }
+
+    // Output
+
+    class FWriter
+    {
+    public:
+        explicit FWriter(std::ostream& Stream)
+            : m_Stream(Stream)
+        {
+        }
+
+        void Line(std::string_view Text)
+        {
+            if (m_PendingBlank)
+                m_Stream << '\n';
+            m_PendingBlank = false;
+            m_Stream << std::string(m_Indent * 4, ' ') << Text << '\n';
+        }
+
+        // Blank line before the next line, dropped if a scope closes first.
+        void Blank() { m_PendingBlank = true; }
+
+        void Open(std::string_view Text)
+        {
+            Line(Text);
+            Line("{");
+            m_Indent++;
+        }
+
+        void Close(std::string_view Suffix = {})
+        {
+            m_PendingBlank = false;
+            m_Indent--;
+            Line("}" + std::string(Suffix));
+        }
+
+    private:
+        std::ostream& m_Stream;
+        int32_t m_Indent = 0;
+        bool m_PendingBlank = false;
+    };
+
+    void WriteEnum(FWriter& Out, FScope& Scope, const FEnum& Enum)
+    {
+        Out.Line("// Enum " + Enum.Package + "." + Enum.Name);
+        Out.Open("enum class " + Scope.Add(Enum.Name) + " : " + GetEnumUnderlyingType(Enum));
+
+        FScope Values;
+        for (const auto& [Name, Value] : Enum.Values) {
+            // Enum class enumerators are named "EName::Value", namespaced ones "Value".
+            const size_t Separator = Name.rfind("::");
+            const std::string_view Short = Separator == std::string::npos ? std::string_view(Name) : std::string_view(Name).substr(Separator + 2);
+            Out.Line(Values.Add(Short) + " = " + std::to_string(Value) + ",");
+        }
+
+        Out.Close(";");
+        Out.Blank();
+    }
+
+    void WriteParams(FWriter& Out, const FStruct& Owner, const FFunction& Function)
+    {
+        std::vector<FProperty> Params = Function.Params;
+        std::stable_sort(Params.begin(), Params.end(), [](const FProperty& A, const FProperty& B) { return A.Offset < B.Offset; });
+
+        FScope Fields;
+        const std::string Name = Fields.Add(Function.Name);
+
+        Out.Line("// Function " + Owner.Name + "." + Function.Name + ", flags " + Hex(Function.Flags));
+        Out.Open("struct " + Name);
+        Out.Line("static constexpr const char* UClassName = \"" + Owner.Name + "\";");
+        Out.Line("static constexpr const char* UFunctionName = \"" + Function.Name + "\";");
+        Fields.Add("UClassName");
+        Fields.Add("UFunctionName");
+
+        std::vector<std::pair<std::string, int32_t>> Asserts;
+        int32_t Cursor = 0;
+
+        for (const FProperty& Param : Params) {
+            if (Param.Offset < Cursor) {
+                std::cerr << "Skipping overlapping parameter " << Owner.Name << "." << Function.Name << "." << Param.Name << "\n";
+                continue;
+            }
+
+            if (Param.Offset > Cursor)
+                Out.Line("uint8_t Pad_" + Hex(Cursor).substr(2) + "[" + Hex(Param.Offset - Cursor) + "];");
+
+            std::string Comment;
+            if (Param.Flags & CPF_ReturnParm)
+                Comment = " // Return value";
+            else if ((Param.Flags & CPF_OutParm) && !(Param.Flags & CPF_ConstParm))
+                Comment = " // Out";
+
+            const std::string FieldName = Fields.Add(Param.Name);
+            const std::string Type = GetCppType(Param);
+            const std::string Dim = Param.ArrayDim > 1 ? "[" + std::to_string(Param.ArrayDim) + "]" : "";
+
+            if (Type.empty())
+                Out.Line("uint8_t " + FieldName + "[" + Hex(Param.TotalSize()) + "]; // " + Param.TypeName + Comment);
+            else
+                Out.Line(Type + " " + FieldName + Dim + ";" + Comment);
+
+            Asserts.emplace_back(FieldName, Param.Offset);
+            Cursor = Param.Offset + Param.TotalSize();
+        }
+
+        if (Cursor < Function.ParmsSize)
+            Out.Line("uint8_t Pad_" + Hex(Cursor).substr(2) + "[" + Hex(Function.ParmsSize - Cursor) + "];");
+
+        Out.Close(";");
+
+        if (Function.ParmsSize > 0)
+            Out.Line("static_assert(sizeof(" + Name + ") == " + Hex(Function.ParmsSize) + ", \"Wrong size of " + Owner.Name + "." + Function.Name + " parameters\");");
+        for (const auto& [Field, Offset] : Asserts)
+            Out.Line("static_assert(offsetof(" + Name + ", " + Field + ") == " + Hex(Offset) + ");");
+        Out.Blank();
+    }
+
+    void WriteStruct(FWriter& Out, FScope& Scope, const FStruct& Struct)
+    {
+        Out.Line(std::string("// ") + (Struct.IsClass ? "Class " : "Struct ") + Struct.Package + "." + Struct.Name + (Struct.Super.empty() ? "" : " : " + Struct.Super));
+        Out.Open("namespace " + Scope.Add(Struct.Name));
+
+        Out.Line("constexpr int32_t Size = " + Hex(Struct.Size) + ";");
+        Out.Line("constexpr int32_t Alignment = " + Hex(Struct.Alignment) + ";");
+
+        if (!Struct.Properties.empty()) {
+            Out.Blank();
+            Out.Open("namespace Offsets");
+            FScope Names;
+            for (const FProperty& Property : Struct.Properties)
+                Out.Line("constexpr int32_t " + Names.Add(Property.Name) + " = " + Hex(Property.Offset) + "; // " + Property.TypeName);
+            Out.Close();
+        }
+
+        const bool HasBitfields = std::any_of(Struct.Properties.begin(), Struct.Properties.end(), [](const FProperty& Property) { return Property.ByteMask != 0; });
+        if (HasBitfields) {
+            Out.Blank();
+            Out.Open("namespace Masks");
+            FScope Names;
+            for (const FProperty& Property : Struct.Properties) {
+                const std::string Name = Names.Add(Property.Name);
+                if (Property.ByteMask)
+                    Out.Line("constexpr uint8_t " + Name + " = " + Hex(Property.ByteMask) + ";");
+            }
+            Out.Close();
+        }
+
+        if (!Struct.Functions.empty()) {
+            Out.Blank();
+            Out.Open("namespace Params");
+            for (const FFunction& Function : Struct.Functions)
+                WriteParams(Out, Struct, Function);
+            Out.Close();
+        }
+
+        Out.Close();
+        Out.Blank();
+    }
+
+    void WritePackage(const fs::path& Path, const std::string& Package, const std::vector<const FStruct*>& Structs, const std::vector<const FEnum*>& Enums)
+    {
+        std::ofstream File(Path, std::ios::out | std::ios::trunc);
+        if (!File)
+            throw std::runtime_error("failed to open " + Path.string());
+
+        FWriter Out(File);
+        Out.Line("#pragma once");
+        Out.Line("// Generated by uesdk-sdkgen from a reflection snapshot, do not edit.");
+        Out.Line("// Package " + Package);
+        Out.Line("#include <uesdk/core/UnrealContainers.hpp>");
+        Out.Line("#include <uesdk/core/UnrealTypes.hpp>");
+        Out.Blank();
+        Out.Line("#include <cstddef>");
+        Out.Line("#include <cstdint>");
+        Out.Blank();
+        Out.Line("namespace SDK");
+        Out.Line("{");
+        Out.Line("    class UObject;");
+        Out.Line("}");
+        Out.Blank();
+        Out.Open("namespace SDK::Static::" + GetPackageIdentifier(Package));
+
+        FScope Scope;
+        for (const FEnum* Enum : Enums)
+            WriteEnum(Out, Scope, *Enum);
+        for (const FStruct* Struct : Structs)
+            WriteStruct(Out, Scope, *Struct);
+
+        Out.Close();
+
+        if (!File)
+            throw std::runtime_error("failed to write " + Path.string());
+    }
+
+    int Run(int Argc, char** Argv)
+    {
+        if (Argc < 3) {
+            std::cerr << "Usage: " << Argv[0] << " <snapshot.txt> <output directory> [package...]\n";
+            return 2;
+        }
+
+        std::ifstream Input(Argv[1]);
+        if (!Input) {
+            std::cerr << "Failed to open " << Argv[1] << "\n";
+            return 1;
+        }
+
+        const FSnapshot Snapshot = ReadSnapshot(Input);
+
+        std::set<std::string> Wanted;
+        for (int i = 3; i < Argc; i++)
+            Wanted.insert(GetPackageIdentifier(Argv[i]));
+
+        // Grouped by package identifier, two packages may share one, e.g. "/Script/Foo" and "/Game/Foo".
+        std::map<std::string, std::pair<std::vector<const FStruct*>, std::vector<const FEnum*>>> Packages;
+        std::map<std::string, std::string> PackageNames;
+
+        for (const FStruct& Struct : Snapshot.Structs) {
+            const std::string Id = GetPackageIdentifier(Struct.Package);
+            Packages[Id].first.push_back(&Struct);
+            PackageNames.try_emplace(Id, Struct.Package);
+        }
+        for (const FEnum& Enum : Snapshot.Enums) {
+            const std::string Id = GetPackageIdentifier(Enum.Package);
+            Packages[Id].second.push_back(&Enum);
+            PackageNames.try_emplace(Id, Enum.Package);
+        }
+
+        const fs::path OutputDir = Argv[2];
+        fs::create_directories(OutputDir);
+
+        std::vector<std::string> Written;
+        for (const auto& [Id, Contents] : Packages) {
+            if (!Wanted.empty() && !Wanted.contains(Id))
+                continue;
+
+            WritePackage(OutputDir / (Id + ".hpp"), PackageNames[Id], Contents.first, Contents.second);
+            Written.push_back(Id);
+        }
+
+        std::ofstream All(OutputDir / "SDK.hpp", std::ios::out | std::ios::trunc);
+        All << "#pragma once\n// Generated by uesdk-sdkgen from a reflection snapshot, do not edit.\n";
+        for (const std::string& Id : Written)
+            All << "#include \"" << Id << ".hpp\"\n";
+
+        std::cout << "Generated " << Written.size() << " package(s) from " << Snapshot.Structs.size() << " structs and " << Snapshot.Enums.size() << " enums\n";
+        return All ? 0 : 1;
+    }
+}
+
+int main(int Argc, char** Argv)
+{
+    try {
+        return Run(Argc, Argv);
+    }
+    catch (const std::exception& Error) {
+        std::cerr << "uesdk-sdkgen: " << Error.what() << "\n";
+        return 1;
+    }
+}